@@ -62,7 +62,11 @@
 //-----------------------------------------------------------------------------
 #include <ascent_logging.hpp>
 
+#include <algorithm>
+#include <cstring>
 #include <fstream>
+#include <map>
+#include <vector>
 
 using namespace conduit;
 using namespace std;
@@ -72,6 +76,303 @@ using namespace std;
 namespace ascent
 {
 
+//-----------------------------------------------------------------------------
+// -- begin ascent::detail --
+//-----------------------------------------------------------------------------
+namespace detail
+{
+
+// the non-blocking transfer uses its own tag, so it can't be confused
+// with messages of the blocking variant
+static const int hola_mpi_isend_tag = 4242;
+
+//
+// sends posted by hola_mpi_isend, and the packed messages they read
+// from, until hola_mpi_wait()
+//
+struct HolaMPIPendingSends
+{
+    std::vector<MPI_Request>   requests;
+    std::vector<Node*>         buffers;
+};
+
+static HolaMPIPendingSends s_pending_sends;
+
+// last schema sent for (global domain index, dest rank) and received
+// for (global domain index, src rank). Domains only carry their schema
+// when it differs from the last one sent over the same pair.
+static std::map<std::pair<int,int>, std::string> s_sent_schemas;
+static std::map<std::pair<int,int>, std::string> s_recv_schemas;
+
+//-----------------------------------------------------------------------------
+// packs a domain as:
+//   header:  int64, number of schema bytes (0 when unchanged)
+//   schema:  compact json schema of the data (when changed)
+//   data:    compact data
+Node *
+hola_mpi_pack(const Node &domain,
+              int domain_index,
+              int dest_rank)
+{
+    Schema s_data;
+    domain.schema().compact_to(s_data);
+    std::string schema_json = s_data.to_json();
+
+    std::pair<int,int> key(domain_index, dest_rank);
+    std::map<std::pair<int,int>, std::string>::iterator itr;
+    itr = s_sent_schemas.find(key);
+    bool send_schema = itr == s_sent_schemas.end() ||
+                       itr->second != schema_json;
+
+    Node n_msg;
+    n_msg["header"].set_int64(0);
+    if(send_schema)
+    {
+        n_msg["schema"].set(schema_json);
+        n_msg["header"].set_int64(n_msg["schema"].dtype().number_of_elements());
+        s_sent_schemas[key] = schema_json;
+    }
+    n_msg["data"].set_external(domain);
+
+    Node *n_packed = new Node();
+    n_msg.compact_to(*n_packed);
+    return n_packed;
+}
+
+//-----------------------------------------------------------------------------
+void
+hola_mpi_unpack(const std::vector<char> &buffer,
+                int domain_index,
+                int src_rank,
+                Node &domain)
+{
+    int64 schema_bytes = 0;
+    memcpy(&schema_bytes, &buffer[0], sizeof(int64));
+    const char *schema_ptr = &buffer[0] + sizeof(int64);
+
+    std::pair<int,int> key(domain_index, src_rank);
+    if(schema_bytes > 0)
+    {
+        // the schema string is null terminated
+        s_recv_schemas[key] = std::string(schema_ptr);
+    }
+    else if(s_recv_schemas.find(key) == s_recv_schemas.end())
+    {
+        ASCENT_ERROR("hola_mpi: received domain " << domain_index
+                     << " from rank " << src_rank
+                     << " without a schema");
+    }
+
+    Schema s_data(s_recv_schemas[key]);
+    domain.set(s_data,
+               (void*)(schema_ptr + schema_bytes));
+}
+
+//
+// mapping kept by hola_mpi_balanced_comm_map across cycles, and the
+// balance it achieved for the last call
+//
+static Node s_balanced_map;
+static Node s_balance_info;
+
+//-----------------------------------------------------------------------------
+// estimates the number of cells of a blueprint domain from its first
+// topology, returns 0 if it can't tell
+float64
+hola_mpi_domain_num_cells(const Node &dom)
+{
+    if(!dom.has_child("topologies") ||
+       dom["topologies"].number_of_children() == 0)
+    {
+        return 0.0;
+    }
+
+    const Node &n_topo = dom["topologies"].child(0);
+    const std::string topo_type = n_topo["type"].as_string();
+
+    const Node *n_coords = NULL;
+    if(n_topo.has_child("coordset") &&
+       dom.has_path("coordsets/" + n_topo["coordset"].as_string()))
+    {
+        n_coords = dom.fetch_ptr("coordsets/" + n_topo["coordset"].as_string());
+    }
+
+    float64 res = 1.0;
+    if(topo_type == "uniform" && n_coords != NULL)
+    {
+        const Node &n_dims = (*n_coords)["dims"];
+        for(int i = 0; i < n_dims.number_of_children(); i++)
+        {
+            res *= std::max(n_dims.child(i).to_float64() - 1.0, 1.0);
+        }
+    }
+    else if(topo_type == "rectilinear" && n_coords != NULL)
+    {
+        const Node &n_vals = (*n_coords)["values"];
+        for(int i = 0; i < n_vals.number_of_children(); i++)
+        {
+            float64 len = n_vals.child(i).dtype().number_of_elements();
+            res *= std::max(len - 1.0, 1.0);
+        }
+    }
+    else if(topo_type == "structured")
+    {
+        const Node &n_dims = n_topo["elements/dims"];
+        for(int i = 0; i < n_dims.number_of_children(); i++)
+        {
+            res *= std::max(n_dims.child(i).to_float64(), 1.0);
+        }
+    }
+    else if(topo_type == "points" && n_coords != NULL &&
+            (*n_coords)["values"].number_of_children() > 0)
+    {
+        res = (*n_coords)["values"].child(0).dtype().number_of_elements();
+    }
+    else if(topo_type == "unstructured")
+    {
+        const Node &n_elems = n_topo["elements"];
+        if(n_elems.has_child("sizes"))
+        {
+            res = n_elems["sizes"].dtype().number_of_elements();
+        }
+        else if(n_elems.has_child("shape") &&
+                n_elems.has_child("connectivity"))
+        {
+            const std::string shape = n_elems["shape"].as_string();
+            float64 shape_pts = 0.0;
+            if(shape == "point")        shape_pts = 1.0;
+            else if(shape == "line")    shape_pts = 2.0;
+            else if(shape == "tri")     shape_pts = 3.0;
+            else if(shape == "quad")    shape_pts = 4.0;
+            else if(shape == "tet")     shape_pts = 4.0;
+            else if(shape == "pyramid") shape_pts = 5.0;
+            else if(shape == "wedge")   shape_pts = 6.0;
+            else if(shape == "hex")     shape_pts = 8.0;
+
+            float64 conn = n_elems["connectivity"].dtype().number_of_elements();
+            res = shape_pts > 0.0 ? conn / shape_pts : 0.0;
+        }
+        else
+        {
+            res = 0.0;
+        }
+    }
+    else
+    {
+        res = 0.0;
+    }
+
+    return res;
+}
+
+//-----------------------------------------------------------------------------
+// splits the weights (in global domain order) into dest_size contiguous
+// ranges, minimizing the largest range sum. Contiguous ranges keep the
+// send and receive side bookkeeping of hola_mpi_comm_map.
+void
+hola_mpi_partition(const std::vector<float64> &weights,
+                   int32 dest_size,
+                   int32_array &dest_counts)
+{
+    const int32 num_doms = (int32) weights.size();
+
+    float64 total = 0.0;
+    float64 largest = 0.0;
+    for(int32 i = 0; i < num_doms; i++)
+    {
+        total += weights[i];
+        largest = std::max(largest, weights[i]);
+    }
+
+    // bisect on the bottleneck, greedy fill is feasible iff it needs
+    // at most dest_size ranges
+    float64 lo = std::max(largest, total / dest_size);
+    float64 hi = std::max(lo, total);
+
+    for(int iter = 0; iter < 64 && hi - lo > 1e-12 * hi; iter++)
+    {
+        float64 mid = 0.5 * (lo + hi);
+        int32 parts = 1;
+        float64 load = 0.0;
+        for(int32 i = 0; i < num_doms; i++)
+        {
+            if(load + weights[i] > mid && load > 0.0)
+            {
+                parts++;
+                load = 0.0;
+            }
+            load += weights[i];
+        }
+
+        if(parts <= dest_size)
+        {
+            hi = mid;
+        }
+        else
+        {
+            lo = mid;
+        }
+    }
+
+    for(int32 d = 0; d < dest_size; d++)
+    {
+        dest_counts[d] = 0;
+    }
+
+    int32 d = 0;
+    float64 load = 0.0;
+    for(int32 i = 0; i < num_doms; i++)
+    {
+        // leave enough domains for the remaining ranges
+        bool must_cut = num_doms - i <= dest_size - 1 - d;
+        if(d < dest_size - 1 && dest_counts[d] > 0 &&
+           (load + weights[i] > hi || must_cut))
+        {
+            d++;
+            load = 0.0;
+        }
+        dest_counts[d]++;
+        load += weights[i];
+    }
+}
+
+//-----------------------------------------------------------------------------
+// max dest load over the average dest load, 1.0 is perfectly balanced
+float64
+hola_mpi_imbalance(const std::vector<float64> &weights,
+                   const int32_array &dest_counts,
+                   float64 &max_load)
+{
+    const int32 dest_size = (int32) dest_counts.number_of_elements();
+    float64 total = 0.0;
+    max_load = 0.0;
+
+    int32 i = 0;
+    for(int32 d = 0; d < dest_size; d++)
+    {
+        float64 load = 0.0;
+        for(int32 c = 0; c < dest_counts[d]; c++, i++)
+        {
+            load += weights[i];
+        }
+        total += load;
+        max_load = std::max(max_load, load);
+    }
+
+    if(total <= 0.0)
+    {
+        return 1.0;
+    }
+
+    return max_load / (total / dest_size);
+}
+
+//-----------------------------------------------------------------------------
+};
+//-----------------------------------------------------------------------------
+// -- end ascent::detail --
+//-----------------------------------------------------------------------------
+
 
 //-----------------------------------------------------------------------------
 int32
@@ -216,6 +517,189 @@ hola_mpi_comm_map(const conduit::Node &data,
 }
 
 
+//-----------------------------------------------------------------------------
+void
+hola_mpi_balanced_comm_map(const conduit::Node &data,
+                           MPI_Comm comm,
+                           const conduit::int32_array &world_to_src,
+                           const conduit::int32_array &world_to_dest,
+                           float64 threshold,
+                           conduit::Node &res)
+{
+    // src side bookkeeping and domain counts are the same as the
+    // offset based map, only the dest ranges change
+    hola_mpi_comm_map(data,
+                      comm,
+                      world_to_src,
+                      world_to_dest,
+                      res);
+
+    int rank = relay::mpi::rank(comm);
+    int total_size = relay::mpi::size(comm);
+    bool is_source_rank = world_to_src[rank] >= 0;
+
+    const int32 src_size  = res["src_counts"].dtype().number_of_elements();
+    const int32 dest_size = res["dest_counts"].dtype().number_of_elements();
+    int32_array src_counts  = res["src_counts"].value();
+    int32_array src_offsets = res["src_offsets"].value();
+
+    int32 num_doms = 0;
+    for(int32 i = 0; i < src_size; i++)
+    {
+        num_doms += src_counts[i];
+    }
+
+    //
+    // gather (cells, bytes) of every domain, in global domain order
+    //
+    std::vector<float64> local_sizes;
+    if(is_source_rank)
+    {
+        NodeConstIterator itr = data.children();
+        while(itr.has_next())
+        {
+            const Node &dom = itr.next();
+            local_sizes.push_back(detail::hola_mpi_domain_num_cells(dom));
+            local_sizes.push_back((float64)dom.total_bytes_compact());
+        }
+    }
+
+    std::vector<int> recv_counts(total_size, 0);
+    std::vector<int> recv_displs(total_size, 0);
+    for(int32 i = 0; i < src_size; i++)
+    {
+        int32 world_rank = res["src_to_world"].as_int32_ptr()[i];
+        recv_counts[world_rank] = 2 * src_counts[i];
+        recv_displs[world_rank] = 2 * src_offsets[i];
+    }
+
+    std::vector<float64> sizes(2 * num_doms + 1, 0.0);
+    MPI_Allgatherv(local_sizes.empty() ? NULL : &local_sizes[0],
+                   (int) local_sizes.size(),
+                   MPI_DOUBLE,
+                   &sizes[0],
+                   &recv_counts[0],
+                   &recv_displs[0],
+                   MPI_DOUBLE,
+                   comm);
+
+    std::vector<float64> cells(num_doms), bytes(num_doms), weights(num_doms);
+    float64 total_cells = 0.0;
+    float64 total_bytes = 0.0;
+    for(int32 i = 0; i < num_doms; i++)
+    {
+        cells[i] = sizes[2*i];
+        bytes[i] = sizes[2*i+1];
+        total_cells += cells[i];
+        total_bytes += bytes[i];
+    }
+
+    // cells and bytes count equally, each as a fraction of its total
+    for(int32 i = 0; i < num_doms; i++)
+    {
+        weights[i] = 0.0;
+        if(total_cells > 0.0)
+        {
+            weights[i] += cells[i] / total_cells;
+        }
+        if(total_bytes > 0.0)
+        {
+            weights[i] += bytes[i] / total_bytes;
+        }
+        if(total_cells <= 0.0 && total_bytes <= 0.0)
+        {
+            weights[i] = 1.0;
+        }
+    }
+
+    //
+    // reuse the last mapping while the sources publish the same domain
+    // counts and it stays within the threshold. every rank has the same
+    // weights, so they all make the same choice.
+    //
+    Node &prev = detail::s_balanced_map;
+    Node n_diff_info;
+    bool reuse = prev.has_child("src_counts") &&
+                 prev["dest_counts"].dtype().number_of_elements() == dest_size &&
+                 !prev["src_counts"].diff(res["src_counts"], n_diff_info);
+
+    float64 imbalance = 0.0;
+    float64 max_load  = 0.0;
+    if(reuse)
+    {
+        int32_array prev_counts = prev["dest_counts"].value();
+        imbalance = detail::hola_mpi_imbalance(weights, prev_counts, max_load);
+        reuse = imbalance <= threshold;
+    }
+
+    int32_array dest_counts = res["dest_counts"].value();
+    if(reuse)
+    {
+        dest_counts.set(prev["dest_counts"].as_int32_ptr(), dest_size);
+        prev["cycles_reused"] = prev["cycles_reused"].to_int32() + 1;
+    }
+    else
+    {
+        detail::hola_mpi_partition(weights, dest_size, dest_counts);
+        prev.reset();
+        prev["src_counts"].set(res["src_counts"]);
+        prev["dest_counts"].set(res["dest_counts"]);
+        prev["cycles_reused"] = 0;
+    }
+
+    int32_array dest_offsets = res["dest_offsets"].value();
+    calc_offsets(dest_counts, dest_offsets);
+
+    //
+    // report the achieved balance
+    //
+    Node &info = detail::s_balance_info;
+    info.reset();
+    info["rebalanced"] = reuse ? "false" : "true";
+    info["cycles_reused"] = prev["cycles_reused"].to_int32();
+    info["threshold"] = threshold;
+    info["dest_counts"].set(res["dest_counts"]);
+
+    imbalance = detail::hola_mpi_imbalance(weights, dest_counts, max_load);
+    info["imbalance"] = imbalance;
+
+    info["dest_cells"] = DataType::float64(dest_size);
+    info["dest_bytes"] = DataType::float64(dest_size);
+    float64_array dest_cells = info["dest_cells"].value();
+    float64_array dest_bytes = info["dest_bytes"].value();
+
+    int32 i = 0;
+    for(int32 d = 0; d < dest_size; d++)
+    {
+        dest_cells[d] = 0.0;
+        dest_bytes[d] = 0.0;
+        for(int32 c = 0; c < dest_counts[d]; c++, i++)
+        {
+            dest_cells[d] += cells[i];
+            dest_bytes[d] += bytes[i];
+        }
+    }
+
+    detail::hola_mpi_imbalance(cells, dest_counts, max_load);
+    info["cells/max"] = max_load;
+    info["cells/avg"] = total_cells / dest_size;
+    info["cells/imbalance"] = total_cells > 0.0 ?
+                              max_load / (total_cells / dest_size) : 1.0;
+
+    detail::hola_mpi_imbalance(bytes, dest_counts, max_load);
+    info["bytes/max"] = max_load;
+    info["bytes/avg"] = total_bytes / dest_size;
+    info["bytes/imbalance"] = total_bytes > 0.0 ?
+                              max_load / (total_bytes / dest_size) : 1.0;
+}
+
+//-----------------------------------------------------------------------------
+void
+hola_mpi_info(conduit::Node &info)
+{
+    info.set(detail::s_balance_info);
+}
+
 //-----------------------------------------------------------------------------
 void
 hola_mpi_send(const conduit::Node &data,
@@ -295,6 +779,147 @@ hola_mpi_recv(MPI_Comm comm,
 }
 
 
+//-----------------------------------------------------------------------------
+void
+hola_mpi_isend(const conduit::Node &data,
+               MPI_Comm comm,
+               int src_idx,
+               const conduit::Node &comm_map)
+{
+    // at most one cycle of sends in flight
+    hola_mpi_wait();
+
+    const int32 *src_counts  = comm_map["src_counts"].value();
+    const int32 *src_offsets = comm_map["src_offsets"].value();
+
+    const int32 *dest_counts   = comm_map["dest_counts"].value();
+    const int32 *dest_offsets  = comm_map["dest_offsets"].value();
+    const int32 *dest_to_world = comm_map["dest_to_world"].value();
+
+    NodeConstIterator itr = data.children();
+
+    int dest_idx = 0;
+    for(int i = src_offsets[src_idx];
+        i < src_offsets[src_idx] + src_counts[src_idx];
+        i++)
+    {
+        const Node &n_curr = itr.next();
+        // find  i's dest
+        while( i >= dest_offsets[dest_idx] + dest_counts[dest_idx])
+        {
+            dest_idx++;
+        }
+
+        int32 dest_rank = dest_to_world[(int32)dest_idx];
+
+        // the packed copy lets the simulation modify its data
+        // while the send is in flight
+        Node *n_packed = detail::hola_mpi_pack(n_curr, i, dest_rank);
+
+        MPI_Request request;
+        int mpi_error = MPI_Isend(n_packed->contiguous_data_ptr(),
+                                  (int) n_packed->total_bytes_compact(),
+                                  MPI_BYTE,
+                                  dest_rank,
+                                  detail::hola_mpi_isend_tag,
+                                  comm,
+                                  &request);
+        if(mpi_error != MPI_SUCCESS)
+        {
+            delete n_packed;
+            ASCENT_ERROR("hola_mpi: MPI_Isend to rank " << dest_rank
+                         << " failed with error " << mpi_error);
+        }
+
+        detail::s_pending_sends.requests.push_back(request);
+        detail::s_pending_sends.buffers.push_back(n_packed);
+    }
+}
+
+//-----------------------------------------------------------------------------
+void
+hola_mpi_wait()
+{
+    detail::HolaMPIPendingSends &pending = detail::s_pending_sends;
+
+    if(!pending.requests.empty())
+    {
+        MPI_Waitall((int) pending.requests.size(),
+                    &pending.requests[0],
+                    MPI_STATUSES_IGNORE);
+    }
+
+    for(size_t i = 0; i < pending.buffers.size(); i++)
+    {
+        delete pending.buffers[i];
+    }
+
+    pending.requests.clear();
+    pending.buffers.clear();
+}
+
+//-----------------------------------------------------------------------------
+void
+hola_mpi_irecv(MPI_Comm comm,
+               int dest_idx,
+               const conduit::Node &comm_map,
+               conduit::Node &data)
+{
+    const int32 *src_counts  = comm_map["src_counts"].value();
+    const int32 *src_offsets = comm_map["src_offsets"].value();
+    const int32 *src_to_world = comm_map["src_to_world"].value();
+
+    const int32 *dest_counts  = comm_map["dest_counts"].value();
+    const int32 *dest_offsets = comm_map["dest_offsets"].value();
+
+    const int num_doms = dest_counts[dest_idx];
+    std::vector<std::vector<char> > buffers(num_doms);
+    std::vector<int> src_ranks(num_doms);
+    std::vector<MPI_Request> requests(num_doms);
+
+    // messages from the same rank arrive in order. a matched probe
+    // takes its message out of matching, so the next probe on the same
+    // rank sees the next message and all receives can be posted before
+    // waiting on any of them
+    int src_idx = 0;
+    for(int d = 0; d < num_doms; d++)
+    {
+        int i = dest_offsets[dest_idx] + d;
+        // find  i's src
+        while( i >= src_offsets[src_idx] + src_counts[src_idx])
+        {
+            src_idx++;
+        }
+
+        src_ranks[d] = src_to_world[(int32)src_idx];
+
+        MPI_Message message;
+        MPI_Status status;
+        MPI_Mprobe(src_ranks[d],
+                   detail::hola_mpi_isend_tag,
+                   comm,
+                   &message,
+                   &status);
+        int num_bytes = 0;
+        MPI_Get_count(&status, MPI_BYTE, &num_bytes);
+        buffers[d].resize(num_bytes);
+
+        MPI_Imrecv(buffers[d].data(),
+                   num_bytes,
+                   MPI_BYTE,
+                   &message,
+                   &requests[d]);
+    }
+
+    MPI_Waitall(num_doms, requests.data(), MPI_STATUSES_IGNORE);
+
+    for(int d = 0; d < num_doms; d++)
+    {
+        int i = dest_offsets[dest_idx] + d;
+        detail::hola_mpi_unpack(buffers[d], i, src_ranks[d], data.append());
+    }
+}
+
 //-----------------------------------------------------------------------------
 void
 hola_mpi(const conduit::Node &options,
@@ -361,21 +986,44 @@ hola_mpi(const conduit::Node &options,
 
     Node comm_map;
 
-    hola_mpi_comm_map(*data_ptr,
-                      comm,
-                      world_to_src,
-                      world_to_dest,
-                      comm_map);
+    bool balance = options.has_child("balance") &&
+                   options["balance"].as_string() == "true";
+
+    if(balance)
+    {
+        float64 threshold = 1.1;
+        if(options.has_child("balance_threshold"))
+        {
+            threshold = options["balance_threshold"].to_float64();
+        }
+
+        hola_mpi_balanced_comm_map(*data_ptr,
+                                   comm,
+                                   world_to_src,
+                                   world_to_dest,
+                                   threshold,
+                                   comm_map);
+    }
+    else
+    {
+        hola_mpi_comm_map(*data_ptr,
+                          comm,
+                          world_to_src,
+                          world_to_dest,
+                          comm_map);
+    }
 
+    // sources return once their sends are posted, the packed
+    // messages are released by the next publish (hola_mpi_wait)
     if(is_src_rank )
     {
         int src_idx = world_to_src[rank];
-        hola_mpi_send(*data_ptr,comm,src_idx,comm_map);
+        hola_mpi_isend(*data_ptr,comm,src_idx,comm_map);
     }
     else
     {
         int dest_idx = world_to_dest[rank];
-        hola_mpi_recv(comm,dest_idx,comm_map,*data_ptr);
+        hola_mpi_irecv(comm,dest_idx,comm_map,*data_ptr);
     }
 }
 
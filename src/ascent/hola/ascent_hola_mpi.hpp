@@ -79,6 +79,21 @@ void ASCENT_API hola_mpi_comm_map(const conduit::Node &data,
                                   const conduit::int32_array &world_to_dest,
                                   conduit::Node &res);
 
+/// Like hola_mpi_comm_map, but assigns contiguous ranges of domains
+/// to destination ranks balancing their cell and byte counts.
+/// The mapping is reused across calls while the source domain counts
+/// are unchanged and its imbalance (max over average dest load)
+/// stays below threshold.
+void ASCENT_API hola_mpi_balanced_comm_map(const conduit::Node &data,
+                                           MPI_Comm comm,
+                                           const conduit::int32_array &world_to_src,
+                                           const conduit::int32_array &world_to_dest,
+                                           conduit::float64 threshold,
+                                           conduit::Node &res);
+
+/// balance achieved by the last hola_mpi_balanced_comm_map call
+void ASCENT_API hola_mpi_info(conduit::Node &info);
+
 /// executes a send
 void ASCENT_API hola_mpi_send(const conduit::Node &data,
                               MPI_Comm comm,
@@ -91,6 +106,24 @@ void ASCENT_API hola_mpi_recv(MPI_Comm comm,
                               const conduit::Node &comm_map,
                               conduit::Node &data);
 
+/// posts non-blocking sends for all domains and returns.
+/// schemas are only sent when they change between calls.
+/// the packed messages are kept until hola_mpi_wait()
+void ASCENT_API hola_mpi_isend(const conduit::Node &data,
+                               MPI_Comm comm,
+                               int src_idx,
+                               const conduit::Node &comm_map);
+
+/// completes outstanding sends from hola_mpi_isend and
+/// releases their buffers
+void ASCENT_API hola_mpi_wait();
+
+/// receives domains posted with hola_mpi_isend
+void ASCENT_API hola_mpi_irecv(MPI_Comm comm,
+                               int dest_idx,
+                               const conduit::Node &comm_map,
+                               conduit::Node &data);
+
 };
 //-----------------------------------------------------------------------------
 // -- end ascent:: --
@@ -47,4 +47,5 @@
 # Purpose: Main init for the ascent module.
 ###############################################################################
 from .ascent import *
+from .mesh_views import mesh_views, domain_views
 
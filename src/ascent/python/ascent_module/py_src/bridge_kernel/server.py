@@ -56,24 +56,30 @@ def jupyter_extract():
           server_ascent = ascent.Ascent()
 
         ascent_opts["actions_file"] = ""
+        # keep rendered pngs in memory, so we don't read them back from disk
+        ascent_opts["image_channel/enabled"] = "true"
         server_ascent.open(ascent_opts)
 
         global_dict["server_ascent"] = server_ascent
 
     global_dict["server_ascent"].publish(ascent_extract.ascent_data())
 
+    def image_bytes(img):
+        # png encoded by the renderer, if the image channel provided it
+        if img.has_child("png"):
+            return img["png"].tobytes()
+        with open(img["image_name"], 'rb') as f:
+            return f.read()
+
     def display_images(info):
         nonlocal server
         for img in info["images"].children():
-            with open(img.node()["image_name"], 'rb') as f:
-                img_content = f.read()
-                server._write_bytes_image(img_content, "png")
+            server._write_bytes_image(image_bytes(img.node()), "png")
 
     def get_encoded_images(info):
         images = []
         for img in info["images"].children():
-            with open(img.node()["image_name"], 'rb') as f:
-                images.append(encodebytes(f.read()).decode('utf-8'))
+            images.append(encodebytes(image_bytes(img.node())).decode('utf-8'))
         return images
 
     def run_transformation(transformation, info, *args, **kwargs):
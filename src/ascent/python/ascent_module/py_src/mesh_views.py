@@ -0,0 +1,119 @@
+###############################################################################
+# Copyright (c) 2015-2019, Lawrence Livermore National Security, LLC.
+#
+# Produced at the Lawrence Livermore National Laboratory
+#
+# LLNL-CODE-716457
+#
+# All rights reserved.
+#
+# This file is part of Ascent.
+#
+# For details, see: http://ascent.readthedocs.io/.
+#
+# Please also read ascent/LICENSE
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+#
+# * Redistributions of source code must retain the above copyright notice,
+#   this list of conditions and the disclaimer below.
+#
+# * Redistributions in binary form must reproduce the above copyright notice,
+#   this list of conditions and the disclaimer (as noted below) in the
+#   documentation and/or other materials provided with the distribution.
+#
+# * Neither the name of the LLNS/LLNL nor the names of its contributors may
+#   be used to endorse or promote products derived from this software without
+#   specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+# AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+# ARE DISCLAIMED. IN NO EVENT SHALL LAWRENCE LIVERMORE NATIONAL SECURITY,
+# LLC, THE U.S. DEPARTMENT OF ENERGY OR CONTRIBUTORS BE LIABLE FOR ANY
+# DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+# DAMAGES  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+# OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+# HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+# STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+# IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+# POSSIBILITY OF SUCH DAMAGE.
+#
+###############################################################################
+###############################################################################
+# file: mesh_views.py
+# Purpose: Read-only numpy views of the blueprint mesh arrays passed to
+#          python extracts.
+#
+#  The arrays reference the memory of the published data (or of the vtk-h
+#  pipeline output the extract is connected to), nothing is copied. The
+#  views are only valid during the execute that provided them.
+#
+###############################################################################
+
+import numpy as np
+
+
+def _read_only(val):
+    # a new array object over the same memory, so we don't change the
+    # flags of arrays other code may hold
+    if isinstance(val, np.ndarray):
+        res = val.view()
+        res.flags.writeable = False
+        return res
+    return None
+
+
+def _array_views(node):
+    # leaves become arrays, objects (mcarrays, elements, ...) become
+    # dicts. leaves that aren't arrays (strings, scalars) are skipped
+    if node.number_of_children() == 0:
+        return _read_only(node.value())
+    res = {}
+    names = node.child_names()
+    for i in range(node.number_of_children()):
+        v = _array_views(node.child(i))
+        if v is not None and not (isinstance(v, dict) and len(v) == 0):
+            res[names[i]] = v
+    return res
+
+
+def _named_views(node, path, sub_path):
+    res = {}
+    if not node.has_path(path):
+        return res
+    n_items = node.fetch(path)
+    names = n_items.child_names()
+    for i in range(n_items.number_of_children()):
+        n_item = n_items.child(i)
+        if n_item.has_path(sub_path):
+            res[names[i]] = _array_views(n_item.fetch(sub_path))
+    return res
+
+
+def domain_views(domain):
+    """
+    Returns a dict with the read-only numpy views of a blueprint domain:
+      coordsets[name]  -> coordinate arrays by axis
+      topologies[name] -> connectivity arrays (connectivity, offsets, ...)
+      fields[name]     -> values, or values by component
+    Uniform coordsets and structured topologies have no arrays and are
+    omitted.
+    """
+    res = {}
+    res["coordsets"]  = _named_views(domain, "coordsets", "values")
+    res["topologies"] = _named_views(domain, "topologies", "elements")
+    res["fields"]     = _named_views(domain, "fields", "values")
+    return res
+
+
+def mesh_views(mesh):
+    """
+    Returns a list with the domain_views() of each domain of a blueprint
+    mesh, for example ascent_data() in a python extract.
+    """
+    if mesh.has_path("coordsets"):
+        return [domain_views(mesh)]
+    return [domain_views(mesh.child(i))
+            for i in range(mesh.number_of_children())]
@@ -0,0 +1,673 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2015-2019, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-716457
+//
+// All rights reserved.
+//
+// This file is part of Ascent.
+//
+// For details, see: http://ascent.readthedocs.io/.
+//
+// Please also read ascent/LICENSE
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the disclaimer below.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the disclaimer (as noted below) in the
+//   documentation and/or other materials provided with the distribution.
+//
+// * Neither the name of the LLNS/LLNL nor the names of its contributors may
+//   be used to endorse or promote products derived from this software without
+//   specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL LAWRENCE LIVERMORE NATIONAL SECURITY,
+// LLC, THE U.S. DEPARTMENT OF ENERGY OR CONTRIBUTORS BE LIABLE FOR ANY
+// DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//-----------------------------------------------------------------------------
+///
+/// file: ascent_action_scheduler.cpp
+///
+//-----------------------------------------------------------------------------
+
+#include "ascent_action_scheduler.hpp"
+
+// standard lib includes
+#include <algorithm>
+
+#include <ascent_logging.hpp>
+#include <flow_trace.hpp>
+#include <flow_workspace.hpp>
+
+// mpi related includes
+#ifdef ASCENT_MPI_ENABLED
+#include <mpi.h>
+#endif
+
+using namespace conduit;
+
+//-----------------------------------------------------------------------------
+// -- begin ascent:: --
+//-----------------------------------------------------------------------------
+namespace ascent
+{
+
+//-----------------------------------------------------------------------------
+// -- begin ascent::detail --
+//-----------------------------------------------------------------------------
+namespace detail
+{
+
+//-----------------------------------------------------------------------------
+struct ScheduleCandidate
+{
+    std::string key;
+    std::string section;
+    std::string name;
+    int         priority;
+    int         min_frequency;
+    double      cost;
+    int         last_run;
+};
+
+//-----------------------------------------------------------------------------
+// pipelines used by an action and the pipelines they read from
+void
+collect_pipelines(const std::string &key,
+                  const Node &pipeline_inputs,
+                  std::set<std::string> &pipelines)
+{
+    if(!pipeline_inputs.has_path(key))
+    {
+        return;
+    }
+
+    NodeConstIterator itr = pipeline_inputs[key].children();
+    while(itr.has_next())
+    {
+        const std::string pipeline = itr.next().as_string();
+        if(pipelines.insert(pipeline).second)
+        {
+            collect_pipelines("pipelines/" + pipeline,
+                              pipeline_inputs,
+                              pipelines);
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+int
+schedule_param(const Node &action, const std::string &name, int value)
+{
+    const std::string path = "schedule/" + name;
+    if(action.has_path(path))
+    {
+        if(!action[path].dtype().is_number())
+        {
+            ASCENT_ERROR("'" << path << "' must be a number");
+        }
+        value = action[path].to_int32();
+    }
+    return value;
+}
+
+//-----------------------------------------------------------------------------
+};
+//-----------------------------------------------------------------------------
+// -- end ascent::detail --
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+ActionScheduler::ActionState::ActionState()
+: m_cost(-1.0),
+  m_last_run(-1)
+{}
+
+//-----------------------------------------------------------------------------
+ActionScheduler::ActionScheduler()
+: m_enabled(false),
+  m_budget(-1.0),
+  m_budget_fraction(-1.0),
+  m_owns_tracer(false),
+  m_execute_count(0),
+  m_execute_start(0.0),
+  m_execute_end(-1.0)
+{}
+
+//-----------------------------------------------------------------------------
+ActionScheduler::~ActionScheduler()
+{
+    Reset();
+}
+
+//-----------------------------------------------------------------------------
+void
+ActionScheduler::Configure(const Node &options)
+{
+    // flow::Tracer is process wide state, reconfiguring keeps a tracer
+    // we enabled instead of toggling it
+    const bool owns_tracer = m_owns_tracer;
+    m_owns_tracer = false;
+    Reset();
+    m_owns_tracer = owns_tracer;
+
+    if(options.has_child("budget"))
+    {
+        m_budget = options["budget"].to_float64();
+        if(m_budget <= 0.0)
+        {
+            ASCENT_ERROR("'schedule/budget' must be greater than zero,"
+                         " given " << m_budget);
+        }
+        m_enabled = true;
+    }
+
+    if(options.has_child("budget_fraction"))
+    {
+        m_budget_fraction = options["budget_fraction"].to_float64();
+        if(m_budget_fraction <= 0.0)
+        {
+            ASCENT_ERROR("'schedule/budget_fraction' must be greater than"
+                         " zero, given " << m_budget_fraction);
+        }
+        m_enabled = true;
+    }
+
+    // the costs come from the filter events. we only turn tracing on
+    // if no one else did, and only turn off and clear what we turned on
+    if(m_enabled && !m_owns_tracer && !flow::Tracer::enabled())
+    {
+        flow::Tracer::enable(true);
+        m_owns_tracer = true;
+    }
+    else if(!m_enabled)
+    {
+        ReleaseTracer();
+    }
+}
+
+//-----------------------------------------------------------------------------
+bool
+ActionScheduler::Enabled() const
+{
+    return m_enabled;
+}
+
+//-----------------------------------------------------------------------------
+void
+ActionScheduler::Reset()
+{
+    ReleaseTracer();
+
+    m_enabled = false;
+    m_budget = -1.0;
+    m_budget_fraction = -1.0;
+    m_execute_count = 0;
+    m_execute_start = 0.0;
+    m_execute_end = -1.0;
+    m_states.clear();
+    m_action_filters.clear();
+    m_shared_filters.clear();
+    m_skipped_filters.clear();
+    m_scheduled.clear();
+    m_pipeline_inputs.reset();
+    m_measured.clear();
+}
+
+//-----------------------------------------------------------------------------
+void
+ActionScheduler::ReleaseTracer()
+{
+    if(m_owns_tracer)
+    {
+        flow::Tracer::enable(false);
+        flow::Tracer::clear();
+        m_owns_tracer = false;
+    }
+}
+
+//-----------------------------------------------------------------------------
+void
+ActionScheduler::SetActionFilters(const std::string &action,
+                                  const std::set<std::string> &filters)
+{
+    m_action_filters[action] = filters;
+}
+
+//-----------------------------------------------------------------------------
+void
+ActionScheduler::ClearFilters()
+{
+    m_action_filters.clear();
+    m_shared_filters.clear();
+    m_skipped_filters.clear();
+}
+
+//-----------------------------------------------------------------------------
+const std::set<std::string> &
+ActionScheduler::SkippedFilters() const
+{
+    return m_skipped_filters;
+}
+
+//-----------------------------------------------------------------------------
+void
+ActionScheduler::AddSharedFilters(const std::set<std::string> &filters)
+{
+    m_shared_filters.insert(filters.begin(), filters.end());
+}
+
+//-----------------------------------------------------------------------------
+void
+ActionScheduler::ReduceMeasurements(double &sim_time)
+{
+    // all ranks ran the same actions, so the values line up
+    const int num_scheduled = (int) m_scheduled.size();
+    std::vector<double> values(num_scheduled + 1, 0.0);
+    values[0] = sim_time;
+    for(int i = 0; i < num_scheduled; ++i)
+    {
+        values[i + 1] = m_measured[m_scheduled[i]];
+    }
+
+#ifdef ASCENT_MPI_ENABLED
+    MPI_Comm mpi_comm = MPI_Comm_f2c(flow::Workspace::default_mpi_comm());
+    MPI_Allreduce(MPI_IN_PLACE,
+                  &values[0],
+                  (int) values.size(),
+                  MPI_DOUBLE,
+                  MPI_MAX,
+                  mpi_comm);
+#endif
+
+    sim_time = values[0];
+    for(int i = 0; i < num_scheduled; ++i)
+    {
+        ActionState &state = m_states[m_scheduled[i]];
+        const double measured = values[i + 1];
+        if(state.m_cost < 0.0)
+        {
+            state.m_cost = measured;
+        }
+        else
+        {
+            state.m_cost = 0.5 * state.m_cost + 0.5 * measured;
+        }
+    }
+
+    m_measured.clear();
+}
+
+//-----------------------------------------------------------------------------
+void
+ActionScheduler::Schedule(const Node &actions,
+                          Node &info)
+{
+    info.reset();
+
+    const int execute = ++m_execute_count;
+
+    // time the simulation spent since the last execute
+    double sim_time = -1.0;
+    if(m_execute_end >= 0.0)
+    {
+        sim_time = (flow::Tracer::now() - m_execute_end) / 1e6;
+    }
+
+    ReduceMeasurements(sim_time);
+
+    // a negative budget runs everything
+    double budget = m_budget;
+    if(m_budget_fraction > 0.0 && sim_time >= 0.0)
+    {
+        const double sim_budget = m_budget_fraction * sim_time;
+        budget = budget < 0.0 ? sim_budget : std::min(budget, sim_budget);
+    }
+
+    //
+    // collect the scenes and extracts, and the pipelines they read
+    //
+    m_pipeline_inputs.reset();
+    std::vector<detail::ScheduleCandidate> candidates;
+    std::vector<std::string> always_run;
+    const int num_actions = actions.number_of_children();
+    for(int i = 0; i < num_actions; ++i)
+    {
+        const Node &action = actions.child(i);
+        if(!action.has_child("action"))
+        {
+            continue;
+        }
+
+        const std::string action_name = action["action"].as_string();
+        std::string section;
+        if(action_name == "add_scenes")
+        {
+            section = "scenes";
+        }
+        else if(action_name == "add_extracts")
+        {
+            section = "extracts";
+        }
+        else if(action_name == "add_pipelines")
+        {
+            section = "pipelines";
+        }
+        else if(action_name == "add_queries")
+        {
+            section = "queries";
+        }
+        else if(action_name == "add_triggers")
+        {
+            section = "triggers";
+        }
+
+        if(section == "" || !action.has_child(section))
+        {
+            continue;
+        }
+
+        const Node &items = action[section];
+        std::vector<std::string> names = items.child_names();
+        for(size_t n = 0; n < names.size(); ++n)
+        {
+            const Node &item = items[names[n]];
+            const std::string key = section + "/" + names[n];
+
+            if(item.has_child("pipeline"))
+            {
+                m_pipeline_inputs[key].append() = item["pipeline"].as_string();
+            }
+
+            // queries and triggers always run, and so do the
+            // pipelines they read
+            if(section == "queries" || section == "triggers")
+            {
+                if(item.has_path("params/pipeline"))
+                {
+                    m_pipeline_inputs[key].append() = item["params/pipeline"].as_string();
+                }
+                always_run.push_back(key);
+                continue;
+            }
+
+            if(section == "scenes" && item.has_child("plots"))
+            {
+                NodeConstIterator plots = item["plots"].children();
+                while(plots.has_next())
+                {
+                    const Node &plot = plots.next();
+                    if(plot.has_child("pipeline"))
+                    {
+                        m_pipeline_inputs[key].append() = plot["pipeline"].as_string();
+                    }
+                }
+            }
+
+            if(section == "pipelines")
+            {
+                continue;
+            }
+
+            detail::ScheduleCandidate candidate;
+            candidate.key           = key;
+            candidate.section       = section;
+            candidate.name          = names[n];
+            candidate.priority      = detail::schedule_param(item, "priority", 0);
+            candidate.min_frequency = detail::schedule_param(item, "min_frequency", 0);
+            candidate.cost          = m_states[key].m_cost;
+            candidate.last_run      = m_states[key].m_last_run;
+            candidates.push_back(candidate);
+        }
+    }
+
+    //
+    // required runs first: unmeasured actions and those that
+    // reached their min frequency, then by priority and staleness
+    //
+    std::set<std::string> run;
+    double estimated_cost = 0.0;
+    std::vector<detail::ScheduleCandidate> optional;
+    for(size_t i = 0; i < candidates.size(); ++i)
+    {
+        const detail::ScheduleCandidate &c = candidates[i];
+        const bool required = budget < 0.0 ||
+                              c.cost < 0.0 ||
+                              (c.min_frequency > 0 &&
+                               (c.last_run < 0 ||
+                                execute - c.last_run >= c.min_frequency));
+        if(required)
+        {
+            run.insert(c.key);
+            estimated_cost += std::max(c.cost, 0.0);
+        }
+        else
+        {
+            optional.push_back(c);
+        }
+    }
+
+    std::sort(optional.begin(),
+              optional.end(),
+              [](const detail::ScheduleCandidate &a,
+                 const detail::ScheduleCandidate &b)
+              {
+                  if(a.priority != b.priority)
+                  {
+                      return a.priority > b.priority;
+                  }
+                  if(a.last_run != b.last_run)
+                  {
+                      return a.last_run < b.last_run;
+                  }
+                  return a.key < b.key;
+              });
+
+    for(size_t i = 0; i < optional.size(); ++i)
+    {
+        if(estimated_cost + optional[i].cost <= budget)
+        {
+            run.insert(optional[i].key);
+            estimated_cost += optional[i].cost;
+        }
+    }
+
+    //
+    // pipelines that only skipped actions read are skipped as well
+    //
+    std::set<std::string> used_pipelines;
+    std::set<std::string> run_pipelines;
+    for(size_t i = 0; i < always_run.size(); ++i)
+    {
+        detail::collect_pipelines(always_run[i], m_pipeline_inputs, used_pipelines);
+        detail::collect_pipelines(always_run[i], m_pipeline_inputs, run_pipelines);
+    }
+
+    for(size_t i = 0; i < candidates.size(); ++i)
+    {
+        detail::collect_pipelines(candidates[i].key, m_pipeline_inputs, used_pipelines);
+        if(run.count(candidates[i].key) > 0)
+        {
+            detail::collect_pipelines(candidates[i].key, m_pipeline_inputs, run_pipelines);
+        }
+    }
+
+    //
+    // the filters the workspace leaves out, the graph is kept as is.
+    // the workspace still runs any of them that a filter it runs reads
+    //
+    std::vector<std::string> skipped_keys;
+    m_scheduled.clear();
+    for(size_t i = 0; i < candidates.size(); ++i)
+    {
+        if(run.count(candidates[i].key) > 0)
+        {
+            m_scheduled.push_back(candidates[i].key);
+        }
+        else
+        {
+            skipped_keys.push_back(candidates[i].key);
+        }
+    }
+
+    std::set<std::string>::const_iterator p_itr;
+    for(p_itr = used_pipelines.begin(); p_itr != used_pipelines.end(); ++p_itr)
+    {
+        if(run_pipelines.count(*p_itr) == 0)
+        {
+            skipped_keys.push_back("pipelines/" + *p_itr);
+        }
+    }
+
+    m_skipped_filters.clear();
+    for(size_t i = 0; i < skipped_keys.size(); ++i)
+    {
+        std::map<std::string, std::set<std::string>>::const_iterator a_itr
+          = m_action_filters.find(skipped_keys[i]);
+        if(a_itr == m_action_filters.end())
+        {
+            continue;
+        }
+
+        // shared filters can be listed too, the workspace still runs
+        // them for the actions that need them
+        m_skipped_filters.insert(a_itr->second.begin(), a_itr->second.end());
+    }
+
+    for(size_t i = 0; i < candidates.size(); ++i)
+    {
+        const detail::ScheduleCandidate &c = candidates[i];
+        Node &entry = info[c.key];
+        entry["priority"] = c.priority;
+        entry["min_frequency"] = c.min_frequency;
+        entry["cost"] = c.cost;
+        entry["status"] = run.count(c.key) > 0 ? "run" : "skipped";
+        if(run.count(c.key) > 0)
+        {
+            m_states[c.key].m_last_run = execute;
+        }
+    }
+
+    Node &summary = info["summary"];
+    summary["execute"] = execute;
+    summary["budget"] = budget;
+    summary["simulation_time"] = sim_time;
+    summary["estimated_cost"] = estimated_cost;
+
+    m_execute_start = flow::Tracer::now();
+}
+
+//-----------------------------------------------------------------------------
+double
+ActionScheduler::ActionCost(const std::string &action,
+                            const std::map<std::string, double> &filter_costs,
+                            const Node &pipeline_inputs) const
+{
+    double cost = 0.0;
+
+    std::set<std::string> keys;
+    keys.insert(action);
+    std::set<std::string> pipelines;
+    detail::collect_pipelines(action, pipeline_inputs, pipelines);
+    std::set<std::string>::const_iterator p_itr;
+    for(p_itr = pipelines.begin(); p_itr != pipelines.end(); ++p_itr)
+    {
+        keys.insert("pipelines/" + *p_itr);
+    }
+
+    std::set<std::string>::const_iterator k_itr;
+    for(k_itr = keys.begin(); k_itr != keys.end(); ++k_itr)
+    {
+        std::map<std::string, std::set<std::string>>::const_iterator a_itr
+          = m_action_filters.find(*k_itr);
+        if(a_itr == m_action_filters.end())
+        {
+            continue;
+        }
+
+        std::set<std::string>::const_iterator f_itr;
+        for(f_itr = a_itr->second.begin(); f_itr != a_itr->second.end(); ++f_itr)
+        {
+            if(m_shared_filters.count(*f_itr) > 0)
+            {
+                continue;
+            }
+
+            std::map<std::string, double>::const_iterator c_itr
+              = filter_costs.find(*f_itr);
+            if(c_itr != filter_costs.end())
+            {
+                cost += c_itr->second;
+            }
+        }
+    }
+
+    return cost;
+}
+
+//-----------------------------------------------------------------------------
+void
+ActionScheduler::Update()
+{
+    // filter execution times of this execute, keyed by filter name
+    Node events;
+    flow::Tracer::events(events);
+
+    std::map<std::string, double> filter_costs;
+    NodeConstIterator itr = events.children();
+    while(itr.has_next())
+    {
+        const Node &event = itr.next();
+        // filters served by the result cache ("flow,cached") did not
+        // execute, they are not part of the measured cost
+        if(event["ts"].to_float64() < m_execute_start ||
+           event["cat"].as_string() != "flow")
+        {
+            continue;
+        }
+
+        const std::string node = event["node"].as_string();
+        if(node != "")
+        {
+            filter_costs[node] += event["dur"].to_float64() / 1e6;
+        }
+    }
+
+    for(size_t i = 0; i < m_scheduled.size(); ++i)
+    {
+        m_measured[m_scheduled[i]] = ActionCost(m_scheduled[i],
+                                                filter_costs,
+                                                m_pipeline_inputs);
+    }
+
+    if(m_owns_tracer)
+    {
+        flow::Tracer::clear();
+    }
+
+    m_execute_end = flow::Tracer::now();
+}
+
+//-----------------------------------------------------------------------------
+};
+//-----------------------------------------------------------------------------
+// -- end ascent:: --
+//-----------------------------------------------------------------------------
@@ -0,0 +1,170 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2015-2019, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-716457
+//
+// All rights reserved.
+//
+// This file is part of Ascent.
+//
+// For details, see: http://ascent.readthedocs.io/.
+//
+// Please also read ascent/LICENSE
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the disclaimer below.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the disclaimer (as noted below) in the
+//   documentation and/or other materials provided with the distribution.
+//
+// * Neither the name of the LLNS/LLNL nor the names of its contributors may
+//   be used to endorse or promote products derived from this software without
+//   specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL LAWRENCE LIVERMORE NATIONAL SECURITY,
+// LLC, THE U.S. DEPARTMENT OF ENERGY OR CONTRIBUTORS BE LIABLE FOR ANY
+// DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//-----------------------------------------------------------------------------
+///
+/// file: ascent_action_scheduler.hpp
+///
+//-----------------------------------------------------------------------------
+
+#ifndef ASCENT_ACTION_SCHEDULER_HPP
+#define ASCENT_ACTION_SCHEDULER_HPP
+
+#include <conduit.hpp>
+
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+//-----------------------------------------------------------------------------
+// -- begin ascent:: --
+//-----------------------------------------------------------------------------
+namespace ascent
+{
+
+//-----------------------------------------------------------------------------
+// Decides which scenes and extracts run each time the actions are executed,
+// so the visualization cost of a cycle stays within a budget.
+//
+// The budget is a wall time per execute ("budget", seconds), a fraction of
+// the time the simulation spent between executes ("budget_fraction"), or the
+// smaller of the two. Scenes and extracts can declare
+//
+//   schedule/priority       higher priorities are scheduled first (0)
+//   schedule/min_frequency  run at least once every N executes (never)
+//
+// The graph is built from all the actions and the filters of the actions
+// that don't run are skipped, so changing the scheduled set keeps the
+// graph and the result cache.
+//
+// Costs are measured from the flow::Tracer events of the filters each
+// action added to the graph, and the pipelines it uses. Costs and the
+// simulation time are reduced (max) over all ranks, so every rank makes
+// the same decisions.
+//-----------------------------------------------------------------------------
+class ActionScheduler
+{
+public:
+    ActionScheduler();
+    ~ActionScheduler();
+
+    // options are the "schedule" options passed to the runtime
+    void Configure(const conduit::Node &options);
+    bool Enabled() const;
+    void Reset();
+
+    // decides which scenes and extracts fit in this execute's budget.
+    // The filters of the others (and of the pipelines only they use)
+    // are left out with SkippedFilters(). Queries, triggers and the
+    // pipelines they read always run. info describes the decisions.
+    void Schedule(const conduit::Node &actions,
+                  conduit::Node &info);
+
+    // filters the graph leaves out this execute, the graph itself is
+    // built from all the actions
+    const std::set<std::string> &SkippedFilters() const;
+
+    // filters the graph builder added for an action ("scenes/<name>",
+    // "extracts/<name>" or "pipelines/<name>"), or shared by all actions
+    void SetActionFilters(const std::string &action,
+                          const std::set<std::string> &filters);
+    void AddSharedFilters(const std::set<std::string> &filters);
+    // forgets the filters, call when the graph is rebuilt
+    void ClearFilters();
+
+    // measures the cost of the actions that ran, call after the
+    // workspace executed the scheduled actions
+    void Update();
+
+private:
+    struct ActionState
+    {
+        ActionState();
+        // moving average of the measured cost (seconds), < 0 if unknown
+        double m_cost;
+        // execute count of the last run, < 0 if never
+        int    m_last_run;
+    };
+
+    double ActionCost(const std::string &action,
+                      const std::map<std::string, double> &filter_costs,
+                      const conduit::Node &pipeline_inputs) const;
+    void   ReduceMeasurements(double &sim_time);
+    // disables and clears flow::Tracer if the scheduler enabled it
+    void   ReleaseTracer();
+
+    bool                                         m_enabled;
+    double                                       m_budget;
+    double                                       m_budget_fraction;
+    // true if the scheduler enabled flow::Tracer, and owns its events
+    bool                                         m_owns_tracer;
+
+    int                                          m_execute_count;
+    double                                       m_execute_start;
+    double                                       m_execute_end;
+
+    std::map<std::string, ActionState>           m_states;
+    std::map<std::string, std::set<std::string>> m_action_filters;
+    std::set<std::string>                        m_shared_filters;
+    std::set<std::string>                        m_skipped_filters;
+
+    // actions that ran in the last execute, the pipelines they used
+    // and their local costs waiting to be reduced
+    std::vector<std::string>                     m_scheduled;
+    conduit::Node                                m_pipeline_inputs;
+    std::map<std::string, double>                m_measured;
+};
+
+//-----------------------------------------------------------------------------
+};
+//-----------------------------------------------------------------------------
+// -- end ascent:: --
+//-----------------------------------------------------------------------------
+
+#endif
+//-----------------------------------------------------------------------------
+// -- end header ifdef guard
+//-----------------------------------------------------------------------------
+
@@ -56,6 +56,8 @@
 #include "expressions/ascent_expressions_parser.hpp"
 #include "expressions/ascent_expressions_tokens.hpp"
 
+#include <mutex>
+
 //-----------------------------------------------------------------------------
 // -- begin ascent:: --
 //-----------------------------------------------------------------------------
@@ -75,9 +77,25 @@ namespace expressions
 {
 
 conduit::Node ExpressionEval::m_cache;
+std::map<std::string, ExpressionEval::CompiledExpression> ExpressionEval::m_compiled;
+conduit::Node ExpressionEval::m_compiled_info;
+conduit::Node ExpressionEval::m_reductions;
+bool ExpressionEval::m_share_reductions = false;
 conduit::Node g_function_table;
 conduit::Node g_object_table;
 
+namespace detail
+{
+// guards the static caches, expressions may be evaluated by filters
+// that run concurrently (flow/max_threads)
+std::recursive_mutex &
+eval_mutex()
+{
+  static std::recursive_mutex mutex;
+  return mutex;
+}
+} // namespace detail
+
 void register_builtin()
 {
   flow::Workspace::register_filter_type<expressions::NullArg>();
@@ -117,8 +135,10 @@ void register_builtin()
   initialize_objects();
 }
 
-ExpressionEval::ExpressionEval(conduit::Node *data)
-  : m_data(data)
+ExpressionEval::ExpressionEval(conduit::Node *data,
+                               const std::string &data_key)
+  : m_data(data),
+    m_data_key(data_key)
 {
 }
 
@@ -462,21 +482,30 @@ initialize_objects()
   objects->save("objects.json", "json");
 }
 
-conduit::Node
-ExpressionEval::evaluate(const std::string expr, std::string expr_name)
+void
+ExpressionEval::bind_inputs(flow::Workspace &workspace,
+                            conduit::Node *data,
+                            conduit::Node *reductions,
+                            int *cycle)
 {
+  workspace.registry().add<conduit::Node>("dataset", data, -1);
+  workspace.registry().add<conduit::Node>("field_reductions", reductions, -1);
+  workspace.registry().add<conduit::Node>("cache", &m_cache, -1);
+  workspace.registry().add<conduit::Node>("function_table", &g_function_table, -1);
+  workspace.registry().add<conduit::Node>("object_table", &g_object_table, -1);
+  workspace.registry().add<int>("cycle", cycle, -1);
+}
 
-  if(expr_name == "")
-  {
-    expr_name = expr;
-  }
-
-  w.registry().add<conduit::Node>("dataset", m_data, -1);
-  w.registry().add<conduit::Node>("cache", &m_cache, -1);
-  w.registry().add<conduit::Node>("function_table", &g_function_table, -1);
-  w.registry().add<conduit::Node>("object_table", &g_object_table, -1);
-  int cycle = get_state_var(*m_data, "cycle").to_int32();
-  w.registry().add<int>("cycle", &cycle, -1);
+ExpressionEval::CompiledExpression
+ExpressionEval::compile(const std::string &expr)
+{
+  CompiledExpression compiled;
+  compiled.m_workspace = new flow::Workspace();
+  flow::Workspace &workspace = *compiled.m_workspace;
+  // building the graph only looks up the tables and identifier types
+  workspace.registry().add<conduit::Node>("cache", &m_cache, -1);
+  workspace.registry().add<conduit::Node>("function_table", &g_function_table, -1);
+  workspace.registry().add<conduit::Node>("object_table", &g_object_table, -1);
 
   try
   {
@@ -484,40 +513,184 @@ ExpressionEval::evaluate(const std::string expr, std::string expr_name)
   }
   catch(const char* msg)
   {
-    w.reset();
+    delete compiled.m_workspace;
     ASCENT_ERROR("Expression parsing error: "<<msg<<" in '"<<expr<<"'");
   }
 
   ASTExpression *expression = get_result();
 
-  conduit::Node root;
+  try
+  {
+    conduit::Node root = expression->build_graph(workspace);
+    compiled.m_result_filter = root["filter_name"].as_string();
+  }
+  catch(std::exception &e)
+  {
+    delete expression;
+    delete compiled.m_workspace;
+    ASCENT_ERROR("Error while executing expression '"<<expr<<"': "<<e.what());
+  }
+  delete expression;
+
+  // identifier types are resolved at build time from the cache
+  conduit::Node filters;
+  workspace.graph().filters(filters);
+  conduit::NodeConstIterator itr = filters.children();
+  while(itr.has_next())
+  {
+    const conduit::Node &filter = itr.next();
+    if(filter["type_name"].as_string() == "expr_identifier")
+    {
+      const std::string name = filter["params/value"].as_string();
+      const conduit::Node &entries = m_cache[name];
+      compiled.m_identifier_types[name] =
+        entries.child(entries.number_of_children() - 1)["type"];
+    }
+  }
+
+  workspace.registry().reset();
+  return compiled;
+}
+
+bool
+ExpressionEval::is_current(const CompiledExpression &compiled)
+{
+  conduit::NodeConstIterator itr = compiled.m_identifier_types.children();
+  while(itr.has_next())
+  {
+    const conduit::Node &type = itr.next();
+    const std::string name = itr.name();
+    if(!m_cache.has_child(name))
+    {
+      return false;
+    }
+    const conduit::Node &entries = m_cache[name];
+    const int num_entries = entries.number_of_children();
+    if(num_entries < 1 ||
+       entries.child(num_entries - 1)["type"].as_string() != type.as_string())
+    {
+      return false;
+    }
+  }
+  return true;
+}
 
-  //std::cout<<w.graph().to_dot()<<"\n";
+conduit::Node
+ExpressionEval::evaluate(const std::string expr, std::string expr_name)
+{
+  std::lock_guard<std::recursive_mutex> lock(detail::eval_mutex());
+
+  if(expr_name == "")
+  {
+    expr_name = expr;
+  }
+
+  if(!m_compiled_info.has_child("hits"))
+  {
+    m_compiled_info["hits"] = 0;
+    m_compiled_info["misses"] = 0;
+  }
+
+  std::map<std::string, CompiledExpression>::iterator entry = m_compiled.find(expr);
+  if(entry != m_compiled.end() && !is_current(entry->second))
+  {
+    // an identifier changed type, so the graph must be rebuilt
+    delete entry->second.m_workspace;
+    m_compiled.erase(entry);
+    entry = m_compiled.end();
+  }
+
+  if(entry == m_compiled.end())
+  {
+    m_compiled_info["misses"] = m_compiled_info["misses"].to_int64() + 1;
+    entry = m_compiled.insert(std::make_pair(expr, compile(expr))).first;
+  }
+  else
+  {
+    m_compiled_info["hits"] = m_compiled_info["hits"].to_int64() + 1;
+  }
+  m_compiled_info["entries"] = (conduit::int64) m_compiled.size();
+
+  flow::Workspace &workspace = *entry->second.m_workspace;
+  int cycle = get_state_var(*m_data, "cycle").to_int32();
+  // the reductions are only shared when the data can be identified
+  // consistently across ranks, since computing them is collective
+  conduit::Node local_reductions;
+  conduit::Node *reductions = &local_reductions;
+  if(!m_data_key.empty())
+  {
+    std::stringstream data_key;
+    data_key<<m_data_key<<"_"<<cycle;
+    reductions = &m_reductions.add_child(data_key.str());
+  }
+  bind_inputs(workspace, m_data, reductions, &cycle);
 
   try
   {
-    //expression->access();
-    root = expression->build_graph(w);
-    w.execute();
+    workspace.execute();
   }
   catch(std::exception &e)
   {
-    delete expression;
-    w.reset();
+    if(!m_share_reductions)
+    {
+      m_reductions.reset();
+    }
+    delete entry->second.m_workspace;
+    m_compiled.erase(entry);
     ASCENT_ERROR("Error while executing expression '"<<expr<<"': "<<e.what());
   }
-  conduit::Node *n_res = w.registry().fetch<conduit::Node>(root["filter_name"].as_string());
+
+  conduit::Node *n_res =
+    workspace.registry().fetch<conduit::Node>(entry->second.m_result_filter);
   conduit::Node return_val = *n_res;
-  delete expression;
 
   std::stringstream cache_entry;
   cache_entry<<expr_name<<"/"<<cycle;
   m_cache[cache_entry.str()] = *n_res;
 
-  w.reset();
+  workspace.registry().reset();
+  if(!m_share_reductions)
+  {
+    m_reductions.reset();
+  }
   return return_val;
 }
 
+const conduit::Node&
+ExpressionEval::get_compiled_info()
+{
+  return m_compiled_info;
+}
+
+void
+ExpressionEval::reset_compiled()
+{
+  std::lock_guard<std::recursive_mutex> lock(detail::eval_mutex());
+  std::map<std::string, CompiledExpression>::iterator itr;
+  for(itr = m_compiled.begin(); itr != m_compiled.end(); ++itr)
+  {
+    delete itr->second.m_workspace;
+  }
+  m_compiled.clear();
+  m_compiled_info.reset();
+}
+
+void
+ExpressionEval::begin_shared_reductions()
+{
+  std::lock_guard<std::recursive_mutex> lock(detail::eval_mutex());
+  m_reductions.reset();
+  m_share_reductions = true;
+}
+
+void
+ExpressionEval::end_shared_reductions()
+{
+  std::lock_guard<std::recursive_mutex> lock(detail::eval_mutex());
+  m_reductions.reset();
+  m_share_reductions = false;
+}
+
 const conduit::Node&
 ExpressionEval::get_cache()
 {
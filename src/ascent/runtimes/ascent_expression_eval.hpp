@@ -53,6 +53,9 @@
 #define ASCENT_EXPRESSION_EVAL_HPP
 #include <conduit.hpp>
 
+#include <map>
+#include <string>
+
 #include "flow_workspace.hpp"
 //-----------------------------------------------------------------------------
 // -- begin ascent:: --
@@ -78,12 +81,50 @@ class ExpressionEval
 {
 protected:
   conduit::Node *m_data;
-  flow::Workspace w;
+  // identifies m_data for shared reductions, must match on all ranks
+  std::string    m_data_key;
   static conduit::Node m_cache;
+
+  // flow graphs built from previously evaluated expressions, keyed by
+  // expression text. Repeat evaluations only rebind the inputs and
+  // execute the stored graph.
+  struct CompiledExpression
+  {
+    flow::Workspace  *m_workspace;
+    std::string       m_result_filter;
+    // types of the identifiers the graph was built with
+    conduit::Node     m_identifier_types;
+  };
+  static std::map<std::string, CompiledExpression> m_compiled;
+  static conduit::Node m_compiled_info;
+
+  // fused field reductions (min, max, sum, avg) keyed by data key and
+  // field name, so sibling reductions on a field share a single pass
+  static conduit::Node m_reductions;
+  static bool m_share_reductions;
+
+  static CompiledExpression compile(const std::string &expr);
+  static bool is_current(const CompiledExpression &compiled);
+  static void bind_inputs(flow::Workspace &workspace,
+                          conduit::Node *data,
+                          conduit::Node *reductions,
+                          int *cycle);
 public:
-  ExpressionEval(conduit::Node *data);
+  // data_key names the data (e.g., the pipeline that produced it) so
+  // evaluations on the same data can share field reductions. It has to
+  // name the same data on all ranks. Without a key, reductions are not
+  // shared.
+  ExpressionEval(conduit::Node *data, const std::string &data_key = "");
 
   static const conduit::Node &get_cache();
+  // hits, misses and number of entries of the compiled expression cache
+  static const conduit::Node &get_compiled_info();
+  // releases all compiled expressions
+  static void reset_compiled();
+  // keeps field reductions across evaluations until end_shared_reductions.
+  // The data must not change in between.
+  static void begin_shared_reductions();
+  static void end_shared_reductions();
 
   conduit::Node evaluate(const std::string expr, std::string exp_name = "");
 };
@@ -53,6 +53,13 @@
 
 // standard lib includes
 #include <string.h>
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <iterator>
+#include <set>
+#include <vector>
+#include <sys/stat.h>
 
 //-----------------------------------------------------------------------------
 // thirdparty includes
@@ -66,15 +73,21 @@
 #include <mpi.h>
 // -- conduit relay mpi
 #include <conduit_relay_mpi.hpp>
+#include <ascent_hola_mpi.hpp>
 #endif
 
 #include <flow.hpp>
+#include <ascent_block_timer.hpp>
 #include <ascent_runtime_filters.hpp>
 #include <ascent_expression_eval.hpp>
+#include <ascent_runtime_relay_filters.hpp>
+#include <ascent_runtime_trigger_filters.hpp>
 
 #if defined(ASCENT_VTKM_ENABLED)
 #include <vtkh/vtkh.hpp>
 #include <vtkh/Error.hpp>
+#include <ascent_vtkh_data_adapter.hpp>
+#include <ascent_runtime_vtkh_filters.hpp>
 
 #ifdef VTKM_CUDA
 #include <vtkm/cont/cuda/ChooseCudaDevice.h>
@@ -112,6 +125,130 @@ class InfoHandler
 
 int InfoHandler::m_rank = 0;
 
+//-----------------------------------------------------------------------------
+// -- begin ascent::detail --
+//-----------------------------------------------------------------------------
+namespace detail
+{
+
+//-----------------------------------------------------------------------------
+// Describes the layout of a published tree: paths, dtypes and the
+// addresses of the (zero copied) leaf arrays. Array contents are not
+// included, so changes to data updated in place must be signaled using
+// state/cycle or state/dirty_fields.
+void
+fingerprint_tree(const conduit::Node &node,
+                 std::ostream &oss)
+{
+  const int num_children = node.number_of_children();
+  if(num_children == 0)
+  {
+    const conduit::DataType &dt = node.dtype();
+    oss << node.path() << " "
+        << dt.id() << " "
+        << dt.number_of_elements() << " "
+        << dt.offset() << " "
+        << dt.stride() << " "
+        << node.data_ptr() << "\n";
+    return;
+  }
+
+  for(int i = 0; i < num_children; ++i)
+  {
+    const conduit::Node &child = node.child(i);
+    if(child.name() == "state")
+    {
+      continue;
+    }
+    fingerprint_tree(child, oss);
+  }
+}
+
+//-----------------------------------------------------------------------------
+// names of the filters in the graph, used to find the filters an
+// action added
+std::set<std::string>
+graph_filter_names(flow::Graph &graph)
+{
+  std::set<std::string> names;
+  std::map<std::string, flow::Filter*>::iterator itr;
+  for(itr = graph.filters().begin(); itr != graph.filters().end(); ++itr)
+  {
+    names.insert(itr->first);
+  }
+  return names;
+}
+
+//-----------------------------------------------------------------------------
+std::set<std::string>
+added_filter_names(const std::set<std::string> &before,
+                   flow::Graph &graph)
+{
+  std::set<std::string> after = graph_filter_names(graph);
+  std::set<std::string> added;
+  std::set_difference(after.begin(), after.end(),
+                      before.begin(), before.end(),
+                      std::inserter(added, added.begin()));
+  return added;
+}
+
+//-----------------------------------------------------------------------------
+// names of the plot filters the scenes in actions create
+// (plot name + "_" + scene name)
+std::set<std::string>
+scene_plot_names(const conduit::Node &actions)
+{
+  std::set<std::string> names;
+  for(int a = 0; a < actions.number_of_children(); ++a)
+  {
+    const conduit::Node &action = actions.child(a);
+    if(!action.has_child("action") ||
+       action["action"].as_string() != "add_scenes" ||
+       !action.has_child("scenes"))
+    {
+      continue;
+    }
+
+    const conduit::Node &scenes = action["scenes"];
+    for(int s = 0; s < scenes.number_of_children(); ++s)
+    {
+      const conduit::Node &scene = scenes.child(s);
+      if(!scene.has_child("plots"))
+      {
+        continue;
+      }
+      std::vector<std::string> plot_names = scene["plots"].child_names();
+      for(size_t p = 0; p < plot_names.size(); ++p)
+      {
+        names.insert(plot_names[p] + "_" + scene.name());
+      }
+    }
+  }
+  return names;
+}
+
+//-----------------------------------------------------------------------------
+// size and modification time of a file, empty if it can't be read
+std::string
+file_stamp(const std::string &fname)
+{
+  struct stat f_stat;
+  if(stat(fname.c_str(), &f_stat) != 0)
+  {
+    return "";
+  }
+
+  std::ostringstream oss;
+  oss << f_stat.st_size << ":" << f_stat.st_mtime;
+  return oss.str();
+}
+
+//-----------------------------------------------------------------------------
+};
+//-----------------------------------------------------------------------------
+// -- end ascent::detail --
+//-----------------------------------------------------------------------------
+
 //-----------------------------------------------------------------------------
 //-----------------------------------------------------------------------------
 //
@@ -123,9 +260,15 @@ int InfoHandler::m_rank = 0;
 //-----------------------------------------------------------------------------
 AscentRuntime::AscentRuntime()
 :Runtime(),
+ m_source(&m_data),
  m_refinement_level(2), // default refinement level for high order meshes
  m_rank(0),
- m_ghost_field_name("ascent_ghosts")
+ m_ghost_field_name("ascent_ghosts"),
+ m_source_fingerprint(""),
+ m_source_generation(0),
+ m_tracing(false),
+ m_image_channel(false),
+ m_is_child(false)
 {
     flow::filters::register_builtin();
     ResetInfo();
@@ -160,6 +303,7 @@ AscentRuntime::Initialize(const conduit::Node &options)
 #if defined(ASCENT_VTKM_ENABLED)
     vtkh::SetMPICommHandle(options["mpi_comm"].to_int());
 #endif
+    BlockTimer::SetMPICommHandle(options["mpi_comm"].to_int());
     MPI_Comm comm = MPI_Comm_f2c(options["mpi_comm"].to_int());
     MPI_Comm_rank(comm,&m_rank);
     InfoHandler::m_rank = m_rank;
@@ -219,6 +363,79 @@ AscentRuntime::Initialize(const conduit::Node &options)
       m_ghost_field_name = options["ghost_field_name"].as_string();
     }
 
+    // opt-in concurrent execution of independent filters
+    if(options.has_path("flow/max_threads"))
+    {
+      int max_threads = options["flow/max_threads"].to_int32();
+#ifdef ASCENT_MPI_ENABLED
+      // many filters issue collectives, and concurrent filters could
+      // reach them in a different order on each rank
+      if(max_threads > 1)
+      {
+        ASCENT_INFO("'flow/max_threads' is not supported with MPI,"
+                    " filters execute serially");
+        max_threads = 1;
+      }
+#endif
+      w.set_max_threads(max_threads);
+    }
+
+    // structured tracing of filter execution, "timings" is the
+    // original name of this option
+    if((options.has_path("trace/enabled") &&
+        options["trace/enabled"].as_string() == "true") ||
+       (options.has_path("timings") &&
+        options["timings"].as_string() == "enabled"))
+    {
+        if(options.has_path("trace/output"))
+        {
+            const std::string output = options["trace/output"].as_string();
+            if(output != "per_rank" && output != "merged")
+            {
+                ASCENT_ERROR("'trace/output' must be 'per_rank' or 'merged',"
+                             " given '" << output << "'");
+            }
+        }
+
+        if(options.has_path("trace/buffer_size"))
+        {
+            flow::Tracer::set_buffer_size(options["trace/buffer_size"].to_int32());
+        }
+
+        flow::Tracer::clear();
+        flow::Tracer::enable(true);
+        m_tracing = true;
+    }
+
+    // budget driven scheduling of scenes and extracts, configured after
+    // tracing so a user requested trace is not cleared by the scheduler
+    if(options.has_path("schedule"))
+    {
+      m_scheduler.Configure(options["schedule"]);
+    }
+
+    // max number of async relay extracts waiting to be written
+    if(options.has_path("relay/async_queue_depth"))
+    {
+        runtime::filters::RelayIOSave::set_max_pending_writes(
+          options["relay/async_queue_depth"].to_int32());
+    }
+
+    // opt-in reuse of filter results across calls to execute
+    if(options.has_path("cache/enabled") &&
+       options["cache/enabled"].as_string() == "true")
+    {
+      w.enable_result_cache(true);
+    }
+
+#if defined(ASCENT_VTKM_ENABLED)
+    // opt-in reuse of converted topologies across cycles
+    if(options.has_path("cache/topology"))
+    {
+      VTKHDataAdapter::SetTopologyCacheMode(options["cache/topology"].as_string());
+    }
+#endif
+
     // standard flow filters
     flow::filters::register_builtin();
     // filters for ascent flow runtime.
@@ -226,9 +443,10 @@ AscentRuntime::Initialize(const conduit::Node &options)
     // filters for expression evaluation
     runtime::expressions::register_builtin();
 
-    if(options.has_path("web/stream") &&
-       options["web/stream"].as_string() == "true" &&
-       m_rank == 0)
+    const bool web_stream = options.has_path("web/stream") &&
+                            options["web/stream"].as_string() == "true";
+
+    if(web_stream && m_rank == 0)
     {
 
         if(options.has_path("web/document_root"))
@@ -239,6 +457,21 @@ AscentRuntime::Initialize(const conduit::Node &options)
         m_web_interface.Enable();
     }
 
+    // keep rendered pngs in memory for the web and jupyter clients,
+    // streaming always uses it
+    if(web_stream ||
+       (options.has_path("image_channel/enabled") &&
+        options["image_channel/enabled"].as_string() == "true"))
+    {
+        if(options.has_path("image_channel/max_cycles"))
+        {
+            ImageChannel::SetMaxCycles(options["image_channel/max_cycles"].to_int32());
+        }
+
+        ImageChannel::Enable(true);
+        m_image_channel = true;
+    }
+
     Node msg;
     this->Info(msg["info"]);
     ascent::about(msg["about"]);
@@ -250,7 +483,43 @@ AscentRuntime::Initialize(const conduit::Node &options)
 void
 AscentRuntime::Info(conduit::Node &out)
 {
-    out.set(m_info);
+    out.reset();
+
+    NodeIterator itr = m_info.children();
+    while(itr.has_next())
+    {
+        Node &child = itr.next();
+        if(itr.name() != "images" || child.number_of_children() == 0)
+        {
+            out[itr.name()].set(child);
+            continue;
+        }
+
+        // the pngs are held by the image channel, refer to them
+        // rather than copying them. They stay valid until the next
+        // execute or close.
+        Node &images = out["images"];
+        images.set(DataType::list());
+        NodeIterator image_itr = child.children();
+        while(image_itr.has_next())
+        {
+            Node &image = image_itr.next();
+            Node &image_out = images.append();
+            NodeIterator leaf_itr = image.children();
+            while(leaf_itr.has_next())
+            {
+                Node &leaf = leaf_itr.next();
+                if(leaf_itr.name() == "png")
+                {
+                    image_out["png"].set_external(leaf);
+                }
+                else
+                {
+                    image_out[leaf_itr.name()].set(leaf);
+                }
+            }
+        }
+    }
 }
 
 //-----------------------------------------------------------------------------
@@ -258,42 +527,195 @@ void
 AscentRuntime::ResetInfo()
 {
     m_info.reset();
+    m_frames.clear();
     m_info["runtime/type"] = "ascent";
     m_info["registered_filter_types"] = registered_filter_types();
 }
 
 
+//-----------------------------------------------------------------------------
+void
+AscentRuntime::SetChild(bool is_child)
+{
+    m_is_child = is_child;
+}
+
 //-----------------------------------------------------------------------------
 void
 AscentRuntime::Cleanup()
 {
-    if(m_runtime_options.has_child("timings") &&
-       m_runtime_options["timings"].as_string() == "enabled")
+#if defined(ASCENT_VTKM_ENABLED)
+    // renderers kept between executes
+    runtime::filters::CreatePlot::release_renderers(w, std::set<std::string>());
+#endif
+
+    m_scheduler.Reset();
+
+    // the parent still uses the process wide state
+    if(m_is_child)
     {
-        // save out timing info on close
-        std::stringstream fname;
-        fname << "ascent_filter_times";
+        return;
+    }
+
+#if defined(ASCENT_VTKM_ENABLED)
+    // cached topologies may reference published data
+    VTKHDataAdapter::SetTopologyCacheMode("off");
+#endif
+    // in case an execute failed before releasing them
+    runtime::expressions::ExpressionEval::end_shared_reductions();
+    // compiled expressions hold flow graphs and results
+    runtime::expressions::ExpressionEval::reset_compiled();
+    // runtimes kept alive for triggers
+    runtime::filters::BasicTrigger::reset_runtimes();
 
 #ifdef ASCENT_MPI_ENABLED
-        fname << "_" << m_rank;
+    // complete hola mpi sends still in flight
+    hola_mpi_wait();
 #endif
-        fname << ".csv";
-        std::ofstream ftimings;
-        ftimings.open(fname.str());
-        ftimings << w.timing_info();
-        ftimings.close();
+
+    // finish writing async relay extracts
+    std::string write_errors = runtime::filters::RelayIOSave::flush_writes();
+    if(!write_errors.empty())
+    {
+        DisplayError("[Error] relay async write failed: " + write_errors);
+    }
+
+    if(m_image_channel)
+    {
+        m_info.reset();
+        m_frames.clear();
+        ImageChannel::Clear();
+        ImageChannel::Enable(false);
+        m_image_channel = false;
+    }
+
+    // save the trace last, so it includes the writes we waited on
+    if(m_tracing)
+    {
+        SaveTrace();
     }
 }
 
+//-----------------------------------------------------------------------------
+void
+AscentRuntime::SaveTrace()
+{
+    flow::Tracer::enable(false);
+    m_tracing = false;
+
+    std::string file_base = "ascent_trace";
+    if(m_runtime_options.has_path("trace/file"))
+    {
+        file_base = m_runtime_options["trace/file"].as_string();
+    }
+
+    std::string output = "per_rank";
+    if(m_runtime_options.has_path("trace/output"))
+    {
+        output = m_runtime_options["trace/output"].as_string();
+    }
+
+#ifdef ASCENT_MPI_ENABLED
+    MPI_Comm mpi_comm = MPI_Comm_f2c(flow::Workspace::default_mpi_comm());
+    if(output == "merged")
+    {
+        // gather the events of all ranks to the root, which writes
+        // them into a single trace
+        std::ostringstream oss;
+        flow::Tracer::write_trace_events(oss, m_rank);
+        const std::string events = oss.str();
+
+        int par_size = 0;
+        MPI_Comm_size(mpi_comm, &par_size);
+
+        int num_chars = (int)events.size();
+        std::vector<int> rank_chars(par_size, 0);
+        MPI_Gather(&num_chars, 1, MPI_INT,
+                   &rank_chars[0], 1, MPI_INT,
+                   0, mpi_comm);
+
+        std::vector<int> offsets(par_size, 0);
+        int total_chars = 0;
+        for(int i = 0; i < par_size; ++i)
+        {
+            offsets[i] = total_chars;
+            total_chars += rank_chars[i];
+        }
+
+        std::vector<char> all_events(m_rank == 0 ? total_chars + 1 : 1);
+        MPI_Gatherv(const_cast<char*>(events.data()), num_chars, MPI_CHAR,
+                    &all_events[0], &rank_chars[0], &offsets[0], MPI_CHAR,
+                    0, mpi_comm);
+
+        conduit::int64 dropped = flow::Tracer::number_of_dropped_events();
+        conduit::int64 total_dropped = 0;
+        MPI_Reduce(&dropped, &total_dropped, 1, MPI_INT64_T, MPI_SUM,
+                   0, mpi_comm);
+
+        if(m_rank == 0)
+        {
+            std::ofstream ftrace;
+            ftrace.open((file_base + ".json").c_str());
+            ftrace << "{\"traceEvents\":[\n";
+            for(int i = 0; i < par_size; ++i)
+            {
+                if(i > 0)
+                {
+                    ftrace << ",\n";
+                }
+                ftrace.write(&all_events[offsets[i]], rank_chars[i]);
+            }
+            ftrace << "\n],\n\"displayTimeUnit\":\"ms\",\n"
+                   << "\"otherData\":{\"dropped_events\":"
+                   << total_dropped
+                   << "}}\n";
+            ftrace.close();
+        }
+        flow::Tracer::clear();
+        return;
+    }
+#endif
+
+    std::stringstream fname;
+    fname << file_base;
+#ifdef ASCENT_MPI_ENABLED
+    fname << "_" << m_rank;
+#endif
+    fname << ".json";
+
+    try
+    {
+        flow::Tracer::save_trace(fname.str(), m_rank);
+    }
+    catch(conduit::Error &e)
+    {
+        DisplayError("[Error] " + e.message());
+    }
+    flow::Tracer::clear();
+}
+
 //-----------------------------------------------------------------------------
 void
 AscentRuntime::Publish(const conduit::Node &data)
 {
+#ifdef ASCENT_MPI_ENABLED
+    // hola mpi sends from the last cycle are done with their buffers
+    hola_mpi_wait();
+#endif
     // create our own tree, with all data zero copied.
     blueprint::mesh::to_multi_domain(data, m_data);
+    m_source = &m_data;
     EnsureDomainIds();
 }
 
+//-----------------------------------------------------------------------------
+void
+AscentRuntime::PublishSource(conduit::Node *data)
+{
+    // the tree was already converted by another runtime, use it as is
+    m_source = data;
+}
+
 //-----------------------------------------------------------------------------
 void
 AscentRuntime::EnsureDomainIds()
@@ -446,8 +868,40 @@ AscentRuntime::CreateDefaultFilters()
       end_filter = strip_name;
     //}
 
+    std::set<std::string> shared;
+    shared.insert("verify");
+    shared.insert("low_order");
+    shared.insert("vtkh_data");
+    shared.insert(strip_name);
+    m_scheduler.AddSharedFilters(shared);
+
     return end_filter;
 }
+//-----------------------------------------------------------------------------
+bool
+AscentRuntime::FindEquivalentFilter(const std::string &type,
+                                    const conduit::Node &params,
+                                    const std::string &input,
+                                    std::string &name)
+{
+    const std::string key = type + "\n" + input + "\n" + params.to_json();
+
+    std::map<std::string,std::string>::const_iterator itr;
+    itr = m_filter_keys.find(key);
+    if(itr != m_filter_keys.end() && w.graph().has_filter(itr->second))
+    {
+      name = itr->second;
+      // its cost belongs to all the actions that use it
+      std::set<std::string> shared;
+      shared.insert(name);
+      m_scheduler.AddSharedFilters(shared);
+      return true;
+    }
+
+    m_filter_keys[key] = name;
+    return false;
+}
+
 //-----------------------------------------------------------------------------
 void
 AscentRuntime::ConvertPipelineToFlow(const conduit::Node &pipeline,
@@ -500,6 +954,14 @@ AscentRuntime::ConvertPipelineToFlow(const conduit::Node &pipeline,
       std::stringstream ss;
       ss<<pipeline_name<<"_"<<i<<"_"<<filter_name;
       std::string name = ss.str();
+
+      // pipelines that start with the same filters share them
+      if(FindEquivalentFilter(filter_name, filter["params"], prev_name, name))
+      {
+        prev_name = name;
+        continue;
+      }
+
       w.graph().add_filter(filter_name,
                            name,
                            filter["params"]);
@@ -544,7 +1006,10 @@ AscentRuntime::CreatePipelines(const conduit::Node &pipelines)
   for(int i = 0; i < pipelines.number_of_children(); ++i)
   {
     conduit::Node pipe = pipelines.child(i);
+    std::set<std::string> before = detail::graph_filter_names(w.graph());
     ConvertPipelineToFlow(pipe, names[i]);
+    m_scheduler.SetActionFilters("pipelines/" + names[i],
+                                 detail::added_filter_names(before, w.graph()));
   }
 }
 
@@ -575,6 +1040,14 @@ AscentRuntime::ConvertExtractToFlow(const conduit::Node &extract,
     params["interface/input"]  = "ascent_data";
     params["interface/set_output"] = "ascent_set_output";
 
+    // optional function the script defines, called each cycle
+    // instead of running the whole script
+    if(params.has_child("entry"))
+    {
+      params["interface/entry"] = params["entry"];
+      params.remove("entry");
+    }
+
 #ifdef ASCENT_MPI_ENABLED
     // for MPI case, inspect args, if script is passed via file,
     // read contents on root and broadcast to other tasks
@@ -585,36 +1058,61 @@ AscentRuntime::ConvertExtractToFlow(const conduit::Node &extract,
      {
        std::string script_fname = params["file"].as_string();
 
-       Node n_py_src;
-       // read script only on rank 0
+       // rank 0 checks if the file changed since it was last read
+       // and broadcast, the other ranks follow its stamp
+       Node n_stamp;
        if(m_rank == 0)
        {
-         ostringstream py_src;
-         ifstream ifs(script_fname.c_str());
-
-         // guard by successful file open,
-         // otherwise our prefix comment will always cause
-         // a valid string to be passed to the node
-         // and we won't be able to detect when there was
-         // a bad file passed
-         if(ifs.is_open())
-         {
-             py_src << "# script from: " << script_fname << std::endl;
-             copy(istreambuf_iterator<char>(ifs),
-                  istreambuf_iterator<char>(),
-                  ostreambuf_iterator<char>(py_src));
-             n_py_src.set(py_src.str());
-             ifs.close();
-         }
+         n_stamp.set(detail::file_stamp(script_fname));
        }
+       relay::mpi::broadcast_using_schema(n_stamp,0,comm);
+       const std::string stamp = n_stamp.as_string();
 
-       relay::mpi::broadcast_using_schema(n_py_src,0,comm);
+       std::map<std::string,std::string>::const_iterator itr;
+       itr = m_python_script_stamps.find(script_fname);
 
-       if(!n_py_src.dtype().is_string())
+       Node n_py_src;
+       if(stamp != "" &&
+          itr != m_python_script_stamps.end() &&
+          itr->second == stamp)
+       {
+         n_py_src.set(m_python_script_sources[script_fname]);
+       }
+       else
        {
-         ASCENT_ERROR("failed to read python script file "
-                      << script_fname
-                      << " and broadcast source");
+         // read script only on rank 0
+         if(m_rank == 0)
+         {
+           ostringstream py_src;
+           ifstream ifs(script_fname.c_str());
+
+           // guard by successful file open,
+           // otherwise our prefix comment will always cause
+           // a valid string to be passed to the node
+           // and we won't be able to detect when there was
+           // a bad file passed
+           if(ifs.is_open())
+           {
+               py_src << "# script from: " << script_fname << std::endl;
+               copy(istreambuf_iterator<char>(ifs),
+                    istreambuf_iterator<char>(),
+                    ostreambuf_iterator<char>(py_src));
+               n_py_src.set(py_src.str());
+               ifs.close();
+           }
+         }
+
+         relay::mpi::broadcast_using_schema(n_py_src,0,comm);
+
+         if(!n_py_src.dtype().is_string())
+         {
+           ASCENT_ERROR("failed to read python script file "
+                        << script_fname
+                        << " and broadcast source");
+         }
+
+         m_python_script_sources[script_fname] = n_py_src.as_string();
+         m_python_script_stamps[script_fname]  = stamp;
        }
 
        // replace file param with source that includes actual script
@@ -693,15 +1191,6 @@ AscentRuntime::ConvertExtractToFlow(const conduit::Node &extract,
   if(extract_type == "xray" ||
      extract_type == "volume") special = true;
 
-  std::string ensure_name = "ensure_blueprint_" + extract_name;
-  conduit::Node empty_params;
-  if(!special)
-  {
-    w.graph().add_filter("ensure_blueprint",
-                         ensure_name,
-                         empty_params);
-  }
-
   w.graph().add_filter(filter_name,
                        extract_name,
                        params);
@@ -729,7 +1218,21 @@ AscentRuntime::ConvertExtractToFlow(const conduit::Node &extract,
   }
   if(!special)
   {
-    m_connections[ensure_name] = extract_source;
+    std::string ensure_name = "ensure_blueprint_" + extract_name;
+    // extracts of pipeline outputs reference the vtk-m arrays
+    conduit::Node ensure_params;
+    ensure_params["zero_copy"] = "true";
+    // extracts of the same source share the conversion
+    if(!FindEquivalentFilter("ensure_blueprint",
+                             ensure_params,
+                             extract_source,
+                             ensure_name))
+    {
+      w.graph().add_filter("ensure_blueprint",
+                           ensure_name,
+                           ensure_params);
+      m_connections[ensure_name] = extract_source;
+    }
     m_connections[extract_name] = ensure_name;
   }
   else
@@ -851,7 +1354,10 @@ AscentRuntime::CreateExtracts(const conduit::Node &extracts)
   for(int i = 0; i < extracts.number_of_children(); ++i)
   {
     conduit::Node extract = extracts.child(i);
+    std::set<std::string> before = detail::graph_filter_names(w.graph());
     ConvertExtractToFlow(extract, names[i]);
+    m_scheduler.SetActionFilters("extracts/" + names[i],
+                                 detail::added_filter_names(before, w.graph()));
   }
 }
 
@@ -884,13 +1390,13 @@ void
 AscentRuntime::PopulateMetadata()
 {
   // add global state meta data to the registry
-  const int num_domains = m_data.number_of_children();
+  const int num_domains = m_source->number_of_children();
   int cycle = 0;
   float time = 0.f;
 
   for(int i = 0; i < num_domains; ++i)
   {
-    const conduit::Node &dom = m_data.child(i);
+    const conduit::Node &dom = m_source->child(i);
     if(dom.has_path("state/cycle"))
     {
       cycle = dom["state/cycle"].to_int32();
@@ -909,11 +1415,160 @@ AscentRuntime::PopulateMetadata()
 
   Node *meta = w.registry().fetch<Node>("metadata");
   (*meta)["cycle"] = cycle;
+  // tag trace events with the cycle
+  flow::Tracer::set_cycle(cycle);
   (*meta)["time"] = time;
   (*meta)["refinement_level"] = m_refinement_level;
   (*meta)["ghost_field"] = m_ghost_field_name;
 
 }
+//-----------------------------------------------------------------------------
+// The result cache keys everything downstream of the source using a
+// fingerprint of the published data. The fingerprint captures the layout
+// and the array addresses, but not the array contents. Data updated in
+// place is only considered changed when:
+//  - every domain provides a "state/dirty_fields" list: only the listed
+//    fields changed, so only cached results that depend on them are
+//    recomputed, or otherwise
+//  - "state/cycle" changes. If the domains provide neither, the data is
+//    considered changed on every execute.
+// Cached results carry the cycle and time of the data they were built
+// from (e.g., extracts name their files using the cycle), so a change of
+// "state/cycle" or "state/time" always invalidates the cache.
+//
+// All ranks must agree on the fingerprint, otherwise ranks would disagree
+// on which filters execute (and the collectives they issue).
+//-----------------------------------------------------------------------------
+void
+AscentRuntime::UpdateSourceFingerprint()
+{
+  const int num_domains = m_source->number_of_children();
+
+  bool use_dirty_fields = num_domains > 0;
+  bool has_cycle = num_domains > 0;
+  std::set<std::string> dirty_fields;
+  std::ostringstream state;
+  state << std::setprecision(17);
+  for(int i = 0; i < num_domains; ++i)
+  {
+    const conduit::Node &dom = m_source->child(i);
+    if(!dom.has_path("state/dirty_fields"))
+    {
+      use_dirty_fields = false;
+    }
+    else
+    {
+      const conduit::Node &n_dirty = dom["state/dirty_fields"];
+      if(n_dirty.dtype().is_string())
+      {
+        dirty_fields.insert(n_dirty.as_string());
+      }
+      NodeConstIterator itr = n_dirty.children();
+      while(itr.has_next())
+      {
+        dirty_fields.insert(itr.next().as_string());
+      }
+    }
+
+    if(!dom.has_path("state/cycle"))
+    {
+      has_cycle = false;
+    }
+    else
+    {
+      state << dom["state/cycle"].to_int64() << " ";
+    }
+
+    if(dom.has_path("state/time"))
+    {
+      state << dom["state/time"].to_float64() << " ";
+    }
+  }
+
+  std::ostringstream oss;
+  detail::fingerprint_tree(*m_source, oss);
+  oss << "state " << state.str();
+  std::string fingerprint = oss.str();
+
+  // a new layout or new arrays always invalidate the cache
+  int changed = (fingerprint != m_source_fingerprint) ? 1 : 0;
+  if(!use_dirty_fields && !has_cycle)
+  {
+    // nothing tells us if the data was updated in place
+    changed = 1;
+  }
+
+#ifdef ASCENT_MPI_ENABLED
+  MPI_Comm mpi_comm = MPI_Comm_f2c(flow::Workspace::default_mpi_comm());
+  int global_changed = 0;
+  MPI_Allreduce(&changed, &global_changed, 1, MPI_INT, MPI_MAX, mpi_comm);
+  changed = global_changed;
+
+  // every rank needs the same dirty fields, gather the union
+  int local_use_dirty = use_dirty_fields ? 1 : 0;
+  int global_use_dirty = 0;
+  MPI_Allreduce(&local_use_dirty, &global_use_dirty, 1, MPI_INT, MPI_MIN, mpi_comm);
+  use_dirty_fields = global_use_dirty == 1;
+
+  if(use_dirty_fields)
+  {
+    std::ostringstream names;
+    names << " ";
+    std::set<std::string>::const_iterator itr;
+    for(itr = dirty_fields.begin(); itr != dirty_fields.end(); ++itr)
+    {
+      names << *itr << "\n";
+    }
+    conduit::Node n_names, n_all_names;
+    n_names.set(names.str());
+    relay::mpi::all_gather_using_schema(n_names, n_all_names, mpi_comm);
+
+    for(int r = 0; r < n_all_names.number_of_children(); ++r)
+    {
+      std::istringstream iss(n_all_names.child(r).as_string().substr(1));
+      std::string name;
+      while(std::getline(iss, name))
+      {
+        dirty_fields.insert(name);
+      }
+    }
+  }
+#endif
+
+  m_source_fingerprint = fingerprint;
+  if(changed == 1)
+  {
+    m_source_generation++;
+  }
+
+  std::ostringstream gen;
+  gen << m_source_generation;
+  w.set_fingerprint("source", gen.str());
+
+  // per field generations, only bumped by dirty fields
+  conduit::Node field_fingerprints;
+  field_fingerprints.set(DataType::object());
+  if(use_dirty_fields)
+  {
+    std::set<std::string>::const_iterator itr;
+    for(itr = dirty_fields.begin(); itr != dirty_fields.end(); ++itr)
+    {
+      m_field_generations[*itr]++;
+    }
+
+    std::map<std::string,int>::const_iterator g_itr;
+    for(g_itr = m_field_generations.begin();
+        g_itr != m_field_generations.end();
+        ++g_itr)
+    {
+      std::ostringstream f_gen;
+      f_gen << g_itr->second;
+      field_fingerprints[g_itr->first] = f_gen.str();
+    }
+  }
+  w.set_field_fingerprints("source", field_fingerprints);
+}
+
 //-----------------------------------------------------------------------------
 void
 AscentRuntime::ConnectSource()
@@ -921,10 +1576,17 @@ AscentRuntime::ConnectSource()
     // note: if the reg entry for data was already added
     // the set_external updates everything,
     // we don't need to remove and re-add.
+    // (unless the source was switched to a tree published elsewhere)
+    if(w.registry().has_entry("_ascent_input_data") &&
+       w.registry().fetch<Node>("_ascent_input_data") != m_source)
+    {
+        w.registry().detach("_ascent_input_data");
+    }
+
     if(!w.registry().has_entry("_ascent_input_data"))
     {
         w.registry().add<Node>("_ascent_input_data",
-                               &m_data);
+                               m_source);
     }
 
     if(!w.graph().has_filter("source"))
@@ -1019,6 +1681,8 @@ AscentRuntime::CreateScenes(const conduit::Node &scenes)
       ASCENT_ERROR("Scene must have at least one plot: "<<scene.to_json());
     }
 
+    std::set<std::string> before = detail::graph_filter_names(w.graph());
+
     // create the default render
     conduit::Node render_params;
     if(scene.has_path("renders"))
@@ -1046,9 +1710,70 @@ AscentRuntime::CreateScenes(const conduit::Node &scenes)
     w.graph().add_filter("create_scene",
                           "create_scene_" + names[i]);
 
+    // cinema renders every view of a database each cycle, trace and
+    // composite the views of each cinema render together instead of in
+    // vtk-h's default batches. The renders of the scene are split into
+    // groups, in the order the renders are created, and each group is
+    // rendered with its own batch size (0 keeps the vtk-h default).
+    // Each view in a batch holds its own image, so cinema batches are
+    // capped at a small size unless the render asks for one.
+    const int default_cinema_batch_size = 16;
+    conduit::Node exec_params;
+    if(scene.has_path("renders"))
+    {
+      bool has_cinema = false;
+      conduit::Node batches;
+      const int num_renders = scene["renders"].number_of_children();
+      for(int r = 0; r < num_renders; ++r)
+      {
+        const conduit::Node &render = scene["renders"].child(r);
+        if(render.has_path("type") &&
+           render["type"].as_string() == "cinema" &&
+           render.has_path("phi") &&
+           render.has_path("theta"))
+        {
+          has_cinema = true;
+          const int views = render["phi"].to_int32() * render["theta"].to_int32();
+          conduit::Node &batch = batches.append();
+          batch["count"] = views;
+          if(render.has_path("batch_size"))
+          {
+            batch["batch_size"] = render["batch_size"].to_int32();
+          }
+          else
+          {
+            batch["batch_size"] = std::min(views, default_cinema_batch_size);
+          }
+        }
+        else
+        {
+          // consecutive plain renders share a group
+          const int num_batches = batches.number_of_children();
+          if(num_batches > 0 &&
+             batches.child(num_batches - 1)["batch_size"].to_int32() == 0)
+          {
+            conduit::Node &count = batches.child(num_batches - 1)["count"];
+            count = count.to_int32() + 1;
+          }
+          else
+          {
+            conduit::Node &batch = batches.append();
+            batch["count"] = 1;
+            batch["batch_size"] = 0;
+          }
+        }
+      }
+
+      if(has_cinema)
+      {
+        exec_params["batches"] = batches;
+      }
+    }
+
     std::string exec_name = "exec_" + names[i];
     w.graph().add_filter("exec_scene",
-                          exec_name);
+                          exec_name,
+                          exec_params);
 
     // connect the renders to the scene exec
     // on the second port
@@ -1233,6 +1958,8 @@ AscentRuntime::CreateScenes(const conduit::Node &scenes)
     w.graph().connect(renders_name,       // src
                       exec_name,          // dest
                       1);                 // default port
+    m_scheduler.SetActionFilters("scenes/" + names[i],
+                                 detail::added_filter_names(before, w.graph()));
   } // each scene
 }
 
@@ -1270,6 +1997,10 @@ AscentRuntime::BuildGraph(const conduit::Node &actions)
   conduit::Node scenes;
   conduit::Node extracts;
 
+  // the graph is new, nothing to share or connect yet
+  m_filter_keys.clear();
+  m_connections.reset();
+
   // Loop over the actions
   for (int i = 0; i < actions.number_of_children(); ++i)
   {
@@ -1382,6 +2113,14 @@ AscentRuntime::Execute(const conduit::Node &actions)
     {
       // destroy existing graph an start anew
       w.reset();
+      m_scheduler.ClearFilters();
+      // scripts of the old graph's python extracts are compiled again
+      // when used. a child shares the interpreter with its parent,
+      // whose scripts are still in use
+      if(!m_is_child)
+      {
+        flow::filters::clear_python_script_cache();
+      }
       ConnectSource();
       BuildGraph(actions);
     }
@@ -1393,6 +2132,19 @@ AscentRuntime::Execute(const conduit::Node &actions)
 
     m_previous_actions = actions;
 
+    // leave out the scenes and extracts that don't fit in the budget.
+    // the graph holds all the actions, their filters are skipped
+    if(m_scheduler.Enabled())
+    {
+      m_scheduler.Schedule(actions, m_info["schedule"]);
+      w.set_skipped_filters(m_scheduler.SkippedFilters());
+    }
+
+    if(w.result_cache_enabled())
+    {
+      UpdateSourceFingerprint();
+    }
+
     PopulateMetadata(); // add metadata so filters can access it
 
     w.info(m_info["flow_graph"]);
@@ -1400,6 +2152,17 @@ AscentRuntime::Execute(const conduit::Node &actions)
     //w.print();
     //std::cout<<w.graph().to_dot();
 
+    // queries and triggers all read the published data, so field
+    // reductions can be shared between them for this execute. A child
+    // executes within the scope of its parent.
+    if(!m_is_child)
+    {
+      runtime::expressions::ExpressionEval::begin_shared_reductions();
+#if defined(ASCENT_VTKM_ENABLED)
+      VTKHDataAdapter::ClearFieldImportInfo();
+#endif
+    }
+
     // catch any errors that come up here and forward
     // them up as a conduit error
     try
@@ -1421,6 +2184,47 @@ AscentRuntime::Execute(const conduit::Node &actions)
       ASCENT_ERROR("Execution failed with: "<<e.what());
     }
 
+    if(!m_is_child)
+    {
+      runtime::expressions::ExpressionEval::end_shared_reductions();
+    }
+
+    if(m_scheduler.Enabled())
+    {
+      m_scheduler.Update();
+    }
+
+#if defined(ASCENT_VTKM_ENABLED)
+    // which fields the conversion to vtk-m had to copy
+    Node field_import;
+    VTKHDataAdapter::FieldImportInfo(field_import);
+    if(field_import.number_of_children() > 0)
+    {
+      m_info["field_import"] = field_import;
+    }
+
+    // keep the renderers of all plots in the actions, including the
+    // scenes the scheduler skipped this time
+    runtime::filters::CreatePlot::release_renderers(w,
+                                                    detail::scene_plot_names(actions));
+    Node renderers;
+    runtime::filters::CreatePlot::renderer_info(w, renderers);
+    if(renderers.number_of_children() > 0)
+    {
+      m_info["renderers"] = renderers;
+    }
+#endif
+
+#ifdef ASCENT_MPI_ENABLED
+    // balance of the last load balanced hola_mpi transfer
+    Node hola_info;
+    hola_mpi_info(hola_info);
+    if(hola_info.number_of_children() > 0)
+    {
+      m_info["hola_mpi"] = hola_info;
+    }
+#endif
+
     Node msg;
     this->Info(msg["info"]);
     ascent::about(msg["about"]);
@@ -1431,6 +2235,27 @@ AscentRuntime::Execute(const conduit::Node &actions)
     FindRenders(renders, render_file_names);
     m_info["images"] = renders;
 
+    if(m_image_channel)
+    {
+        // point the info at the pngs held by the image channel,
+        // only the rank that composited the images has them
+        const int num_images = renders.number_of_children();
+        for(int i = 0; i < num_images; ++i)
+        {
+            const Node &image = renders.child(i);
+            ImageChannel::FramePtr frame
+              = ImageChannel::Fetch(image["image_name"].as_string(),
+                                    image["cycle"].to_int32());
+            if(frame)
+            {
+                m_frames.push_back(frame);
+                m_info["images"][i]["png"].set_external(
+                  const_cast<uint8*>(frame->Png()),
+                  frame->PngSize());
+            }
+        }
+    }
+
     const conduit::Node &expression_cache =
       runtime::expressions::ExpressionEval::get_cache();
 
@@ -1439,7 +2264,15 @@ AscentRuntime::Execute(const conduit::Node &actions)
       m_info["expressions"] = expression_cache;
     }
 
-    m_web_interface.PushRenders(render_file_names);
+    const conduit::Node &compiled_info =
+      runtime::expressions::ExpressionEval::get_compiled_info();
+
+    if(compiled_info.number_of_children() > 0)
+    {
+      m_info["expression_cache"] = compiled_info;
+    }
+
+    m_web_interface.PushRenders(renders);
 
     w.registry().reset();
 }
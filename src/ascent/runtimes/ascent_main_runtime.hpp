@@ -54,9 +54,13 @@
 
 #include <ascent.hpp>
 #include <ascent_runtime.hpp>
+#include <ascent_action_scheduler.hpp>
+#include <ascent_image_channel.hpp>
 #include <ascent_web_interface.hpp>
 #include <flow.hpp>
 
+#include <map>
+
 
 
 //-----------------------------------------------------------------------------
@@ -77,12 +81,22 @@ public:
     void  Initialize(const conduit::Node &options) override;
 
     void  Publish(const conduit::Node &data) override;
+    // uses a multi-domain tree (with domain ids) that was already published
+    // to another runtime as the source, without converting it again.
+    // The tree must stay valid until the next call to Execute returns.
+    void  PublishSource(conduit::Node *data);
     void  Execute(const conduit::Node &actions) override;
 
     void  Info(conduit::Node &out) override;
 
     void  Cleanup() override;
 
+    // marks a runtime created by another runtime (e.g., for a trigger).
+    // Must be called before Initialize. A child runtime leaves process
+    // wide state (shared reductions, compiled expressions, topology cache,
+    // async writes, the image channel, ...) to the runtime that owns it.
+    void  SetChild(bool is_child);
+
     void DisplayError(const std::string &msg) override;
 
     template <class FilterType>
@@ -99,6 +113,9 @@ private:
     conduit::Node     m_runtime_options;
     // conduit node that (externally) holds the data from the simulation
     conduit::Node     m_data;
+    // the tree connected to the source filter (m_data, unless the data
+    // was provided via PublishSource)
+    conduit::Node    *m_source;
     conduit::Node     m_connections;
     conduit::Node     m_scene_connections;
 
@@ -109,8 +126,36 @@ private:
     int               m_refinement_level;
     int               m_rank;
     std::string       m_ghost_field_name;
+    // state used to fingerprint the published data for the result cache
+    std::string       m_source_fingerprint;
+    int               m_source_generation;
+    // generations of the fields listed in state/dirty_fields
+    std::map<std::string,int> m_field_generations;
+    // true when this runtime enabled flow::Tracer and owns the trace
+    bool              m_tracing;
+    // true when this runtime enabled the image channel
+    bool              m_image_channel;
+    // true when this runtime executes on behalf of another runtime
+    bool              m_is_child;
+    // frames referenced (externally) by m_info["images"]
+    std::vector<ImageChannel::FramePtr> m_frames;
+    // decides which scenes and extracts run each execute
+    ActionScheduler   m_scheduler;
+    // python extract sources read from files (and broadcast), and the
+    // size and mtime of the file on rank 0 when read, by file name
+    std::map<std::string,std::string> m_python_script_sources;
+    std::map<std::string,std::string> m_python_script_stamps;
+    // filters added while building the graph, keyed by type, input and
+    // params, so equivalent filters are only added once
+    std::map<std::string,std::string> m_filter_keys;
 
     void              ResetInfo();
+    // returns true and the name of an existing filter of the same type
+    // with equal params on the same input, otherwise records name for it
+    bool              FindEquivalentFilter(const std::string &type,
+                                           const conduit::Node &params,
+                                           const std::string &input,
+                                           std::string &name);
 
     flow::Workspace w;
     std::string CreateDefaultFilters();
@@ -138,6 +183,8 @@ private:
     void BuildGraph(const conduit::Node &actions);
     void EnsureDomainIds();
     void PopulateMetadata();
+    void UpdateSourceFingerprint();
+    void SaveTrace();
 
     std::string GetDefaultImagePrefix(const std::string scene);
 
@@ -56,6 +56,8 @@
 #include <limits.h>
 #include <cstdlib>
 #include <sstream>
+#include <map>
+#include <mutex>
 #include <type_traits>
 
 // third party includes
@@ -70,6 +72,7 @@
 #include <vtkm/cont/DataSet.h>
 #include <vtkm/cont/ArrayCopy.h>
 #include <vtkm/cont/ArrayHandleExtractComponent.h>
+#include <vtkm/cont/ArrayHandleCompositeVector.h>
 #include <vtkh/DataSet.hpp>
 // other ascent includes
 #include <ascent_logging.hpp>
@@ -292,7 +295,9 @@ vtkm::cont::Field GetField(const conduit::Node &node,
 
   int num_vals = node.dtype().number_of_elements();
 
-  const T *values_ptr = node.value();
+  // element_ptr, since conduit and vtk-m may use different
+  // (same sized) types for 64-bit integers
+  const T *values_ptr = static_cast<const T*>(node.element_ptr(0));
 
   vtkm::cont::Field field;
   field = vtkm::cont::make_Field(field_name,
@@ -412,6 +417,130 @@ void ExtractVector(vtkm::cont::DataSet *dset,
 }
 
 
+//
+// cache of converted coordinate systems + cell sets, keyed by
+// domain id and topology name
+//
+struct CachedTopology
+{
+  std::string          signature;
+  vtkm::cont::DataSet  dataset;
+  int                  neles;
+  int                  nverts;
+};
+
+static std::string s_topology_cache_mode = "off";
+static std::map<std::string, CachedTopology> s_topology_cache;
+static std::mutex s_topology_cache_mutex;
+
+//
+// per field record of the values copied by the conversions since
+// the last ClearFieldImportInfo()
+//
+static conduit::Node s_field_import_info;
+static std::mutex s_field_import_mutex;
+
+void RecordFieldImport(const std::string &field_name,
+                       bool copied,
+                       index_t bytes)
+{
+  std::lock_guard<std::mutex> lock(s_field_import_mutex);
+  conduit::Node &entry = s_field_import_info[field_name];
+  if(!entry.has_child("copied"))
+  {
+    entry["copied"] = "false";
+    entry["bytes"]  = (int64) 0;
+  }
+
+  if(copied)
+  {
+    entry["copied"] = "true";
+  }
+  entry["bytes"] = entry["bytes"].to_int64() + (int64) bytes;
+}
+
+//
+// point a node at the values of a vtk-m array, or copy them
+//
+template<typename T>
+void SetArray(conduit::Node &node,
+              T *values_ptr,
+              index_t num_vals,
+              index_t offset,
+              index_t stride,
+              bool zero_copy)
+{
+  if(zero_copy)
+  {
+    node.set_external(values_ptr, num_vals, offset, stride);
+  }
+  else
+  {
+    node.set(values_ptr, num_vals, offset, stride);
+  }
+}
+
+template<typename T>
+void SetArray(conduit::Node &node,
+              T *values_ptr,
+              index_t num_vals,
+              bool zero_copy)
+{
+  SetArray(node, values_ptr, num_vals, 0, sizeof(T), zero_copy);
+}
+
+// 64-bit FNV-1a over the bytes of every element of a leaf
+uint64 HashLeaf(const conduit::Node &leaf, uint64 hash)
+{
+  const index_t num_eles  = leaf.dtype().number_of_elements();
+  const index_t ele_bytes = leaf.dtype().element_bytes();
+  for(index_t i = 0; i < num_eles; ++i)
+  {
+    const unsigned char *ele = (const unsigned char*) leaf.element_ptr(i);
+    for(index_t b = 0; b < ele_bytes; ++b)
+    {
+      hash ^= ele[b];
+      hash *= 1099511628211ULL;
+    }
+  }
+  return hash;
+}
+
+// describes the layout and addresses of all the leaves in a tree
+void TopologySignature(const conduit::Node &node,
+                       bool hash_contents,
+                       std::ostream &oss)
+{
+  const int num_children = node.number_of_children();
+  if(num_children == 0)
+  {
+    const conduit::DataType &dt = node.dtype();
+    oss << node.path() << " "
+        << dt.id() << " "
+        << dt.number_of_elements() << " "
+        << dt.offset() << " "
+        << dt.stride() << " "
+        << node.data_ptr();
+
+    // small leaves (dims, origin, shape names) are cheap to compare
+    if(dt.number_of_elements() <= 16)
+    {
+      oss << " " << node.to_json();
+    }
+    else if(hash_contents)
+    {
+      oss << " " << HashLeaf(node, 14695981039346656037ULL);
+    }
+    oss << "\n";
+    return;
+  }
+
+  for(int i = 0; i < num_children; ++i)
+  {
+    TopologySignature(node.child(i), hash_contents, oss);
+  }
+}
+
 void VTKmCellShape(const std::string shape_type,
                    vtkm::UInt8 &shape_id,
                    vtkm::IdComponent &num_indices)
@@ -543,7 +672,43 @@ VTKHDataAdapter::BlueprintToVTKmDataSet(const Node &node,
     int neles  = 0;
     int nverts = 0;
 
-    if( mesh_type ==  "uniform")
+    // check if we can reuse the topology from a previous conversion
+    std::string cache_key;
+    std::string signature;
+    bool cache_hit = false;
+    if(detail::s_topology_cache_mode != "off" &&
+       node.has_path("state/domain_id"))
+    {
+        std::ostringstream key;
+        key << node["state/domain_id"].to_int64() << "/" << topo_name;
+        cache_key = key.str();
+
+        std::ostringstream sig;
+        sig << mesh_type << " " << coords_name << " " << zero_copy << "\n";
+        bool hash_contents = detail::s_topology_cache_mode == "hash";
+        detail::TopologySignature(n_coords, hash_contents, sig);
+        detail::TopologySignature(n_topo, hash_contents, sig);
+        signature = sig.str();
+
+        std::lock_guard<std::mutex> lock(detail::s_topology_cache_mutex);
+        std::map<std::string, detail::CachedTopology>::const_iterator itr;
+        itr = detail::s_topology_cache.find(cache_key);
+        if(itr != detail::s_topology_cache.end() &&
+           itr->second.signature == signature)
+        {
+            // vtk-m shallow copies the coordinate system and cell set
+            result = new vtkm::cont::DataSet(itr->second.dataset);
+            neles  = itr->second.neles;
+            nverts = itr->second.nverts;
+            cache_hit = true;
+        }
+    }
+
+    if(cache_hit)
+    {
+        // reused a cached topology, only the fields need to be added
+    }
+    else if( mesh_type ==  "uniform")
     {
         result = UniformBlueprintToVTKmDataSet(coords_name,
                                                n_coords,
@@ -588,6 +753,18 @@ VTKHDataAdapter::BlueprintToVTKmDataSet(const Node &node,
         ASCENT_ERROR("Unsupported topology/type:" << mesh_type);
     }
 
+    if(cache_key != "" && !cache_hit)
+    {
+        // keep a (shallow) copy of the coordinate system and cell set
+        // before any fields are added
+        std::lock_guard<std::mutex> lock(detail::s_topology_cache_mutex);
+        detail::CachedTopology &entry = detail::s_topology_cache[cache_key];
+        entry.signature = signature;
+        entry.dataset   = *result;
+        entry.neles     = neles;
+        entry.nverts    = nverts;
+    }
+
 
     if(node.has_child("fields"))
     {
@@ -1209,6 +1386,29 @@ VTKHDataAdapter::AddField(const std::string &field_name,
                 dset->AddField(detail::GetField<float64>(n_vals, field_name, assoc_str, topo_name, zero_copy));
                 supported_type = true;
             }
+            // vtk-m also dispatches on basic int32 and int64 arrays,
+            // without zero copy these are converted to float64 below
+            else if(zero_copy &&
+                    n_vals.dtype().is_int32() &&
+                    n_vals.dtype().endianness_matches_machine())
+            {
+                dset->AddField(detail::GetField<vtkm::Int32>(n_vals, field_name, assoc_str, topo_name, zero_copy));
+                supported_type = true;
+            }
+            else if(zero_copy &&
+                    n_vals.dtype().is_int64() &&
+                    n_vals.dtype().endianness_matches_machine())
+            {
+                dset->AddField(detail::GetField<vtkm::Int64>(n_vals, field_name, assoc_str, topo_name, zero_copy));
+                supported_type = true;
+            }
+
+            if(supported_type)
+            {
+                detail::RecordFieldImport(field_name,
+                                          !zero_copy,
+                                          zero_copy ? 0 : n_vals.dtype().bytes_compact());
+            }
         }
 
         // vtk-m cant support zero copy for this layout or was not compiled to expose this datatype
@@ -1223,6 +1423,7 @@ VTKHDataAdapter::AddField(const std::string &field_name,
             Node n_tmp;
             n_tmp.set_external(DataType::float64(num_vals),ptr);
             n_vals.to_float64_array(n_tmp);
+            detail::RecordFieldImport(field_name, true, num_vals * sizeof(vtkm::Float64));
 
             // add field to dataset
             if(assoc_str == "vertex")
@@ -1299,6 +1500,9 @@ VTKHDataAdapter::AddVectorField(const std::string &field_name,
                                                     topo_name,
                                                     zero_copy));
               supported_type = true;
+              detail::RecordFieldImport(field_name,
+                                        !zero_copy,
+                                        zero_copy ? 0 : num_vals * sizeof(Vec3f32));
             }
             else if(u.dtype().is_float64())
             {
@@ -1313,6 +1517,9 @@ VTKHDataAdapter::AddVectorField(const std::string &field_name,
                                                     topo_name,
                                                     zero_copy));
               supported_type = true;
+              detail::RecordFieldImport(field_name,
+                                        !zero_copy,
+                                        zero_copy ? 0 : num_vals * sizeof(Vec3f64));
             }
         }
         else
@@ -1335,6 +1542,10 @@ VTKHDataAdapter::AddVectorField(const std::string &field_name,
                                            assoc_str,
                                            topo_name,
                                            zero_copy);
+            // the interleaved copy, and the components unless zero copied
+            detail::RecordFieldImport(field_name,
+                                      true,
+                                      (zero_copy ? 3 : 6) * num_vals * sizeof(float32));
           }
           else if(u.dtype().is_float64())
           {
@@ -1347,6 +1558,9 @@ VTKHDataAdapter::AddVectorField(const std::string &field_name,
                                            assoc_str,
                                            topo_name,
                                            zero_copy);
+            detail::RecordFieldImport(field_name,
+                                      true,
+                                      (zero_copy ? 3 : 6) * num_vals * sizeof(float64));
           }
         }
     }
@@ -1402,7 +1616,8 @@ GetBlueprintCellName(vtkm::UInt8 shape_id)
 
 bool
 VTKHDataAdapter::VTKmTopologyToBlueprint(conduit::Node &output,
-                                         const vtkm::cont::DataSet &data_set)
+                                         const vtkm::cont::DataSet &data_set,
+                                         bool zero_copy)
 {
 
   int topo_dims;
@@ -1474,9 +1689,9 @@ VTKHDataAdapter::VTKmTopologyToBlueprint(conduit::Node &output,
     output["topologies/topo/type"] = "rectilinear";
 
     output["coordsets/coords/type"] = "rectilinear";
-    output["coordsets/coords/values/x"].set(x_ptr, x_portal.GetNumberOfValues());
-    output["coordsets/coords/values/y"].set(y_ptr, y_portal.GetNumberOfValues());
-    output["coordsets/coords/values/z"].set(z_ptr, z_portal.GetNumberOfValues());
+    detail::SetArray(output["coordsets/coords/values/x"], x_ptr, x_portal.GetNumberOfValues(), zero_copy);
+    detail::SetArray(output["coordsets/coords/values/y"], y_ptr, y_portal.GetNumberOfValues(), zero_copy);
+    detail::SetArray(output["coordsets/coords/values/z"], z_ptr, z_portal.GetNumberOfValues(), zero_copy);
   }
   else
   {
@@ -1509,9 +1724,9 @@ VTKHDataAdapter::VTKmTopologyToBlueprint(conduit::Node &output,
       point_dims[0] = x_handle.GetNumberOfValues();
       point_dims[1] = y_handle.GetNumberOfValues();
       point_dims[2] = z_handle.GetNumberOfValues();
-      output["coordsets/coords/values/x"].set(vtkh::GetVTKMPointer(x_handle), point_dims[0]);
-      output["coordsets/coords/values/y"].set(vtkh::GetVTKMPointer(y_handle), point_dims[1]);
-      output["coordsets/coords/values/z"].set(vtkh::GetVTKMPointer(z_handle), point_dims[2]);
+      detail::SetArray(output["coordsets/coords/values/x"], vtkh::GetVTKMPointer(x_handle), point_dims[0], zero_copy);
+      detail::SetArray(output["coordsets/coords/values/y"], vtkh::GetVTKMPointer(y_handle), point_dims[1], zero_copy);
+      detail::SetArray(output["coordsets/coords/values/z"], vtkh::GetVTKMPointer(z_handle), point_dims[2], zero_copy);
 
     }
     else if(coordsHandle.IsType<CoordsVec32>())
@@ -1522,18 +1737,24 @@ VTKHDataAdapter::VTKmTopologyToBlueprint(conduit::Node &output,
       vtkm::Float32 *points_ptr = (vtkm::Float32*)vtkh::GetVTKMPointer(points);
       const int byte_size = sizeof(vtkm::Float32);
 
-      output["coordsets/coords/values/x"].set(points_ptr,
-                                              num_vals,
-                                              byte_size*0,  // byte offset
-                                              byte_size*3); // stride
-      output["coordsets/coords/values/y"].set(points_ptr,
-                                              num_vals,
-                                              byte_size*1,  // byte offset
-                                              sizeof(vtkm::Float32)*3); // stride
-      output["coordsets/coords/values/z"].set(points_ptr,
-                                              num_vals,
-                                              byte_size*2,  // byte offset
-                                              byte_size*3); // stride
+      detail::SetArray(output["coordsets/coords/values/x"],
+                       points_ptr,
+                       num_vals,
+                       byte_size*0,  // byte offset
+                       byte_size*3,  // stride
+                       zero_copy);
+      detail::SetArray(output["coordsets/coords/values/y"],
+                       points_ptr,
+                       num_vals,
+                       byte_size*1,  // byte offset
+                       sizeof(vtkm::Float32)*3,  // stride
+                       zero_copy);
+      detail::SetArray(output["coordsets/coords/values/z"],
+                       points_ptr,
+                       num_vals,
+                       byte_size*2,  // byte offset
+                       byte_size*3,  // stride
+                       zero_copy);
 
     }
     else if(coordsHandle.IsType<Coords64>())
@@ -1547,9 +1768,9 @@ VTKHDataAdapter::VTKmTopologyToBlueprint(conduit::Node &output,
       point_dims[0] = x_handle.GetNumberOfValues();
       point_dims[1] = y_handle.GetNumberOfValues();
       point_dims[2] = z_handle.GetNumberOfValues();
-      output["coordsets/coords/values/x"].set(vtkh::GetVTKMPointer(x_handle), point_dims[0]);
-      output["coordsets/coords/values/y"].set(vtkh::GetVTKMPointer(y_handle), point_dims[1]);
-      output["coordsets/coords/values/z"].set(vtkh::GetVTKMPointer(z_handle), point_dims[2]);
+      detail::SetArray(output["coordsets/coords/values/x"], vtkh::GetVTKMPointer(x_handle), point_dims[0], zero_copy);
+      detail::SetArray(output["coordsets/coords/values/y"], vtkh::GetVTKMPointer(y_handle), point_dims[1], zero_copy);
+      detail::SetArray(output["coordsets/coords/values/z"], vtkh::GetVTKMPointer(z_handle), point_dims[2], zero_copy);
 
     }
     else if(coordsHandle.IsType<CoordsVec64>())
@@ -1560,18 +1781,24 @@ VTKHDataAdapter::VTKmTopologyToBlueprint(conduit::Node &output,
       vtkm::Float64 *points_ptr = (vtkm::Float64*)vtkh::GetVTKMPointer(points);
       const int byte_size = sizeof(vtkm::Float64);
 
-      output["coordsets/coords/values/x"].set(points_ptr,
-                                              num_vals,
-                                              byte_size*0,  // byte offset
-                                              byte_size*3); // stride
-      output["coordsets/coords/values/y"].set(points_ptr,
-                                              num_vals,
-                                              byte_size*1,  // byte offset
-                                              byte_size*3); // stride
-      output["coordsets/coords/values/z"].set(points_ptr,
-                                              num_vals,
-                                              byte_size*2,  // byte offset
-                                              byte_size*3); // stride
+      detail::SetArray(output["coordsets/coords/values/x"],
+                       points_ptr,
+                       num_vals,
+                       byte_size*0,  // byte offset
+                       byte_size*3,  // stride
+                       zero_copy);
+      detail::SetArray(output["coordsets/coords/values/y"],
+                       points_ptr,
+                       num_vals,
+                       byte_size*1,  // byte offset
+                       byte_size*3,  // stride
+                       zero_copy);
+      detail::SetArray(output["coordsets/coords/values/z"],
+                       points_ptr,
+                       num_vals,
+                       byte_size*2,  // byte offset
+                       byte_size*3,  // stride
+                       zero_copy);
 
     }
     else
@@ -1629,8 +1856,10 @@ VTKHDataAdapter::VTKmTopologyToBlueprint(conduit::Node &output,
         auto conn = cells.GetConnectivityArray(vtkm::TopologyElementTagCell(),
                                                vtkm::TopologyElementTagPoint());
 
-        output["topologies/topo/elements/connectivity"].set(vtkh::GetVTKMPointer(conn),
-                                                             conn.GetNumberOfValues());
+        detail::SetArray(output["topologies/topo/elements/connectivity"],
+                         vtkh::GetVTKMPointer(conn),
+                         conn.GetNumberOfValues(),
+                         zero_copy);
       }
       else if(vtkh::VTKMDataSetInfo::IsSingleCellShape(dyn_cells, shape_id))
       {
@@ -1648,8 +1877,10 @@ VTKHDataAdapter::VTKmTopologyToBlueprint(conduit::Node &output,
         auto conn = cells.GetConnectivityArray(vtkm::TopologyElementTagCell(),
                                                vtkm::TopologyElementTagPoint());
 
-        output["topologies/topo/elements/connectivity"].set(vtkh::GetVTKMPointer(conn),
-                                                             conn.GetNumberOfValues());
+        detail::SetArray(output["topologies/topo/elements/connectivity"],
+                         vtkh::GetVTKMPointer(conn),
+                         conn.GetNumberOfValues(),
+                         zero_copy);
 
       }
       else
@@ -1666,31 +1897,39 @@ VTKHDataAdapter::VTKmTopologyToBlueprint(conduit::Node &output,
 template<typename T, int N>
 void ConvertVecToNode(conduit::Node &output,
                       std::string path,
-                      vtkm::cont::ArrayHandle<vtkm::Vec<T,N>> &handle)
+                      vtkm::cont::ArrayHandle<vtkm::Vec<T,N>> &handle,
+                      bool zero_copy)
 {
   static_assert(N > 1 && N < 4, "Vecs must be size 2 or 3");
   output[path + "/type"] = "vector";
-  output[path + "/values/u"].set((T*) vtkh::GetVTKMPointer(handle),
-                                 handle.GetNumberOfValues(),
-                                 sizeof(T)*0,   // starting offset in bytes
-                                 sizeof(T)*N);  // stride in bytes
-  output[path + "/values/v"].set((T*) vtkh::GetVTKMPointer(handle),
-                                 handle.GetNumberOfValues(),
-                                 sizeof(T)*1,   // starting offset in bytes
-                                 sizeof(T)*N);  // stride in bytes
+  detail::SetArray(output[path + "/values/u"],
+                   (T*) vtkh::GetVTKMPointer(handle),
+                   handle.GetNumberOfValues(),
+                   sizeof(T)*0,   // starting offset in bytes
+                   sizeof(T)*N,   // stride in bytes
+                   zero_copy);
+  detail::SetArray(output[path + "/values/v"],
+                   (T*) vtkh::GetVTKMPointer(handle),
+                   handle.GetNumberOfValues(),
+                   sizeof(T)*1,   // starting offset in bytes
+                   sizeof(T)*N,   // stride in bytes
+                   zero_copy);
   if(N == 3)
   {
 
-    output[path + "/values/w"].set((T*) vtkh::GetVTKMPointer(handle),
-                                   handle.GetNumberOfValues(),
-                                   sizeof(T)*2,   // starting offset in bytes
-                                   sizeof(T)*N);  // stride in bytes
+    detail::SetArray(output[path + "/values/w"],
+                     (T*) vtkh::GetVTKMPointer(handle),
+                     handle.GetNumberOfValues(),
+                     sizeof(T)*2,   // starting offset in bytes
+                     sizeof(T)*N,   // stride in bytes
+                     zero_copy);
   }
 }
 
 void
 VTKHDataAdapter::VTKmFieldToBlueprint(conduit::Node &output,
-                                      const vtkm::cont::Field &field)
+                                      const vtkm::cont::Field &field,
+                                      bool zero_copy)
 {
   std::string name = field.GetName();
   std::string path = "fields/" + name;
@@ -1717,80 +1956,102 @@ VTKHDataAdapter::VTKmFieldToBlueprint(conduit::Node &output,
   {
     using HandleType = vtkm::cont::ArrayHandle<vtkm::Float32>;
     HandleType handle = dyn_handle.Cast<HandleType>();
-    output[path + "/values"].set(vtkh::GetVTKMPointer(handle), handle.GetNumberOfValues());
+    detail::SetArray(output[path + "/values"],
+                     vtkh::GetVTKMPointer(handle),
+                     handle.GetNumberOfValues(),
+                     zero_copy);
   }
   else if(dyn_handle.IsType<vtkm::cont::ArrayHandle<vtkm::Float64>>())
   {
     using HandleType = vtkm::cont::ArrayHandle<vtkm::Float64>;
     HandleType handle = dyn_handle.Cast<HandleType>();
-    output[path + "/values"].set(vtkh::GetVTKMPointer(handle), handle.GetNumberOfValues());
+    detail::SetArray(output[path + "/values"],
+                     vtkh::GetVTKMPointer(handle),
+                     handle.GetNumberOfValues(),
+                     zero_copy);
   }
   else if(dyn_handle.IsType<vtkm::cont::ArrayHandle<vtkm::Int8>>())
   {
     using HandleType = vtkm::cont::ArrayHandle<vtkm::Int8>;
     HandleType handle = dyn_handle.Cast<HandleType>();
-    output[path + "/values"].set(vtkh::GetVTKMPointer(handle), handle.GetNumberOfValues());
+    detail::SetArray(output[path + "/values"],
+                     vtkh::GetVTKMPointer(handle),
+                     handle.GetNumberOfValues(),
+                     zero_copy);
   }
   else if(dyn_handle.IsType<vtkm::cont::ArrayHandle<vtkm::Int32>>())
   {
     using HandleType = vtkm::cont::ArrayHandle<vtkm::Int32>;
     HandleType handle = dyn_handle.Cast<HandleType>();
-    output[path + "/values"].set(vtkh::GetVTKMPointer(handle), handle.GetNumberOfValues());
+    detail::SetArray(output[path + "/values"],
+                     vtkh::GetVTKMPointer(handle),
+                     handle.GetNumberOfValues(),
+                     zero_copy);
   }
   else if(dyn_handle.IsType<vtkm::cont::ArrayHandle<vtkm::Int64>>())
   {
     using HandleType = vtkm::cont::ArrayHandle<vtkm::Int64>;
     HandleType handle = dyn_handle.Cast<HandleType>();
-    ASCENT_ERROR("Conduit int64 and vtkm::Int64 are different. Cannot convert vtkm::Int64\n");
-    //output[path + "/values"].set(vtkh::GetVTKMPointer(handle), handle.GetNumberOfValues());
+    // conduit int64 and vtkm::Int64 can be different types of the
+    // same size
+    detail::SetArray(output[path + "/values"],
+                     reinterpret_cast<int64*>(vtkh::GetVTKMPointer(handle)),
+                     handle.GetNumberOfValues(),
+                     zero_copy);
   }
   else if(dyn_handle.IsType<vtkm::cont::ArrayHandle<vtkm::UInt32>>())
   {
     using HandleType = vtkm::cont::ArrayHandle<vtkm::UInt32>;
     HandleType handle = dyn_handle.Cast<HandleType>();
-    output[path + "/values"].set(vtkh::GetVTKMPointer(handle), handle.GetNumberOfValues());
+    detail::SetArray(output[path + "/values"],
+                     vtkh::GetVTKMPointer(handle),
+                     handle.GetNumberOfValues(),
+                     zero_copy);
   }
   else if(dyn_handle.IsType<vtkm::cont::ArrayHandle<vtkm::UInt8>>())
   {
     using HandleType = vtkm::cont::ArrayHandle<vtkm::UInt8>;
     HandleType handle = dyn_handle.Cast<HandleType>();
-    output[path + "/values"].set(vtkh::GetVTKMPointer(handle), handle.GetNumberOfValues());
+    detail::SetArray(output[path + "/values"],
+                     vtkh::GetVTKMPointer(handle),
+                     handle.GetNumberOfValues(),
+                     zero_copy);
   }
   else if(dyn_handle.IsType<vtkm::cont::ArrayHandle<vtkm::Vec<vtkm::Float32,3>>>())
   {
     using HandleType = vtkm::cont::ArrayHandle<vtkm::Vec<vtkm::Float32,3>>;
     HandleType handle = dyn_handle.Cast<HandleType>();
-    ConvertVecToNode(output, path, handle);
+    ConvertVecToNode(output, path, handle, zero_copy);
   }
   else if(dyn_handle.IsType<vtkm::cont::ArrayHandle<vtkm::Vec<vtkm::Float64,3>>>())
   {
     using HandleType = vtkm::cont::ArrayHandle<vtkm::Vec<vtkm::Float64,3>>;
     HandleType handle = dyn_handle.Cast<HandleType>();
-    ConvertVecToNode(output, path, handle);
+    ConvertVecToNode(output, path, handle, zero_copy);
   }
   else if(dyn_handle.IsType<vtkm::cont::ArrayHandle<vtkm::Vec<vtkm::Int32,3>>>())
   {
     using HandleType = vtkm::cont::ArrayHandle<vtkm::Vec<vtkm::Int32,3>>;
     HandleType handle = dyn_handle.Cast<HandleType>();
-    ConvertVecToNode(output, path, handle);
+    ConvertVecToNode(output, path, handle, zero_copy);
   }
   else if(dyn_handle.IsType<vtkm::cont::ArrayHandle<vtkm::Vec<vtkm::Float32,2>>>())
   {
     using HandleType = vtkm::cont::ArrayHandle<vtkm::Vec<vtkm::Float32,2>>;
     HandleType handle = dyn_handle.Cast<HandleType>();
-    ConvertVecToNode(output, path, handle);
+    ConvertVecToNode(output, path, handle, zero_copy);
   }
   else if(dyn_handle.IsType<vtkm::cont::ArrayHandle<vtkm::Vec<vtkm::Float64,2>>>())
   {
     using HandleType = vtkm::cont::ArrayHandle<vtkm::Vec<vtkm::Float64,2>>;
     HandleType handle = dyn_handle.Cast<HandleType>();
-    ConvertVecToNode(output, path, handle);
+    ConvertVecToNode(output, path, handle, zero_copy);
   }
   else if(dyn_handle.IsType<vtkm::cont::ArrayHandle<vtkm::Vec<vtkm::Int32,2>>>())
   {
     using HandleType = vtkm::cont::ArrayHandle<vtkm::Vec<vtkm::Int32,2>>;
     HandleType handle = dyn_handle.Cast<HandleType>();
-    ConvertVecToNode(output, path, handle);
+    ConvertVecToNode(output, path, handle, zero_copy);
   }
   else
   {
@@ -1801,7 +2062,8 @@ VTKHDataAdapter::VTKmFieldToBlueprint(conduit::Node &output,
 
 void
 VTKHDataAdapter::VTKHToBlueprintDataSet(vtkh::DataSet *dset,
-                                        conduit::Node &node)
+                                        conduit::Node &node,
+                                        bool zero_copy)
 {
   node.reset();
   const int num_doms = dset->GetNumberOfDomains();
@@ -1812,15 +2074,60 @@ VTKHDataAdapter::VTKHToBlueprintDataSet(vtkh::DataSet *dset,
     vtkm::Id domain_id;
     int cycle = dset->GetCycle();
     dset->GetDomain(i, vtkm_dom, domain_id);
-    VTKHDataAdapter::VTKmToBlueprintDataSet(&vtkm_dom,dom);
+    VTKHDataAdapter::VTKmToBlueprintDataSet(&vtkm_dom, dom, zero_copy);
     dom["state/domain_id"] = (int) domain_id;
     dom["state/cycle"] = cycle;
   }
 }
 
+void
+VTKHDataAdapter::SetTopologyCacheMode(const std::string &mode)
+{
+  if(mode != "off" && mode != "pointer" && mode != "hash")
+  {
+    ASCENT_ERROR("Unknown topology cache mode '"<<mode<<"'."
+                 <<" Valid modes are 'off', 'pointer' and 'hash'");
+  }
+
+  detail::s_topology_cache_mode = mode;
+
+  if(mode == "off")
+  {
+    ClearTopologyCache();
+  }
+}
+
+std::string
+VTKHDataAdapter::TopologyCacheMode()
+{
+  return detail::s_topology_cache_mode;
+}
+
+void
+VTKHDataAdapter::ClearTopologyCache()
+{
+  std::lock_guard<std::mutex> lock(detail::s_topology_cache_mutex);
+  detail::s_topology_cache.clear();
+}
+
+void
+VTKHDataAdapter::FieldImportInfo(conduit::Node &out)
+{
+  std::lock_guard<std::mutex> lock(detail::s_field_import_mutex);
+  out.set(detail::s_field_import_info);
+}
+
+void
+VTKHDataAdapter::ClearFieldImportInfo()
+{
+  std::lock_guard<std::mutex> lock(detail::s_field_import_mutex);
+  detail::s_field_import_info.reset();
+}
+
 void
 VTKHDataAdapter::VTKmToBlueprintDataSet(const vtkm::cont::DataSet *dset,
-                                        conduit::Node &node)
+                                        conduit::Node &node,
+                                        bool zero_copy)
 {
   //
   // with vtkm, we have no idea what the type is of anything inside
@@ -1828,7 +2135,7 @@ VTKHDataAdapter::VTKmToBlueprintDataSet(const vtkm::cont::DataSet *dset,
   //
   const int default_cell_set = 0;
 
-  bool is_empty = VTKmTopologyToBlueprint(node, *dset);
+  bool is_empty = VTKmTopologyToBlueprint(node, *dset, zero_copy);
 
   if(!is_empty)
   {
@@ -1836,7 +2143,7 @@ VTKHDataAdapter::VTKmToBlueprintDataSet(const vtkm::cont::DataSet *dset,
     for(vtkm::Id i = 0; i < num_fields; ++i)
     {
       vtkm::cont::Field field = dset->GetField(i);
-      VTKmFieldToBlueprint(node, field);
+      VTKmFieldToBlueprint(node, field, zero_copy);
     }
   }
 }
@@ -115,11 +115,42 @@ public:
     // wraps a single VTKm data set into a VTKH dataset
     static vtkh::DataSet    *VTKmDataSetToVTKHDataSet(vtkm::cont::DataSet *dset);
 
+    // convert vtk-m / vtk-h data to blueprint
+    //
+    // zero copy means the node points at the vtk-m arrays (set_external)
+    // instead of copying them, the data set must outlive the node
     static void              VTKmToBlueprintDataSet(const vtkm::cont::DataSet *dset,
-                                                    conduit::Node &node);
+                                                    conduit::Node &node,
+                                                    bool zero_copy = false);
 
     static void              VTKHToBlueprintDataSet(vtkh::DataSet *dset,
-                                                    conduit::Node &node);
+                                                    conduit::Node &node,
+                                                    bool zero_copy = false);
+
+    // controls reuse of converted coordinate systems and cell sets
+    // across conversions. Entries are keyed by domain id and topology
+    // name, so only domains that provide state/domain_id are cached.
+    //
+    //  "off"     (default) always convert the topology
+    //  "pointer" reuse when the coordset and topology arrays have the
+    //            same addresses, dtypes and sizes as the last conversion
+    //  "hash"    same as "pointer", and also compare a hash of the
+    //            array contents (catches in-place updates)
+    static void              SetTopologyCacheMode(const std::string &mode);
+    static std::string       TopologyCacheMode();
+    // releases all cached topologies
+    static void              ClearTopologyCache();
+
+    // fields imported since the last clear, and if their values were
+    // copied:
+    //
+    //   <field>/copied  "true" if any domain copied the values
+    //   <field>/bytes   number of bytes copied, over all domains
+    //
+    // with zero copy, compact float32 / float64 / int32 / int64 scalars
+    // and interleaved float vectors are not copied
+    static void              FieldImportInfo(conduit::Node &out);
+    static void              ClearFieldImportInfo();
 private:
     // helpers for specific conversion cases
     static vtkm::cont::DataSet  *UniformBlueprintToVTKmDataSet(const std::string &coords_name,
@@ -172,10 +203,12 @@ private:
                                                 bool zero_copy);
 
     static bool VTKmTopologyToBlueprint(conduit::Node &output,
-                                        const vtkm::cont::DataSet &data_set);
+                                        const vtkm::cont::DataSet &data_set,
+                                        bool zero_copy);
 
     static void VTKmFieldToBlueprint(conduit::Node &output,
-                                     const vtkm::cont::Field &field);
+                                     const vtkm::cont::Field &field,
+                                     bool zero_copy);
 
 };
 
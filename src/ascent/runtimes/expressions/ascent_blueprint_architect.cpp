@@ -57,6 +57,7 @@
 #include <cstring>
 #include <limits>
 #include <cmath>
+#include <vector>
 
 #include <flow_workspace.hpp>
 
@@ -613,6 +614,36 @@ element_location(const conduit::Node &domain,
   return res;
 }
 
+namespace detail
+{
+
+conduit::Node
+field_location(const conduit::Node &domain,
+               const std::string &field,
+               const int &index)
+{
+  const std::string assoc_str = domain["fields/" + field + "/association"].as_string();
+
+  conduit::Node res;
+  if(assoc_str == "vertex")
+  {
+    res["position"] = vert_location(domain, index);
+  }
+  else if(assoc_str == "element")
+  {
+    res["position"] = element_location(domain, index);
+  }
+  else
+  {
+    ASCENT_ERROR("Location for "<<assoc_str<<" not implemented");
+  }
+  res["domain_id"] = domain.has_path("state/domain_id") ?
+                     domain["state/domain_id"].to_int32() : -1;
+  return res;
+}
+
+};
+
 bool is_scalar_field(const conduit::Node &dataset, const std::string &field_name)
 {
   bool is_scalar = false;
@@ -687,7 +718,7 @@ field_histogram(const conduit::Node &dataset,
   double *global_bins = new double[num_bins];
 
   MPI_Comm mpi_comm = MPI_Comm_f2c(flow::Workspace::default_mpi_comm());
-  MPI_Allreduce(bins, global_bins, num_bins, MPI_INT, MPI_SUM, mpi_comm);
+  MPI_Allreduce(bins, global_bins, num_bins, MPI_DOUBLE, MPI_SUM, mpi_comm);
 
   double *tmp = bins;
   bins = global_bins;
@@ -836,219 +867,193 @@ conduit::Node quantile(const conduit::Node &cdf,
   return res;
 }
 
-conduit::Node
-field_min(const conduit::Node &dataset,
-          const std::string &field)
-{
-  double min_value = std::numeric_limits<double>::max();
 
-  int domain = -1;
-  int domain_id = -1;
-  int index = -1;
 
-  for(int i = 0; i < dataset.number_of_children(); ++i)
-  {
-    const conduit::Node &dom = dataset.child(i);
-    if(dom.has_path("fields/"+field))
-    {
-      const std::string path = "fields/" + field + "/values";
-      conduit::Node res;
-      res = array_min(dom[path]);
-      double a_min = res["value"].to_float64();
-      if(a_min < min_value)
-      {
-        min_value = a_min;
-        index = res["index"].as_int32();
-        domain = i;
-        domain_id = dom["state/domain_id"].to_int32();
-      }
-    }
-  }
 
-  const std::string assoc_str = dataset.child(0)["fields/"
-                                + field + "/association"].as_string();
 
-  conduit::Node loc;
-  if(assoc_str == "vertex")
+namespace detail
+{
+// packed field reduction: has, min, min pos[3], min domain id, min rank,
+//                         max, max pos[3], max domain id, max rank,
+//                         sum, count
+const int reduce_packed_size = 15;
+
+void combine_field_reductions(const double *in, double *inout)
+{
+  if(in[0] == 0.)
   {
-    loc = vert_location(dataset.child(domain),index);
+    return;
   }
-  else if(assoc_str == "element")
+  if(inout[0] == 0.)
   {
-    loc = element_location(dataset.child(domain),index);
+    memcpy(inout, in, sizeof(double) * reduce_packed_size);
+    return;
   }
-  else
+  // ties go to the lowest rank so every rank agrees on the result
+  if(in[1] < inout[1] || (in[1] == inout[1] && in[6] < inout[6]))
   {
-    ASCENT_ERROR("Location for "<<assoc_str<<" not implemented");
+    memcpy(inout + 1, in + 1, sizeof(double) * 6);
   }
+  if(in[7] > inout[7] || (in[7] == inout[7] && in[12] < inout[12]))
+  {
+    memcpy(inout + 7, in + 7, sizeof(double) * 6);
+  }
+  inout[13] += in[13];
+  inout[14] += in[14];
+}
 
-  int rank = 0;
-  conduit::Node res;
 #ifdef ASCENT_MPI_ENABLED
-  struct MinLoc
+void mpi_combine_field_reductions(void *in,
+                                  void *inout,
+                                  int *len,
+                                  MPI_Datatype *)
+{
+  const double *in_vals = static_cast<const double*>(in);
+  double *inout_vals = static_cast<double*>(inout);
+  for(int i = 0; i < *len; ++i)
   {
-    double value;
-    int rank;
-  };
-
-  MPI_Comm mpi_comm = MPI_Comm_f2c(flow::Workspace::default_mpi_comm());
-  MPI_Comm_rank(mpi_comm, &rank);
-
-  MinLoc minloc = {min_value, rank};
-  MinLoc minloc_res;
-  MPI_Allreduce( &minloc, &minloc_res, 1, MPI_DOUBLE_INT, MPI_MINLOC, mpi_comm);
-  min_value = minloc.value;
-
-  double * ploc = loc.as_float64_ptr();
-  MPI_Bcast(ploc, 3, MPI_DOUBLE, minloc_res.rank, mpi_comm);
-  MPI_Bcast(&domain_id, 1, MPI_INT, minloc_res.rank, mpi_comm);
-
-  loc.set(ploc, 3);
-
-  rank = minloc_res.rank;
+    combine_field_reductions(in_vals + i * reduce_packed_size,
+                             inout_vals + i * reduce_packed_size);
+  }
+}
 #endif
-  res["rank"] = rank;
-  res["domain_id"] = domain_id;
-  res["position"] = loc;
-  res["value"] = min_value;
 
-  return res;
-}
+} // namespace detail
 
 conduit::Node
-field_sum(const conduit::Node &dataset,
-          const std::string &field)
+field_reduce(const conduit::Node &dataset,
+             const std::string &field)
 {
-  
-  double sum = 0.;
-  long long int count = 0;
+  const int packed_size = detail::reduce_packed_size;
+  double local[packed_size];
+  for(int i = 0; i < packed_size; ++i)
+  {
+    local[i] = 0.;
+  }
+  local[1] = std::numeric_limits<double>::max();
+  local[7] = std::numeric_limits<double>::lowest();
 
+  int rank = 0;
+#ifdef ASCENT_MPI_ENABLED
+  MPI_Comm mpi_comm = MPI_Comm_f2c(flow::Workspace::default_mpi_comm());
+  MPI_Comm_rank(mpi_comm, &rank);
+#endif
+
+  int min_domain = -1;
+  int min_index = -1;
+  int max_domain = -1;
+  int max_index = -1;
+
+  // one fused pass over each domain
   for(int i = 0; i < dataset.number_of_children(); ++i)
   {
     const conduit::Node &dom = dataset.child(i);
     if(dom.has_path("fields/"+field))
     {
       const std::string path = "fields/" + field + "/values";
-      conduit::Node res;
-      res = array_sum(dom[path]);
-
-      double a_sum = res["value"].to_float64();
-      long long int a_count = res["count"].to_int64();
+      conduit::Node res = array_reduce(dom[path]);
+      const double a_min = res["min/value"].to_float64();
+      const double a_max = res["max/value"].to_float64();
+      if(a_min < local[1])
+      {
+        local[1] = a_min;
+        min_index = res["min/index"].as_int32();
+        min_domain = i;
+      }
+      if(a_max > local[7])
+      {
+        local[7] = a_max;
+        max_index = res["max/index"].as_int32();
+        max_domain = i;
+      }
+      local[13] += res["sum/value"].to_float64();
+      local[14] += res["sum/count"].to_float64();
+    }
+  }
 
-      sum += a_sum;
-      count += a_count;
+  if(min_domain != -1)
+  {
+    local[0] = 1.;
+    const conduit::Node &n_min = detail::field_location(dataset.child(min_domain),
+                                                        field,
+                                                        min_index);
+    const conduit::Node &n_max = detail::field_location(dataset.child(max_domain),
+                                                        field,
+                                                        max_index);
+    for(int i = 0; i < 3; ++i)
+    {
+      local[2 + i] = n_min["position"].as_float64_ptr()[i];
+      local[8 + i] = n_max["position"].as_float64_ptr()[i];
     }
+    local[5] = n_min["domain_id"].to_float64();
+    local[6] = rank;
+    local[11] = n_max["domain_id"].to_float64();
+    local[12] = rank;
   }
 
+  double global[packed_size];
+  memcpy(global, local, sizeof(double) * packed_size);
+
 #ifdef ASCENT_MPI_ENABLED
-  int rank;
-  MPI_Comm mpi_comm = MPI_Comm_f2c(flow::Workspace::default_mpi_comm());
-  MPI_Comm_rank(mpi_comm, &rank);
-  double global_sum;
-  MPI_Allreduce(&sum, &global_sum, 1, MPI_DOUBLE, MPI_SUM, mpi_comm);
+  // a single collective replaces the separate min, max and sum reductions
+  MPI_Datatype packed_type;
+  MPI_Type_contiguous(packed_size, MPI_DOUBLE, &packed_type);
+  MPI_Type_commit(&packed_type);
+  MPI_Op combine_op;
+  MPI_Op_create(detail::mpi_combine_field_reductions, 1, &combine_op);
 
-  long long int global_count;
-  MPI_Allreduce(&count, &global_count, 1, MPI_LONG_LONG_INT, MPI_SUM, mpi_comm);
+  MPI_Allreduce(local, global, 1, packed_type, combine_op, mpi_comm);
 
-  sum = global_sum;
-  count = global_count;
+  MPI_Op_free(&combine_op);
+  MPI_Type_free(&packed_type);
 #endif
 
+  if(global[0] == 0.)
+  {
+    ASCENT_ERROR("Field reduction: field '"<<field<<"' not found");
+  }
+
   conduit::Node res;
-  res["value"] = sum;
-  res["count"] = count;
+  res["min/rank"] = (int) global[6];
+  res["min/domain_id"] = (int) global[5];
+  res["min/position"].set(global + 2, 3);
+  res["min/value"] = global[1];
+  res["max/rank"] = (int) global[12];
+  res["max/domain_id"] = (int) global[11];
+  res["max/position"].set(global + 8, 3);
+  res["max/value"] = global[7];
+  res["sum/value"] = global[13];
+  res["sum/count"] = (long long int) global[14];
+  res["avg/value"] = global[13] / global[14];
   return res;
 }
 
 conduit::Node
-field_avg(const conduit::Node &dataset,
+field_min(const conduit::Node &dataset,
           const std::string &field)
 {
-  conduit::Node sum = field_sum(dataset, field);
-
-  double avg = sum["value"].to_float64() / sum["count"].to_float64();
-
-  conduit::Node res;
-  res["value"] = avg;
-  return res;
+  return field_reduce(dataset, field)["min"];
 }
 
 conduit::Node
 field_max(const conduit::Node &dataset,
           const std::string &field)
 {
-  double max_value = std::numeric_limits<double>::lowest();
-
-  int domain = -1;
-  int domain_id = -1;
-  int index = -1;
-
-  for(int i = 0; i < dataset.number_of_children(); ++i)
-  {
-    const conduit::Node &dom = dataset.child(i);
-    if(dom.has_path("fields/"+field))
-    {
-      const std::string path = "fields/" + field + "/values";
-      conduit::Node res;
-      res = array_max(dom[path]);
-      double a_max = res["value"].to_float64();
-      if(a_max > max_value)
-      {
-        max_value = a_max;
-        index = res["index"].as_int32();
-        domain = i;
-        domain_id = dom["state/domain_id"].to_int32();
-      }
-    }
-  }
-
-  const std::string assoc_str = dataset.child(0)["fields/"
-                                + field + "/association"].as_string();
-
-  conduit::Node loc;
-  if(assoc_str == "vertex")
-  {
-    loc = vert_location(dataset.child(domain),index);
-  }
-  else if(assoc_str == "element")
-  {
-    loc = element_location(dataset.child(domain),index);
-  }
-  else
-  {
-    ASCENT_ERROR("Location for "<<assoc_str<<" not implemented");
-  }
-
-  int rank = 0;
-  conduit::Node res;
-#ifdef ASCENT_MPI_ENABLED
-  struct MaxLoc
-  {
-    double value;
-    int rank;
-  };
-
-  MPI_Comm mpi_comm = MPI_Comm_f2c(flow::Workspace::default_mpi_comm());
-  MPI_Comm_rank(mpi_comm, &rank);
-
-  MaxLoc maxloc = {max_value, rank};
-  MaxLoc maxloc_res;
-  MPI_Allreduce( &maxloc, &maxloc_res, 1, MPI_DOUBLE_INT, MPI_MAXLOC, mpi_comm);
-  max_value = maxloc.value;
-
-  double * ploc = loc.as_float64_ptr();
-  MPI_Bcast(ploc, 3, MPI_DOUBLE, maxloc_res.rank, mpi_comm);
-  MPI_Bcast(&domain_id, 1, MPI_INT, maxloc_res.rank, mpi_comm);
+  return field_reduce(dataset, field)["max"];
+}
 
-  loc.set(ploc, 3);
-  rank = maxloc_res.rank;
-#endif
-  res["rank"] = rank;
-  res["domain_id"] = domain_id;
-  res["position"] = loc;
-  res["value"] = max_value;
+conduit::Node
+field_sum(const conduit::Node &dataset,
+          const std::string &field)
+{
+  return field_reduce(dataset, field)["sum"];
+}
 
-  return res;
+conduit::Node
+field_avg(const conduit::Node &dataset,
+          const std::string &field)
+{
+  return field_reduce(dataset, field)["avg"];
 }
 
 conduit::Node
@@ -82,6 +82,11 @@ conduit::Node element_location(const conduit::Node &domain,
                                const int &index,
                                const std::string topo_name = "");
 
+// min, max, sum and avg of a scalar field computed in one pass per domain
+// and combined with a single collective
+conduit::Node field_reduce(const conduit::Node &dataset,
+                           const std::string &field_name);
+
 conduit::Node field_max(const conduit::Node &dataset,
                         const std::string &field_name);
 
@@ -211,6 +211,72 @@ struct SumFunctor
   }
 };
 
+struct ReduceCompare
+{
+  double min_value;
+  int min_index;
+  double max_value;
+  int max_index;
+  double sum;
+};
+
+#ifdef ASCENT_USE_OPENMP
+    #pragma omp declare reduction(fused: struct ReduceCompare : \
+        omp_out.min_index = omp_in.min_value < omp_out.min_value ? \
+                            omp_in.min_index : omp_out.min_index, \
+        omp_out.min_value = omp_in.min_value < omp_out.min_value ? \
+                            omp_in.min_value : omp_out.min_value, \
+        omp_out.max_index = omp_in.max_value > omp_out.max_value ? \
+                            omp_in.max_index : omp_out.max_index, \
+        omp_out.max_value = omp_in.max_value > omp_out.max_value ? \
+                            omp_in.max_value : omp_out.max_value, \
+        omp_out.sum += omp_in.sum) \
+        initializer(omp_priv = omp_orig)
+#endif
+
+// computes min, max and sum in a single pass over the values
+struct ReduceFunctor
+{
+  template<typename T>
+  conduit::Node operator()(const T* values, const int &size) const
+  {
+    ReduceCompare rcomp;
+
+    rcomp.min_value = std::numeric_limits<double>::max();
+    rcomp.min_index = 0;
+    rcomp.max_value = std::numeric_limits<double>::lowest();
+    rcomp.max_index = 0;
+    rcomp.sum = 0.;
+#ifdef ASCENT_USE_OPENMP
+    #pragma omp parallel for reduction(fused:rcomp)
+#endif
+    for(int v = 0; v < size; ++v)
+    {
+      double val = static_cast<double>(values[v]);
+      if(val < rcomp.min_value)
+      {
+        rcomp.min_value = val;
+        rcomp.min_index = v;
+      }
+      if(val > rcomp.max_value)
+      {
+        rcomp.max_value = val;
+        rcomp.max_index = v;
+      }
+      rcomp.sum += val;
+    }
+
+    conduit::Node res;
+    res["min/value"] = rcomp.min_value;
+    res["min/index"] = rcomp.min_index;
+    res["max/value"] = rcomp.max_value;
+    res["max/index"] = rcomp.max_index;
+    res["sum/value"] = rcomp.sum;
+    res["sum/count"] = (int)size;
+    return res;
+  }
+};
+
 struct HistogramFunctor
 {
   double m_min_val;
@@ -279,6 +345,12 @@ array_sum(const conduit::Node &values)
   return detail::type_dispatch(values, detail::SumFunctor());
 }
 
+conduit::Node
+array_reduce(const conduit::Node &values)
+{
+  return detail::type_dispatch(values, detail::ReduceFunctor());
+}
+
 conduit::Node
 array_histogram(const conduit::Node &values,
                 const double &min_value,
@@ -80,6 +80,10 @@ conduit::Node array_min(const conduit::Node &values);
 
 conduit::Node array_sum(const conduit::Node &values);
 
+// fused min, max and sum: {min:{value,index}, max:{value,index},
+// sum:{value,count}}
+conduit::Node array_reduce(const conduit::Node &values);
+
 conduit::Node array_histogram(const conduit::Node &values,
                               const double &min_value,
                               const double &max_value,
@@ -69,6 +69,7 @@
 
 #include <limits>
 #include <math.h>
+#include <mutex>
 #include <typeinfo>
 
 #ifdef ASCENT_MPI_ENABLED
@@ -269,6 +270,24 @@ bool logic_op(const bool lhs, const bool rhs, const std::string &op)
   return res;
 }
 
+// min, max, sum and avg of a field are computed together and shared
+// between all reductions on that field
+const conduit::Node &
+field_reduction(flow::Workspace &workspace, const std::string &field)
+{
+  // the reductions may be shared between workspaces
+  static std::mutex reductions_mutex;
+  std::lock_guard<std::mutex> lock(reductions_mutex);
+
+  conduit::Node *dataset = workspace.registry().fetch<Node>("dataset");
+  conduit::Node *reductions = workspace.registry().fetch<Node>("field_reductions");
+  if(!reductions->has_child(field))
+  {
+    (*reductions)[field] = field_reduce(*dataset, field);
+  }
+  return (*reductions)[field];
+}
+
 } // namespace detail
 
 //-----------------------------------------------------------------------------
@@ -1061,7 +1080,7 @@ FieldMin::execute()
     ASCENT_ERROR("FieldMin: field '"<<field<<"' is not a scalar field");
   }
 
-  conduit::Node n_min = field_min(*dataset, field);
+  const conduit::Node &n_min = detail::field_reduction(graph().workspace(), field)["min"];
 
   (*output)["type"] = "value_position";
   (*output)["attrs/value/value"] = n_min["value"];
@@ -1165,7 +1184,7 @@ FieldMax::execute()
     ASCENT_ERROR("FieldMax: field '"<<field<<"' is not a scalar field");
   }
 
-  conduit::Node n_max = field_max(*dataset, field);
+  const conduit::Node &n_max = detail::field_reduction(graph().workspace(), field)["max"];
 
   (*output)["type"] = "value_position";
   (*output)["attrs/value/value"] = n_max["value"];
@@ -1270,7 +1289,7 @@ FieldAvg::execute()
     ASCENT_ERROR("FieldAvg: field '"<<field<<"' is not a scalar field");
   }
 
-  conduit::Node n_avg = field_avg(*dataset, field);
+  const conduit::Node &n_avg = detail::field_reduction(graph().workspace(), field)["avg"];
 
   (*output)["value"] = n_avg["value"];
   (*output)["type"] = "double";
@@ -1648,7 +1667,7 @@ Histogram::execute()
   }
   else
   {
-    max_val = field_max(*dataset, field)["value"].to_float64();
+    max_val = detail::field_reduction(graph().workspace(), field)["max/value"].to_float64();
   }
 
   if(!n_min->dtype().is_empty())
@@ -1657,7 +1676,7 @@ Histogram::execute()
   }
   else
   {
-    min_val = field_min(*dataset, field)["value"].to_float64();
+    min_val = detail::field_reduction(graph().workspace(), field)["min/value"].to_float64();
   }
 
   if(min_val >= max_val)
@@ -2050,10 +2069,9 @@ void
 FieldSum::execute()
 {
   std::string field = (*input<Node>("arg1"))["value"].as_string();
-  conduit::Node *dataset = graph().workspace().registry().fetch<Node>("dataset");
 
   conduit::Node *output = new conduit::Node();
-  (*output)["value"] = field_sum(*dataset, field)["value"];
+  (*output)["value"] = detail::field_reduction(graph().workspace(), field)["sum/value"];
   (*output)["type"] = "double";
 
   set_output<conduit::Node>(output);
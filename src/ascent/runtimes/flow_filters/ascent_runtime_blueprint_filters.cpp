@@ -129,6 +129,8 @@ BlueprintVerify::declare_interface(Node &i)
     i["type_name"]   = "blueprint_verify";
     i["port_names"].append() = "in";
     i["output_port"] = "true";
+    i["cacheable"]   = "true";
+    i["field_usage"] = "params";
 }
 
 //-----------------------------------------------------------------------------
@@ -228,6 +230,8 @@ EnsureLowOrder::declare_interface(Node &i)
     i["type_name"]   = "ensure_low_order";
     i["port_names"].append() = "in";
     i["output_port"] = "true";
+    i["cacheable"]   = "true";
+    i["field_usage"] = "params";
 }
 
 bool
@@ -333,6 +337,16 @@ EnsureBlueprint::declare_interface(Node &i)
 void
 EnsureBlueprint::execute()
 {
+    // point the blueprint output at the vtk-m arrays instead of copying
+    bool zero_copy = false;
+    if(params().has_path("zero_copy"))
+    {
+      if(params()["zero_copy"].as_string() == "true")
+      {
+        zero_copy = true;
+      }
+    }
+
     if(input(0).check_type<Node>())
     {
         // our data is already a node, pass though
@@ -355,14 +369,29 @@ EnsureBlueprint::execute()
         vtkh::DataSet *in_dset = input<vtkh::DataSet>(0);
         conduit::Node * res = new conduit::Node();
 
-        VTKHDataAdapter::VTKHToBlueprintDataSet(in_dset, *res);
+        VTKHDataAdapter::VTKHToBlueprintDataSet(in_dset, *res, zero_copy);
+        if(zero_copy)
+        {
+          // the output references the input's arrays, hold the input in
+          // the registry until it is reset at the end of the execute
+          graph().workspace().registry().add<vtkh::DataSet>(name() + "_zero_copy_input",
+                                                            in_dset,
+                                                            1);
+        }
         set_output<conduit::Node>(res);
     }
     else if(input(0).check_type<vtkm::cont::DataSet>())
     {
         // wrap our vtk-m dataset in vtk-h
+        vtkm::cont::DataSet *in_dset = input<vtkm::cont::DataSet>(0);
         conduit::Node *res = new conduit::Node();
-        VTKHDataAdapter::VTKmToBlueprintDataSet(input<vtkm::cont::DataSet>(0), *res);
+        VTKHDataAdapter::VTKmToBlueprintDataSet(in_dset, *res, zero_copy);
+        if(zero_copy)
+        {
+          graph().workspace().registry().add<vtkm::cont::DataSet>(name() + "_zero_copy_input",
+                                                                  in_dset,
+                                                                  1);
+        }
         set_output<conduit::Node>(res);
     }
 #endif
@@ -135,6 +135,18 @@ HolaMPIExtract::verify_params(const conduit::Node &params,
         info["errors"].append() = "Missing required integer parameter 'rank_split'";
     }
 
+    if( params.has_child("balance") &&
+        ! params["balance"].dtype().is_string() )
+    {
+        info["errors"].append() = "Optional parameter 'balance' must be a string ('true' or 'false')";
+    }
+
+    if( params.has_child("balance_threshold") &&
+        ! params["balance_threshold"].dtype().is_number() )
+    {
+        info["errors"].append() = "Optional parameter 'balance_threshold' must be a number";
+    }
+
     return res;
 }
 
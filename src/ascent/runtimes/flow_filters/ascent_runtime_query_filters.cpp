@@ -69,6 +69,8 @@
 #include <flow_graph.hpp>
 #include <flow_workspace.hpp>
 
+#include <sstream>
+
 using namespace conduit;
 using namespace std;
 
@@ -150,7 +152,13 @@ BasicQuery::execute()
     Node *n_input = input<Node>(0);
 
     // The mere act of a query stores the results
-    runtime::expressions::ExpressionEval eval(n_input);
+    // expressions on the same pipeline share field reductions. Trigger
+    // runtimes execute within their parent's execute, so the pipeline
+    // name is qualified by the workspace it belongs to.
+    std::stringstream data_key;
+    data_key << graph().workspace().id() << ":"
+             << graph().edges_in(name()).child(0).as_string();
+    runtime::expressions::ExpressionEval eval(n_input, data_key.str());
     conduit::Node res = eval.evaluate(expression, name);
 }
 
@@ -68,6 +68,7 @@
 
 #include <flow_graph.hpp>
 #include <flow_workspace.hpp>
+#include <flow_trace.hpp>
 
 // mpi related includes
 #ifdef ASCENT_MPI_ENABLED
@@ -77,8 +78,14 @@
 #endif
 
 // std includes
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
 #include <limits>
+#include <mutex>
 #include <set>
+#include <thread>
+#include <vector>
 
 using namespace std;
 using namespace conduit;
@@ -286,6 +293,172 @@ void filter_fields(const conduit::Node &input,
 // -- end ascent::runtime::detail --
 //-----------------------------------------------------------------------------
 
+//-----------------------------------------------------------------------------
+// Background writer for async relay saves. Each entry is a list of files
+// (path, protocol, data) staged by one save. The staged data is owned by
+// the queue, so the simulation can modify its arrays as soon as the save
+// returns. Only file writes happen on the writer thread: all MPI
+// communication is done by the calling thread while staging.
+//-----------------------------------------------------------------------------
+class RelayWriteQueue
+{
+public:
+    RelayWriteQueue()
+    : m_busy(false),
+      m_stop(false),
+      m_max_pending(2)
+    {}
+
+   ~RelayWriteQueue()
+    {
+        flush();
+    }
+
+    // takes ownership of files, blocks while the queue is full
+    void push(Node *files)
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        if(!m_thread.joinable())
+        {
+            m_stop = false;
+            m_thread = std::thread(&RelayWriteQueue::worker, this);
+        }
+        m_cond.wait(lock, [this]{ return (int)m_pending.size() < m_max_pending; });
+        m_pending.push_back(files);
+        m_cond.notify_all();
+    }
+
+    // waits for all queued writes and returns the errors they raised
+    std::string flush()
+    {
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_cond.wait(lock, [this]{ return m_pending.empty() && !m_busy; });
+            m_stop = true;
+        }
+        m_cond.notify_all();
+
+        if(m_thread.joinable())
+        {
+            m_thread.join();
+        }
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = false;
+        std::string errors;
+        errors.swap(m_errors);
+        return errors;
+    }
+
+    // returns (and clears) the errors raised by the writes done so far
+    std::string errors()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        std::string errors;
+        errors.swap(m_errors);
+        return errors;
+    }
+
+    void set_max_pending(int max_pending)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_max_pending = std::max(1, max_pending);
+    }
+
+private:
+    void worker()
+    {
+        while(true)
+        {
+            Node *files = NULL;
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_cond.wait(lock, [this]{ return m_stop || !m_pending.empty(); });
+                if(m_pending.empty())
+                {
+                    return;
+                }
+                files = m_pending.front();
+                m_pending.pop_front();
+                m_busy = true;
+            }
+            // a slot was freed
+            m_cond.notify_all();
+
+            std::string error;
+            try
+            {
+                const int num_files = files->number_of_children();
+                for(int i = 0; i < num_files; ++i)
+                {
+                    const Node &file = files->child(i);
+                    flow::TraceScope trace("relay_write",
+                                           "io",
+                                           file["path"].as_string());
+                    trace.set_bytes(file["data"].total_bytes_compact());
+                    relay::io::save(file["data"],
+                                    file["path"].as_string(),
+                                    file["protocol"].as_string());
+                }
+            }
+            catch(conduit::Error &e)
+            {
+                error = e.message();
+            }
+            delete files;
+
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_busy = false;
+                if(!error.empty())
+                {
+                    m_errors += error + "\n";
+                }
+            }
+            m_cond.notify_all();
+        }
+    }
+
+    std::deque<Node*>       m_pending;
+    std::mutex              m_mutex;
+    std::condition_variable m_cond;
+    std::thread             m_thread;
+    bool                    m_busy;
+    bool                    m_stop;
+    int                     m_max_pending;
+    std::string             m_errors;
+};
+
+RelayWriteQueue &write_queue()
+{
+    static RelayWriteQueue queue;
+    return queue;
+}
+
+//-----------------------------------------------------------------------------
+// writes a file now, or stages a copy of the data when staged is not NULL
+//-----------------------------------------------------------------------------
+void save_file(const Node &data,
+               const std::string &path,
+               const std::string &protocol,
+               Node *staged)
+{
+    // attribute the extracted bytes to the calling filter's trace event
+    flow::TraceScope::add_bytes(data.total_bytes_compact());
+
+    if(staged == NULL)
+    {
+        relay::io::save(data, path, protocol);
+    }
+    else
+    {
+        Node &file = staged->append();
+        file["path"] = path;
+        file["protocol"] = protocol;
+        file["data"].set(data);
+    }
+}
+
 //-----------------------------------------------------------------------------
 // helper shared by io save and load
 //-----------------------------------------------------------------------------
@@ -334,10 +507,150 @@ verify_io_params(const conduit::Node &params,
 }
 
 
+//-----------------------------------------------------------------------------
+// aggregated saves split the ranks into num_files contiguous groups
+//-----------------------------------------------------------------------------
+int file_group(const int rank, const int par_size, const int num_files)
+{
+    return (int)(((long long)rank * num_files) / par_size);
+}
+
+//-----------------------------------------------------------------------------
+// the first rank of each group receives the domains of the other ranks in
+// its group and writes them as the 'domain_%06d' trees of a single
+// 'file_%06d.<protocol>' file. Domain ids are contiguous per rank (see
+// make_domain_ids), so they follow from the number of domains on each rank.
+//-----------------------------------------------------------------------------
+void save_grouped_domains(const Node &multi_dom,
+                          const std::string &output_dir,
+                          const std::string &file_protocol,
+                          const int num_files,
+                          const std::vector<int> &domains_per_rank,
+                          Node *staged)
+{
+    int par_rank = 0;
+    int par_size = 1;
+#ifdef ASCENT_MPI_ENABLED
+    MPI_Comm mpi_comm = MPI_Comm_f2c(Workspace::default_mpi_comm());
+    MPI_Comm_rank(mpi_comm, &par_rank);
+    MPI_Comm_size(mpi_comm, &par_size);
+#endif
+
+    const int num_domains = multi_dom.number_of_children();
+    const int group = file_group(par_rank, par_size, num_files);
+    // lowest rank r with file_group(r) == group
+    const int aggregator = (int)(((long long)group * par_size + num_files - 1) / num_files);
+
+    if(par_rank != aggregator)
+    {
+#ifdef ASCENT_MPI_ENABLED
+        for(int i = 0; i < num_domains; ++i)
+        {
+            mpi::send_using_schema(multi_dom.child(i), aggregator, 0, mpi_comm);
+        }
+#endif
+        return;
+    }
+
+    std::vector<int> domain_offsets(par_size, 0);
+    for(int r = 1; r < par_size; ++r)
+    {
+        domain_offsets[r] = domain_offsets[r-1] + domains_per_rank[r-1];
+    }
+
+    char fmt_buff[64];
+    snprintf(fmt_buff, sizeof(fmt_buff), "%06d", group);
+    ostringstream oss;
+    oss << "file_" << fmt_buff << "." << file_protocol;
+    string output_file = conduit::utils::join_file_path(output_dir,oss.str());
+
+    // hdf5 files are appended to one domain at a time, which bounds the
+    // memory used by the aggregator. Other protocols (and staged saves)
+    // write the group at once.
+    const bool append = file_protocol == "hdf5" && staged == NULL;
+    bool file_exists = false;
+
+    // staged domains are received directly into the staged file
+    Node local_file;
+    Node *file_ptr = &local_file;
+    if(staged != NULL)
+    {
+        Node &file = staged->append();
+        file["path"] = output_file;
+        file["protocol"] = file_protocol;
+        file_ptr = &file["data"];
+    }
+    Node &file_node = *file_ptr;
+
+    for(int i = 0; i < num_domains; ++i)
+    {
+        const Node &dom = multi_dom.child(i);
+        snprintf(fmt_buff, sizeof(fmt_buff), "%06llu",
+                 (unsigned long long) dom["state/domain_id"].to_uint64());
+        Node &tree = file_node["domain_" + std::string(fmt_buff)];
+        if(staged != NULL)
+        {
+            tree.set(dom);
+        }
+        else
+        {
+            tree.set_external(dom);
+        }
+    }
+
+#ifdef ASCENT_MPI_ENABLED
+    for(int r = aggregator + 1;
+        r < par_size && file_group(r, par_size, num_files) == group;
+        ++r)
+    {
+        for(int i = 0; i < domains_per_rank[r]; ++i)
+        {
+            if(append && file_node.number_of_children() > 0)
+            {
+                if(file_exists)
+                {
+                    relay::io::save_merged(file_node, output_file, file_protocol);
+                }
+                else
+                {
+                    relay::io::save(file_node, output_file, file_protocol);
+                    file_exists = true;
+                }
+                file_node.reset();
+            }
+            snprintf(fmt_buff, sizeof(fmt_buff), "%06d", domain_offsets[r] + i);
+            Node &dom = file_node["domain_" + std::string(fmt_buff)];
+            mpi::recv_using_schema(dom, r, 0, mpi_comm);
+        }
+    }
+#endif
+
+    if(staged != NULL)
+    {
+        if(file_node.number_of_children() == 0)
+        {
+            staged->remove(staged->number_of_children() - 1);
+        }
+    }
+    else if(file_node.number_of_children() > 0)
+    {
+        if(file_exists)
+        {
+            relay::io::save_merged(file_node, output_file, file_protocol);
+        }
+        else
+        {
+            relay::io::save(file_node, output_file, file_protocol);
+        }
+    }
+}
+
 //-----------------------------------------------------------------------------
 void mesh_blueprint_save(const Node &data,
                          const std::string &path,
-                         const std::string &file_protocol)
+                         const std::string &file_protocol,
+                         int num_files,
+                         Node *staged)
 {
     // The assumption here is that everything is multi domain
 
@@ -460,44 +773,64 @@ void mesh_blueprint_save(const Node &data,
     {
         ASCENT_ERROR("Error: failed to create directory " << output_dir);
     }
-    // write out each domain
-    for(int i = 0; i < num_domains; ++i)
-    {
-        const Node &dom = multi_dom.child(i);
-        uint64 domain = dom["state/domain_id"].to_uint64();
 
-        snprintf(fmt_buff, sizeof(fmt_buff), "%06llu",domain);
-        oss.str("");
-        oss << "domain_" << fmt_buff << "." << file_protocol;
-        string output_file  = conduit::utils::join_file_path(output_dir,oss.str());
-        relay::io::save(dom, output_file);
+    std::vector<int> domains_per_rank(par_size, num_domains);
+#ifdef ASCENT_MPI_ENABLED
+    MPI_Allgather(&num_domains, 1, MPI_INT,
+                  &domains_per_rank[0], 1, MPI_INT,
+                  mpi_comm);
+#endif
+
+    // groups are made of ranks, so there can't be more files than ranks
+    if(num_files > par_size)
+    {
+        num_files = par_size;
     }
 
-    int root_file_writer = 0;
-    if(num_domains == 0)
+    if(num_files > 0)
     {
-      root_file_writer = -1;
+        save_grouped_domains(multi_dom,
+                             output_dir,
+                             file_protocol,
+                             num_files,
+                             domains_per_rank,
+                             staged);
     }
-#ifdef ASCENT_MPI_ENABLED
+    else
+    {
+        // write out each domain
+        for(int i = 0; i < num_domains; ++i)
+        {
+            const Node &dom = multi_dom.child(i);
+            uint64 domain = dom["state/domain_id"].to_uint64();
+
+            snprintf(fmt_buff, sizeof(fmt_buff), "%06llu",domain);
+            oss.str("");
+            oss << "domain_" << fmt_buff << "." << file_protocol;
+            string output_file  = conduit::utils::join_file_path(output_dir,oss.str());
+            save_file(dom, output_file, file_protocol, staged);
+        }
+    }
+
     // Rank 0 could have an empty domain, so we have to check
     // to find someone with a data set to write out the root file.
-    Node out;
-    out = num_domains;
-    Node rcv;
-
-    mpi::all_gather_using_schema(out, rcv, mpi_comm);
-    root_file_writer = -1;
-    int* res_ptr = (int*)rcv.data_ptr();
+    int root_file_writer = -1;
     for(int i = 0; i < par_size; ++i)
     {
-        if(res_ptr[i] != 0)
+        if(domains_per_rank[i] != 0)
         {
             root_file_writer = i;
             break;
         }
     }
 
-    MPI_Barrier(mpi_comm);
+#ifdef ASCENT_MPI_ENABLED
+    // staged saves write the root file in the background as well, so
+    // there is nothing to wait for
+    if(staged == NULL)
+    {
+        MPI_Barrier(mpi_comm);
+    }
 #endif
 
     if(root_file_writer == -1)
@@ -526,8 +859,17 @@ void mesh_blueprint_save(const Node &data,
                                       output_dir_base,
                                       output_dir_path);
 
-        string output_file_pattern = conduit::utils::join_file_path(output_dir_base,
-                                                                    "domain_%06d." + file_protocol);
+        string output_file_pattern;
+        if(num_files > 0)
+        {
+            output_file_pattern = conduit::utils::join_file_path(output_dir_base,
+                                                                 "file_%06d." + file_protocol);
+        }
+        else
+        {
+            output_file_pattern = conduit::utils::join_file_path(output_dir_base,
+                                                                 "domain_%06d." + file_protocol);
+        }
 
 
         Node root;
@@ -552,14 +894,36 @@ void mesh_blueprint_save(const Node &data,
         root["protocol/name"]    =  file_protocol;
         root["protocol/version"] = "0.4.0";
 
-        root["number_of_files"]  = global_domains;
-        // for now we will save one file per domain, so trees == files
         root["number_of_trees"]  = global_domains;
         // TODO: make sure this is relative
         root["file_pattern"]     = output_file_pattern;
-        root["tree_pattern"]     = "/";
 
-        relay::io::save(root,root_file,file_protocol);
+        if(num_files > 0)
+        {
+            root["number_of_files"]  = num_files;
+            root["tree_pattern"]     = "domain_%06d";
+
+            // file holding each domain, indexed by domain id
+            root["domain_to_file"].set(DataType::int32(global_domains));
+            int32 *domain_to_file = root["domain_to_file"].value();
+            int domain_id = 0;
+            for(int r = 0; r < par_size; ++r)
+            {
+                const int file = file_group(r, par_size, num_files);
+                for(int i = 0; i < domains_per_rank[r]; ++i)
+                {
+                    domain_to_file[domain_id++] = file;
+                }
+            }
+        }
+        else
+        {
+            root["number_of_files"]  = global_domains;
+            // one file per domain, so trees == files
+            root["tree_pattern"]     = "/";
+        }
+
+        save_file(root, root_file, file_protocol, staged);
     }
 }
 
@@ -592,7 +956,38 @@ bool
 RelayIOSave::verify_params(const conduit::Node &params,
                            conduit::Node &info)
 {
-    return verify_io_params(params,info);
+    bool res = verify_io_params(params,info);
+
+    if( params.has_child("num_files") )
+    {
+        if(!params["num_files"].dtype().is_integer() ||
+           params["num_files"].to_int32() < 1)
+        {
+            info["errors"].append() = "optional entry 'num_files' must be a positive integer";
+            res = false;
+        }
+        else
+        {
+            info["info"].append() = "includes 'num_files'";
+        }
+    }
+
+    if( params.has_child("async") )
+    {
+        if(!params["async"].dtype().is_string() ||
+           (params["async"].as_string() != "true" &&
+            params["async"].as_string() != "false"))
+        {
+            info["errors"].append() = "optional entry 'async' must be 'true' or 'false'";
+            res = false;
+        }
+        else
+        {
+            info["info"].append() = "includes 'async'";
+        }
+    }
+
+    return res;
 }
 
 
@@ -614,6 +1009,13 @@ RelayIOSave::execute()
         ASCENT_ERROR("relay_io_save requires a conduit::Node input");
     }
 
+    // aggregate domains into this many files (one file per domain if unset)
+    int num_files = -1;
+    if(params().has_child("num_files"))
+    {
+        num_files = params()["num_files"].to_int32();
+    }
+
     Node *in = input<Node>("in");
     Node selected;
     conduit::Node test;
@@ -643,23 +1045,81 @@ RelayIOSave::execute()
       selected.set_external(*in);
     }
 
-    if(protocol.empty())
+    // report failures of earlier background writes
+    std::string errors = write_queue().errors();
+    if(!errors.empty())
     {
-        conduit::relay::io::save(selected,path);
+        ASCENT_ERROR("relay_io_save: background write failed: "<<errors);
     }
-    else if( protocol == "blueprint/mesh/hdf5")
+
+    // async saves stage copies of the files and return, a background
+    // thread writes them
+    bool async = params().has_child("async") &&
+                 params()["async"].as_string() == "true";
+
+    Node *staged = NULL;
+    if(async)
     {
-        mesh_blueprint_save(selected,path,"hdf5");
+        staged = new Node();
+        staged->set(DataType::list());
     }
-    else if( protocol == "blueprint/mesh/json")
+    else
     {
-        mesh_blueprint_save(selected,path,"json");
+        // the io libraries (hdf5) may not be thread safe, so finish
+        // any background writes first
+        errors = write_queue().flush();
+        if(!errors.empty())
+        {
+            ASCENT_ERROR("relay_io_save: background write failed: "<<errors);
+        }
     }
-    else
+
+    try
+    {
+        if( protocol == "blueprint/mesh/hdf5")
+        {
+            mesh_blueprint_save(selected,path,"hdf5",num_files,staged);
+        }
+        else if( protocol == "blueprint/mesh/json")
+        {
+            mesh_blueprint_save(selected,path,"json",num_files,staged);
+        }
+        else
+        {
+            save_file(selected,path,protocol,staged);
+        }
+    }
+    catch(conduit::Error &e)
     {
-        conduit::relay::io::save(selected,path,protocol);
+        delete staged;
+        throw e;
     }
 
+    if(staged != NULL)
+    {
+        if(staged->number_of_children() > 0)
+        {
+            write_queue().push(staged);
+        }
+        else
+        {
+            delete staged;
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+void
+RelayIOSave::set_max_pending_writes(int max_pending)
+{
+    write_queue().set_max_pending(max_pending);
+}
+
+//-----------------------------------------------------------------------------
+std::string
+RelayIOSave::flush_writes()
+{
+    return write_queue().flush();
 }
 
 
@@ -708,6 +1168,13 @@ RelayIOLoad::execute()
         protocol = params()["protocol"].as_string();
     }
 
+    // make sure async saves of this file are complete
+    std::string errors = write_queue().flush();
+    if(!errors.empty())
+    {
+        ASCENT_ERROR("relay_io_load: background write failed: "<<errors);
+    }
+
     Node *res = new Node();
 
     if(protocol.empty())
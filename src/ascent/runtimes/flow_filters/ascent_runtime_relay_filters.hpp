@@ -89,6 +89,11 @@ public:
     virtual bool   verify_params(const conduit::Node &params,
                                  conduit::Node &info);
     virtual void   execute();
+
+    // max number of async saves queued for the background writer
+    static void        set_max_pending_writes(int max_pending);
+    // waits for all async saves, returns the errors they raised
+    static std::string flush_writes();
 };
 
 //-----------------------------------------------------------------------------
@@ -64,9 +64,11 @@
 // ascent includes
 //-----------------------------------------------------------------------------
 #include <ascent_logging.hpp>
+#include <ascent_png_encoder.hpp>
 #include <ascent_string_utils.hpp>
 #include <flow_graph.hpp>
 #include <flow_workspace.hpp>
+#include <flow_trace.hpp>
 
 // mpi
 #ifdef ASCENT_MPI_ENABLED
@@ -76,8 +78,10 @@
 #if defined(ASCENT_VTKM_ENABLED)
 #include <rover.hpp>
 #include <ray_generators/camera_generator.hpp>
+#include <utils/rover_logging.hpp>
 #include <vtkh/vtkh.hpp>
 #include <vtkh/DataSet.hpp>
+#include <vtkh/utils/vtkm_array_utils.hpp>
 #include <ascent_vtkh_data_adapter.hpp>
 #include <ascent_runtime_conduit_to_vtkm_parsing.hpp>
 #include <ascent_runtime_blueprint_filters.hpp>
@@ -87,6 +91,9 @@
 #include <ascent_mfem_data_adapter.hpp>
 #endif
 
+#include <sstream>
+#include <vector>
+
 
 using namespace conduit;
 using namespace std;
@@ -142,6 +149,125 @@ transmogrify_source(const conduit::Node *n_input, const int ref_level)
   return dataset;
 }
 
+rover::SchedulerType
+parse_scheduler_type(const conduit::Node &params)
+{
+  rover::SchedulerType type = rover::composite_scheduler;
+  if(params.has_path("scheduler") &&
+     params["scheduler"].as_string() == "static")
+  {
+    type = rover::static_scheduler;
+  }
+  return type;
+}
+
+// rover reports the duration of its phases when they finish
+void
+trace_rover_event(const std::string &name,
+                  const std::string &parent,
+                  const double &time)
+{
+  const double duration = time * 1e6;
+  flow::Tracer::record(name,
+                       "rover",
+                       parent,
+                       flow::Tracer::now() - duration,
+                       duration);
+}
+
+bool
+check_compression(const conduit::Node &params,
+                   conduit::Node &info)
+{
+  if(!params.has_child("compression"))
+  {
+    return true;
+  }
+
+  if(!params["compression"].dtype().is_string())
+  {
+    info["errors"].append() = "Optional parameter 'compression' must be a string";
+    return false;
+  }
+
+  std::string compression = params["compression"].as_string();
+  if(compression != "default" &&
+     compression != "fast" &&
+     compression != "none")
+  {
+    info["errors"].append() = "Parameter 'compression' must be "
+                              "'default', 'fast' or 'none'";
+    return false;
+  }
+  return true;
+}
+
+//
+// writes the result of the tracer with ascent's png encoder, so the
+// 'compression' param applies. Energy (xray) results are written as one
+// grey scale image per channel (file_name_<channel>.png) and volume
+// results as one rgba image (file_name.png), like Rover::save_png.
+//
+void
+save_png(Rover &tracer,
+         const conduit::Node &params,
+         const std::string &file_name,
+         const int width,
+         const int height,
+         const bool per_channel)
+{
+#ifdef ASCENT_MPI_ENABLED
+  // the composited result lives on rank 0
+  int rank;
+  MPI_Comm comm = MPI_Comm_f2c(flow::Workspace::default_mpi_comm());
+  MPI_Comm_rank(comm, &rank);
+  if(rank != 0)
+  {
+    return;
+  }
+#endif
+
+  PNGEncoder encoder;
+  if(params.has_child("compression"))
+  {
+    encoder.SetCompression(params["compression"].as_string());
+  }
+
+  Image<vtkm::Float32> image;
+  tracer.get_result(image);
+
+  if(per_channel)
+  {
+    const size_t num_pixels = (size_t) width * height;
+    std::vector<float> rgba(num_pixels * 4);
+    const int num_channels = image.get_num_channels();
+    for(int c = 0; c < num_channels; ++c)
+    {
+      image.normalize_intensity(c);
+      Image<vtkm::Float32>::HandleType intensity = image.get_intensity(c);
+      const vtkm::Float32 *values = vtkh::GetVTKMPointer(intensity);
+      for(size_t i = 0; i < num_pixels; ++i)
+      {
+        rgba[i * 4 + 0] = values[i];
+        rgba[i * 4 + 1] = values[i];
+        rgba[i * 4 + 2] = values[i];
+        rgba[i * 4 + 3] = 1.f;
+      }
+
+      std::ostringstream oss;
+      oss << file_name << "_" << c << ".png";
+      encoder.Encode(&rgba[0], width, height);
+      encoder.Save(oss.str());
+    }
+  }
+  else
+  {
+    Image<vtkm::Float32>::HandleType colors = image.flatten_intensities();
+    encoder.Encode(vtkh::GetVTKMPointer(colors), width, height);
+    encoder.Save(file_name + ".png");
+  }
+}
+
 }// namespace detail
 
 //-----------------------------------------------------------------------------
@@ -207,6 +333,24 @@ RoverXRay::verify_params(const conduit::Node &params,
         res = false;
     }
 
+    if( params.has_child("scheduler") &&
+       ! params["scheduler"].dtype().is_string() )
+    {
+        info["errors"].append() = "Optional parameter 'scheduler' must be a string";
+        res = false;
+    }
+    else if(params.has_child("scheduler"))
+    {
+        std::string scheduler = params["scheduler"].as_string();
+        if(scheduler != "composite" && scheduler != "static")
+        {
+          info["errors"].append() = "Parameter 'scheduler' must be 'composite' or 'static'";
+          res = false;
+        }
+    }
+
+    res = detail::check_compression(params, info) && res;
+
     return res;
 }
 
@@ -235,6 +379,7 @@ RoverXRay::execute()
     CameraGenerator generator(camera, width, height);
 
     Rover tracer;
+    DataLogger::GetInstance()->SetEventCallback(detail::trace_rover_event);
 #ifdef ASCENT_MPI_ENABLED
     int comm_id = flow::Workspace::default_mpi_comm();
     tracer.set_mpi_comm_handle(comm_id);
@@ -267,6 +412,7 @@ RoverXRay::execute()
 
 
     settings.m_render_mode = rover::energy;
+    settings.m_scheduler_type = detail::parse_scheduler_type(params());
 
     tracer.set_render_settings(settings);
     for(int i = 0; i < dataset->GetNumberOfDomains(); ++i)
@@ -287,12 +433,13 @@ RoverXRay::execute()
     std::string filename = params()["filename"].as_string();
     if(cycle != -1)
     {
-      tracer.save_png(expand_family_name(filename, cycle));
+      filename = expand_family_name(filename, cycle);
     }
     else
     {
-      tracer.save_png(expand_family_name(filename));
+      filename = expand_family_name(filename);
     }
+    detail::save_png(tracer, params(), filename, width, height, true);
 
     if(params().has_path("bov_filename"))
     {
@@ -367,6 +514,24 @@ RoverVolume::verify_params(const conduit::Node &params,
         res = false;
     }
 
+    if( params.has_child("scheduler") &&
+       ! params["scheduler"].dtype().is_string() )
+    {
+        info["errors"].append() = "Optional parameter 'scheduler' must be a string";
+        res = false;
+    }
+    else if(params.has_child("scheduler"))
+    {
+        std::string scheduler = params["scheduler"].as_string();
+        if(scheduler != "composite" && scheduler != "static")
+        {
+          info["errors"].append() = "Parameter 'scheduler' must be 'composite' or 'static'";
+          res = false;
+        }
+    }
+
+    res = detail::check_compression(params, info) && res;
+
     return res;
 }
 
@@ -395,6 +560,7 @@ RoverVolume::execute()
     CameraGenerator generator(camera, width, height);
 
     Rover tracer;
+    DataLogger::GetInstance()->SetEventCallback(detail::trace_rover_event);
 #ifdef ASCENT_MPI_ENABLED
     int comm_id =flow::Workspace::default_mpi_comm();
     tracer.set_mpi_comm_handle(comm_id);
@@ -432,6 +598,7 @@ RoverVolume::execute()
     }
 
     settings.m_render_mode = rover::volume;
+    settings.m_scheduler_type = detail::parse_scheduler_type(params());
     if(params().has_path("color_table"))
     {
       settings.m_color_table = parse_color_table(params()["color_table"]);
@@ -464,12 +631,13 @@ RoverVolume::execute()
     std::string filename = params()["filename"].as_string();
     if(cycle != -1)
     {
-      tracer.save_png(expand_family_name(filename, cycle));
+      filename = expand_family_name(filename, cycle);
     }
     else
     {
-      tracer.save_png(expand_family_name(filename));
+      filename = expand_family_name(filename);
     }
+    detail::save_png(tracer, params(), filename, width, height, false);
     tracer.finalize();
 
     //delete dataset;
@@ -64,11 +64,16 @@
 //-----------------------------------------------------------------------------
 #include <ascent_expression_eval.hpp>
 #include <ascent_logging.hpp>
+#include <ascent_main_runtime.hpp>
 #include <ascent_runtime_param_check.hpp>
 
 #include <flow_graph.hpp>
 #include <flow_workspace.hpp>
 
+#include <map>
+#include <mutex>
+#include <sstream>
+
 using namespace conduit;
 using namespace std;
 
@@ -92,6 +97,130 @@ namespace runtime
 namespace filters
 {
 
+//-----------------------------------------------------------------------------
+// -- begin ascent::runtime::filters::detail --
+//-----------------------------------------------------------------------------
+namespace detail
+{
+
+// a child runtime and the parsed actions it executes when a trigger fires.
+// Both are kept between firings, so consecutive firings skip runtime setup,
+// parsing and graph construction.
+struct TriggerRuntime
+{
+  AscentRuntime *m_runtime;
+  conduit::Node  m_actions;
+};
+
+// idle runtimes keyed by mpi comm and actions file. A firing trigger
+// checks its runtime out of the map and returns it when done, so nested
+// or concurrent firings never share a runtime.
+static std::map<std::string, TriggerRuntime*> g_trigger_runtimes;
+static std::mutex g_trigger_runtimes_mutex;
+
+std::string
+trigger_key(const std::string &actions_file)
+{
+  std::stringstream key;
+#ifdef ASCENT_MPI_ENABLED
+  key<<Workspace::default_mpi_comm()<<":";
+#endif
+  key<<actions_file;
+  return key.str();
+}
+
+TriggerRuntime *
+create_trigger_runtime(const std::string &actions_file)
+{
+  if(!conduit::utils::is_file(actions_file))
+  {
+    ASCENT_ERROR("Trigger: actions file '"<<actions_file<<"' does not exist");
+  }
+
+  std::string curr,next;
+  std::string protocol = "json";
+  // if file ends with yaml, use yaml as proto
+  conduit::utils::rsplit_string(actions_file,
+                                ".",
+                                curr,
+                                next);
+  if(curr == "yaml")
+  {
+    protocol = "yaml";
+  }
+
+  Node actions;
+  actions.load(actions_file, protocol);
+
+  Node ascent_opts;
+#ifdef ASCENT_MPI_ENABLED
+  ascent_opts["mpi_comm"] = Workspace::default_mpi_comm();
+#endif
+  AscentRuntime *runtime = new AscentRuntime();
+  runtime->SetChild(true);
+  try
+  {
+    runtime->Initialize(ascent_opts);
+  }
+  catch(conduit::Error &e)
+  {
+    delete runtime;
+    throw e;
+  }
+
+  TriggerRuntime *trigger = new TriggerRuntime();
+  trigger->m_runtime = runtime;
+  trigger->m_actions = actions;
+  return trigger;
+}
+
+TriggerRuntime *
+checkout_trigger_runtime(const std::string &actions_file)
+{
+  const std::string key = trigger_key(actions_file);
+  {
+    std::lock_guard<std::mutex> lock(g_trigger_runtimes_mutex);
+    std::map<std::string, TriggerRuntime*>::iterator itr
+      = g_trigger_runtimes.find(key);
+    if(itr != g_trigger_runtimes.end())
+    {
+      TriggerRuntime *trigger = itr->second;
+      g_trigger_runtimes.erase(itr);
+      return trigger;
+    }
+  }
+  return create_trigger_runtime(actions_file);
+}
+
+void
+release_trigger_runtime(TriggerRuntime *trigger)
+{
+  delete trigger->m_runtime;
+  delete trigger;
+}
+
+void
+checkin_trigger_runtime(const std::string &actions_file,
+                        TriggerRuntime *trigger)
+{
+  const std::string key = trigger_key(actions_file);
+  {
+    std::lock_guard<std::mutex> lock(g_trigger_runtimes_mutex);
+    if(g_trigger_runtimes.find(key) == g_trigger_runtimes.end())
+    {
+      g_trigger_runtimes[key] = trigger;
+      return;
+    }
+  }
+  // another firing already returned a runtime for this file
+  release_trigger_runtime(trigger);
+}
+
+};
+//-----------------------------------------------------------------------------
+// -- end ascent::runtime::filters::detail --
+//-----------------------------------------------------------------------------
+
 
 //-----------------------------------------------------------------------------
 BasicTrigger::BasicTrigger()
@@ -143,12 +272,17 @@ BasicTrigger::execute()
 
     std::string expression = params()["condition"].as_string();
     std::string actions_file = params()["actions_file"].as_string();
-    conduit::Node actions;
 
     Node v_info;
     Node *n_input = input<Node>(0);
 
-    runtime::expressions::ExpressionEval eval(n_input);
+    // expressions on the same pipeline share field reductions. Trigger
+    // runtimes execute within their parent's execute, so the pipeline
+    // name is qualified by the workspace it belongs to.
+    std::stringstream data_key;
+    data_key << graph().workspace().id() << ":"
+             << graph().edges_in(name()).child(0).as_string();
+    runtime::expressions::ExpressionEval eval(n_input, data_key.str());
     conduit::Node res = eval.evaluate(expression);
 
     if(res["type"].as_string() != "bool")
@@ -159,18 +293,46 @@ BasicTrigger::execute()
     bool fire = res["value"].to_uint8() != 0;
     if(fire)
     {
-      Ascent ascent;
+      detail::TriggerRuntime *trigger =
+        detail::checkout_trigger_runtime(actions_file);
+
+      // the input is the parent's published tree, so it is handed to the
+      // child runtime as is instead of being published again
+      trigger->m_runtime->PublishSource(n_input);
+      try
+      {
+        trigger->m_runtime->Execute(trigger->m_actions);
+      }
+      catch(conduit::Error &e)
+      {
+        std::stringstream msg;
+        msg << "[Error] Ascent::execute "
+            << e.message() << std::endl;
+        trigger->m_runtime->DisplayError(msg.str());
+        // start from a clean runtime the next time the trigger fires
+        detail::release_trigger_runtime(trigger);
+        return;
+      }
+      detail::checkin_trigger_runtime(actions_file, trigger);
+    }
+}
 
-      Node ascent_opts;
-      ascent_opts["runtime/type"] = "ascent";
-#ifdef ASCENT_MPI_ENABLED
-      ascent_opts["mpi_comm"] = Workspace::default_mpi_comm();
-#endif
-      ascent_opts["actions_file"] = actions_file;
-      ascent.open(ascent_opts);
-      ascent.publish(*n_input);
-      ascent.execute(actions);
-      ascent.close();
+//-----------------------------------------------------------------------------
+void
+BasicTrigger::reset_runtimes()
+{
+    std::map<std::string, detail::TriggerRuntime*> runtimes;
+    {
+      std::lock_guard<std::mutex> lock(detail::g_trigger_runtimes_mutex);
+      runtimes.swap(detail::g_trigger_runtimes);
+    }
+
+    // released outside of the lock, since the runtimes clean up
+    // their own triggers as well
+    std::map<std::string, detail::TriggerRuntime*>::iterator itr;
+    for(itr = runtimes.begin(); itr != runtimes.end(); ++itr)
+    {
+      detail::release_trigger_runtime(itr->second);
     }
 }
 
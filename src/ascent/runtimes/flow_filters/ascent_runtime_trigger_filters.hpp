@@ -92,6 +92,9 @@ public:
     virtual bool   verify_params(const conduit::Node &params,
                                  conduit::Node &info);
     virtual void   execute();
+
+    // releases the runtimes kept alive for firing triggers
+    static void    reset_runtimes();
 };
 
 
@@ -65,6 +65,7 @@
 #include <ascent_logging.hpp>
 #include <ascent_string_utils.hpp>
 #include <ascent_runtime_param_check.hpp>
+#include <ascent_image_channel.hpp>
 #include <flow_graph.hpp>
 #include <flow_workspace.hpp>
 
@@ -73,6 +74,10 @@
 #include <mpi.h>
 #endif
 
+#include <algorithm>
+#include <map>
+#include <mutex>
+
 #if defined(ASCENT_VTKM_ENABLED)
 #include <vtkh/vtkh.hpp>
 #include <vtkh/DataSet.hpp>
@@ -102,10 +107,6 @@
 #include <ascent_runtime_conduit_to_vtkm_parsing.hpp>
 #endif
 
-#include <stdio.h>
-#include <chrono>
-#include <sys/time.h>
-
 using namespace conduit;
 using namespace std;
 
@@ -193,6 +194,7 @@ check_renders_surprises(const conduit::Node &renders_node)
   r_valid_paths.push_back("phi");
   r_valid_paths.push_back("theta");
   r_valid_paths.push_back("db_name");
+  r_valid_paths.push_back("batch_size");
   r_valid_paths.push_back("render_bg");
   r_valid_paths.push_back("annotations");
   r_valid_paths.push_back("output_path");
@@ -211,6 +213,9 @@ check_renders_surprises(const conduit::Node &renders_node)
 // pipeline results (data sets) would be deleted before
 // the Scene can be executed.
 //
+// Persistent renderers are owned by the renderer cache,
+// so the registry does not track (and release) them.
+//
 class RendererContainer
 {
 protected:
@@ -221,12 +226,13 @@ protected:
 public:
   RendererContainer(std::string key,
                     flow::Registry *r,
-                    vtkh::Renderer *renderer)
+                    vtkh::Renderer *renderer,
+                    bool persistent = false)
     : m_key(key),
       m_registry(r)
   {
     m_data_set_key = m_key + "_dset";
-    m_registry->add<vtkh::Renderer>(m_key,renderer,1);
+    m_registry->add<vtkh::Renderer>(m_key,renderer,persistent ? -1 : 1);
     m_registry->add<vtkh::DataSet>(m_data_set_key, renderer->GetInput(),1);
   }
 
@@ -269,24 +275,58 @@ public:
     m_renderer_count++;
   }
 
-  void Execute(std::vector<vtkh::Render> &renders)
+  // batches splits the renders into groups, in order, as pairs of
+  // (number of renders, batch size). The batch size is the number of
+  // renders vtk-h traces and composites together, 0 keeps the vtk-h
+  // default. Renders not covered by a group use the default.
+  void Execute(std::vector<vtkh::Render> &renders,
+               const std::vector<std::pair<int,int>> &batches
+                 = std::vector<std::pair<int,int>>())
   {
-    vtkh::Scene scene;
+    std::vector<vtkh::Renderer*> renderers;
     for(int i = 0; i < m_renderer_count; i++)
     {
       ostringstream oss;
       oss << "key_" << i;
-      vtkh::Renderer * r = m_registry->fetch<RendererContainer>(oss.str())->Fetch();
-      scene.AddRenderer(r);
+      renderers.push_back(m_registry->fetch<RendererContainer>(oss.str())->Fetch());
     }
 
-    size_t num_renders = renders.size();
-    for(size_t i = 0; i < num_renders; ++i)
+    const size_t num_renders = renders.size();
+    size_t offset = 0;
+    for(size_t b = 0; b <= batches.size() && offset < num_renders; ++b)
     {
-      scene.AddRender(renders[i]);
-    }
+      size_t count = num_renders - offset;
+      int batch_size = 0;
+      if(b < batches.size())
+      {
+        count = std::min(count, (size_t)std::max(batches[b].first, 0));
+        batch_size = batches[b].second;
+      }
+
+      if(count == 0)
+      {
+        continue;
+      }
+
+      vtkh::Scene scene;
+      if(batch_size > 0)
+      {
+        scene.SetRenderBatchSize(batch_size);
+      }
+
+      for(size_t r = 0; r < renderers.size(); ++r)
+      {
+        scene.AddRenderer(renderers[r]);
+      }
 
-    scene.Render();
+      for(size_t i = offset; i < offset + count; ++i)
+      {
+        scene.AddRender(renders[i]);
+      }
+
+      scene.Render();
+      offset += count;
+    }
 
     for(int i=0; i < m_renderer_count; i++)
     {
@@ -297,6 +337,50 @@ public:
   }
 }; // Ascent Scene
 
+//-----------------------------------------------------------------------------
+// Renderers kept between executes, keyed by workspace and plot name.
+// A renderer is reused while its plot type and parameters are unchanged,
+// so the renderer and its vtk-m mapper (ray buffers, canvases,
+// compositor) are not rebuilt every cycle.
+//-----------------------------------------------------------------------------
+struct PersistentRenderer
+{
+  vtkh::Renderer *m_renderer;
+  std::string     m_type;
+  bool            m_is_point_mesh;
+  conduit::Node   m_params;
+  // "created", "reused" or "rebuilt" for the last execute
+  std::string     m_status;
+  int             m_reuse_count;
+};
+
+static std::map<std::string, PersistentRenderer> g_renderers;
+static std::mutex g_renderers_mutex;
+
+std::string
+renderer_key(const flow::Workspace *w, const std::string &plot_name)
+{
+  std::ostringstream oss;
+  oss << w << "/" << plot_name;
+  return oss.str();
+}
+
+// the plot name of a key made by renderer_key, if the key
+// belongs to w
+bool
+renderer_key_plot_name(const flow::Workspace *w,
+                       const std::string &key,
+                       std::string &plot_name)
+{
+  std::string prefix = renderer_key(w, "");
+  if(key.compare(0, prefix.size(), prefix) != 0)
+  {
+    return false;
+  }
+  plot_name = key.substr(prefix.size());
+  return true;
+}
+
 //-----------------------------------------------------------------------------
 
 vtkh::Render parse_render(const conduit::Node &render_node,
@@ -509,19 +593,23 @@ public:
                                                tmp_name);
     const int num_renders = m_image_names.size();
 
+    renders->reserve(renders->size() + num_renders);
+
     for(int i = 0; i < num_renders; ++i)
     {
       std::string image_name = conduit::utils::join_file_path(m_image_path , m_image_names[i]);
 
       render.SetImageName(image_name);
 
+      // copy, so the zoom does not accumulate across cycles
+      vtkm::rendering::Camera camera = m_cameras[i];
       if(!zoom.dtype().is_empty())
       {
         // Allow default zoom to be overridden
-        m_cameras[i].Zoom(zoom.to_float32());
+        camera.Zoom(zoom.to_float32());
       }
 
-      render.SetCamera(m_cameras[i]);
+      render.SetCamera(camera);
       renders->push_back(render);
     }
   }
@@ -737,27 +825,6 @@ std::map<std::string, CinemaManager> CinemaDatabases::m_databases;
 // -- end namespace detail --
 //-----------------------------------------------------------------------------
 
-static std::ofstream *timingInfo = NULL;    
-void RecordTime(const std::string &nm, double time)
-{
-    int rank = 0, numRanks = 0;
-#ifdef ASCENT_MPI_ENABLED
-    MPI_Comm mpi_comm = MPI_Comm_f2c(Workspace::default_mpi_comm());
-    MPI_Comm_rank(mpi_comm, &rank);
-    MPI_Comm_size(mpi_comm, &numRanks);
-#endif
-    
-    if (timingInfo == NULL)
-    {
-        timingInfo = new ofstream;
-        char nm[32];
-        sprintf(nm, "timing.%d.out", rank);
-        timingInfo->open(nm, ofstream::out);
-    }
-    (*timingInfo)<<"ASCENT_"<<nm<<"_"<<rank<<"_"<<numRanks<<" "<<time<<endl;
-    //cout<<nm<<" rank "<<rank<<" time "<<time<<endl;
-}
-
 //-----------------------------------------------------------------------------
 EnsureVTKH::EnsureVTKH()
 :Filter()
@@ -778,6 +845,8 @@ EnsureVTKH::declare_interface(Node &i)
     i["type_name"]   = "ensure_vtkh";
     i["port_names"].append() = "in";
     i["output_port"] = "true";
+    i["cacheable"]   = "true";
+    i["field_usage"] = "params";
 }
 
 //-----------------------------------------------------------------------------
@@ -842,6 +911,8 @@ VTKHMarchingCubes::declare_interface(Node &i)
     i["type_name"]   = "vtkh_marchingcubes";
     i["port_names"].append() = "in";
     i["output_port"] = "true";
+    i["cacheable"]   = "true";
+    i["field_usage"] = "params";
 }
 
 //-----------------------------------------------------------------------------
@@ -881,8 +952,6 @@ VTKHMarchingCubes::verify_params(const conduit::Node &params,
 void
 VTKHMarchingCubes::execute()
 {
-    auto startT = std::chrono::steady_clock::now();
-
     if(!input(0).check_type<vtkh::DataSet>())
     {
         ASCENT_ERROR("vtkh_marchingcubes input must be a vtk-h dataset");
@@ -916,8 +985,6 @@ VTKHMarchingCubes::execute()
 
     vtkh::DataSet *iso_output = marcher.GetOutput();
     set_output<vtkh::DataSet>(iso_output);
-
-    RecordTime("ContourFilter", std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now()-startT).count());
 }
 
 //-----------------------------------------------------------------------------
@@ -940,6 +1007,8 @@ VTKHVectorMagnitude::declare_interface(Node &i)
     i["type_name"]   = "vtkh_vector_magnitude";
     i["port_names"].append() = "in";
     i["output_port"] = "true";
+    i["cacheable"]   = "true";
+    i["field_usage"] = "params";
 }
 
 //-----------------------------------------------------------------------------
@@ -970,8 +1039,6 @@ VTKHVectorMagnitude::verify_params(const conduit::Node &params,
 void
 VTKHVectorMagnitude::execute()
 {
-    auto startT = std::chrono::steady_clock::now();
-
     if(!input(0).check_type<vtkh::DataSet>())
     {
         ASCENT_ERROR("vtkh_vector_magnitude input must be a vtk-h dataset");
@@ -994,8 +1061,6 @@ VTKHVectorMagnitude::execute()
 
     vtkh::DataSet *mag_output = mag.GetOutput();
     set_output<vtkh::DataSet>(mag_output);
-
-    RecordTime("VectorMagnitudeFilter", std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now()-startT).count());
 }
 
 
@@ -1052,8 +1117,6 @@ VTKHStreamline::verify_params(const conduit::Node &params,
 void
 VTKHStreamline::execute()
 {
-    auto startT = std::chrono::steady_clock::now();
-
     //ASCENT_INFO("We be streamlining");
     if(!input(0).check_type<vtkh::DataSet>())
     {
@@ -1117,8 +1180,6 @@ VTKHStreamline::execute()
     streamline.Update();
     streamline_output = streamline.GetOutput();
     set_output<vtkh::DataSet>(streamline_output);
-
-    RecordTime("StreamlineFilter", std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now()-startT).count());
 }
 
 
@@ -1142,6 +1203,8 @@ VTKH3Slice::declare_interface(Node &i)
     i["type_name"]   = "vtkh_3slice";
     i["port_names"].append() = "in";
     i["output_port"] = "true";
+    i["cacheable"]   = "true";
+    i["field_usage"] = "params";
 }
 
 //-----------------------------------------------------------------------------
@@ -1178,8 +1241,6 @@ VTKH3Slice::verify_params(const conduit::Node &params,
 void
 VTKH3Slice::execute()
 {
-    auto startT = std::chrono::steady_clock::now();
-
     if(!input(0).check_type<vtkh::DataSet>())
     {
         ASCENT_ERROR("vtkh_3slice input must be a vtk-h dataset");
@@ -1245,8 +1306,6 @@ VTKH3Slice::execute()
     vtkh::DataSet *slice_output = slicer.GetOutput();
 
     set_output<vtkh::DataSet>(slice_output);
-
-    RecordTime("ThreeSliceFilter", std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now()-startT).count());
 }
 
 //-----------------------------------------------------------------------------
@@ -1269,6 +1328,8 @@ VTKHSlice::declare_interface(Node &i)
     i["type_name"]   = "vtkh_slice";
     i["port_names"].append() = "in";
     i["output_port"] = "true";
+    i["cacheable"]   = "true";
+    i["field_usage"] = "params";
 }
 
 //-----------------------------------------------------------------------------
@@ -1308,8 +1369,6 @@ VTKHSlice::verify_params(const conduit::Node &params,
 void
 VTKHSlice::execute()
 {
-    auto startT = std::chrono::steady_clock::now();
-
     if(!input(0).check_type<vtkh::DataSet>())
     {
         ASCENT_ERROR("vtkh_slice input must be a vtk-h dataset");
@@ -1337,8 +1396,6 @@ VTKHSlice::execute()
     vtkh::DataSet *slice_output = slicer.GetOutput();
 
     set_output<vtkh::DataSet>(slice_output);
-
-    RecordTime("SliceFilter", std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now()-startT).count());
 }
 
 //-----------------------------------------------------------------------------
@@ -1361,6 +1418,8 @@ VTKHGhostStripper::declare_interface(Node &i)
     i["type_name"]   = "vtkh_ghost_stripper";
     i["port_names"].append() = "in";
     i["output_port"] = "true";
+    i["cacheable"]   = "true";
+    i["field_usage"] = "params";
 }
 
 //-----------------------------------------------------------------------------
@@ -1455,6 +1514,8 @@ VTKHThreshold::declare_interface(Node &i)
     i["type_name"]   = "vtkh_threshold";
     i["port_names"].append() = "in";
     i["output_port"] = "true";
+    i["cacheable"]   = "true";
+    i["field_usage"] = "params";
 }
 
 //-----------------------------------------------------------------------------
@@ -1489,8 +1550,6 @@ VTKHThreshold::verify_params(const conduit::Node &params,
 void
 VTKHThreshold::execute()
 {
-    auto startT = std::chrono::steady_clock::now();
-
     if(!input(0).check_type<vtkh::DataSet>())
     {
         ASCENT_ERROR("VTKHThresholds input must be a vtk-h dataset");
@@ -1518,8 +1577,6 @@ VTKHThreshold::execute()
     vtkh::DataSet *thresh_output = thresher.GetOutput();
 
     set_output<vtkh::DataSet>(thresh_output);
-
-    RecordTime("ThresholdFilter", std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now()-startT).count());
 }
 
 //-----------------------------------------------------------------------------
@@ -1583,8 +1640,6 @@ DefaultRender::verify_params(const conduit::Node &params,
 void
 DefaultRender::execute()
 {
-    auto startT = std::chrono::steady_clock::now();
-
     if(!input(0).check_type<vtkm::Bounds>())
     {
       ASCENT_ERROR("'a' input must be a vktm::Bounds * instance");
@@ -1709,8 +1764,6 @@ DefaultRender::execute()
       renders->push_back(render);
     }
     set_output<std::vector<vtkh::Render>>(renders);
-
-    RecordTime("DefaultRender", std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now()-startT).count());    
 }
 
 //-----------------------------------------------------------------------------
@@ -1733,6 +1786,8 @@ VTKHClip::declare_interface(Node &i)
     i["type_name"] = "vtkh_clip";
     i["port_names"].append() = "in";
     i["output_port"] = "true";
+    i["cacheable"]   = "true";
+    i["field_usage"] = "params";
 }
 
 //-----------------------------------------------------------------------------
@@ -1831,8 +1886,6 @@ VTKHClip::verify_params(const conduit::Node &params,
 void
 VTKHClip::execute()
 {
-    auto startT = std::chrono::steady_clock::now();
-
     if(!input(0).check_type<vtkh::DataSet>())
     {
         ASCENT_ERROR("VTKHClip input must be a vtk-h dataset");
@@ -1895,8 +1948,6 @@ VTKHClip::execute()
     vtkh::DataSet *clip_output = clipper.GetOutput();
 
     set_output<vtkh::DataSet>(clip_output);
-
-    RecordTime("ClipFilter", std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now()-startT).count());    
 }
 
 //-----------------------------------------------------------------------------
@@ -1919,6 +1970,8 @@ VTKHClipWithField::declare_interface(Node &i)
     i["type_name"] = "vtkh_clip_with_field";
     i["port_names"].append() = "in";
     i["output_port"] = "true";
+    i["cacheable"]   = "true";
+    i["field_usage"] = "params";
 }
 
 //-----------------------------------------------------------------------------
@@ -1951,8 +2004,6 @@ VTKHClipWithField::verify_params(const conduit::Node &params,
 void
 VTKHClipWithField::execute()
 {
-    auto startT = std::chrono::steady_clock::now();
-
     if(!input(0).check_type<vtkh::DataSet>())
     {
         ASCENT_ERROR("VTKHClipWithField input must be a vtk-h dataset");
@@ -1984,8 +2035,6 @@ VTKHClipWithField::execute()
     vtkh::DataSet *clip_output = clipper.GetOutput();
 
     set_output<vtkh::DataSet>(clip_output);
-
-    RecordTime("ClipWithFieldFilter", std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now()-startT).count());    
 }
 
 //-----------------------------------------------------------------------------
@@ -2008,6 +2057,8 @@ VTKHIsoVolume::declare_interface(Node &i)
     i["type_name"] = "vtkh_iso_volume";
     i["port_names"].append() = "in";
     i["output_port"] = "true";
+    i["cacheable"]   = "true";
+    i["field_usage"] = "params";
 }
 
 //-----------------------------------------------------------------------------
@@ -2041,8 +2092,6 @@ VTKHIsoVolume::verify_params(const conduit::Node &params,
 void
 VTKHIsoVolume::execute()
 {
-    auto startT = std::chrono::steady_clock::now();
-
     if(!input(0).check_type<vtkh::DataSet>())
     {
         ASCENT_ERROR("VTKHIsoVolume input must be a vtk-h dataset");
@@ -2066,8 +2115,6 @@ VTKHIsoVolume::execute()
     vtkh::DataSet *clip_output = clipper.GetOutput();
 
     set_output<vtkh::DataSet>(clip_output);
-
-    RecordTime("IsoVolumeFilter", std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now()-startT).count());    
 }
 
 
@@ -2141,6 +2188,7 @@ VTKHBounds::declare_interface(Node &i)
     i["type_name"] = "vtkh_bounds";
     i["port_names"].append() = "in";
     i["output_port"] = "true";
+    i["field_usage"] = "params";
 }
 
 
@@ -2148,8 +2196,6 @@ VTKHBounds::declare_interface(Node &i)
 void
 VTKHBounds::execute()
 {
-    auto startT = std::chrono::steady_clock::now();
-
     vtkm::Bounds *bounds = new vtkm::Bounds;
 
     if(!input(0).check_type<vtkh::DataSet>())
@@ -2160,8 +2206,6 @@ VTKHBounds::execute()
     vtkh::DataSet *data = input<vtkh::DataSet>(0);
     bounds->Include(data->GetGlobalBounds());
     set_output<vtkm::Bounds>(bounds);
-
-    RecordTime("Bounds", std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now()-startT).count());
 }
 
 
@@ -2186,6 +2230,7 @@ VTKHUnionBounds::declare_interface(Node &i)
     i["port_names"].append() = "a";
     i["port_names"].append() = "b";
     i["output_port"] = "true";
+    i["field_usage"] = "params";
 }
 
 
@@ -2193,8 +2238,6 @@ VTKHUnionBounds::declare_interface(Node &i)
 void
 VTKHUnionBounds::execute()
 {
-    auto startT = std::chrono::steady_clock::now();
-
     if(!input(0).check_type<vtkm::Bounds>())
     {
         ASCENT_ERROR("'a' must be a vtkm::Bounds * instance");
@@ -2213,8 +2256,6 @@ VTKHUnionBounds::execute()
     result->Include(*bounds_a);
     result->Include(*bounds_b);
     set_output<vtkm::Bounds>(result);
-
-    RecordTime("UnionBounds", std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now()-startT).count());
 }
 
 
@@ -2239,6 +2280,7 @@ VTKHDomainIds::declare_interface(Node &i)
     i["type_name"] = "vtkh_domain_ids";
     i["port_names"].append() = "in";
     i["output_port"] = "true";
+    i["field_usage"] = "params";
 }
 
 
@@ -2246,8 +2288,6 @@ VTKHDomainIds::declare_interface(Node &i)
 void
 VTKHDomainIds::execute()
 {
-    auto startT = std::chrono::steady_clock::now();
-
     if(!input(0).check_type<vtkh::DataSet>())
     {
         ASCENT_ERROR("'in' must be a vtk-h dataset");
@@ -2261,8 +2301,6 @@ VTKHDomainIds::execute()
     result->insert(domain_ids.begin(), domain_ids.end());
 
     set_output<std::set<vtkm::Id> >(result);
-
-    RecordTime("DomainIDs", std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now()-startT).count());
 }
 
 
@@ -2288,14 +2326,13 @@ VTKHUnionDomainIds::declare_interface(Node &i)
     i["port_names"].append() = "a";
     i["port_names"].append() = "b";
     i["output_port"] = "true";
+    i["field_usage"] = "params";
 }
 
 //-----------------------------------------------------------------------------
 void
 VTKHUnionDomainIds::execute()
 {
-    auto startT = std::chrono::steady_clock::now();
-
     if(!input(0).check_type<std::set<vtkm::Id> >())
     {
         ASCENT_ERROR("'a' must be a std::set<vtkm::Id> * instance");
@@ -2316,8 +2353,6 @@ VTKHUnionDomainIds::execute()
     result->insert(dids_b->begin(), dids_b->end());
 
     set_output<std::set<vtkm::Id>>(result);
-
-    RecordTime("UnionIDs", std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now()-startT).count());
 }
 
 //-----------------------------------------------------------------------------
@@ -2341,6 +2376,7 @@ AddPlot::declare_interface(Node &i)
     i["port_names"].append() = "scene";
     i["port_names"].append() = "plot";
     i["output_port"] = "true";
+    i["field_usage"] = "params";
 }
 
 //-----------------------------------------------------------------------------
@@ -2383,6 +2419,7 @@ CreatePlot::declare_interface(Node &i)
     i["type_name"] = "create_plot";
     i["port_names"].append() = "a";
     i["output_port"] = "true";
+    i["field_usage"] = "params";
 }
 
 
@@ -2449,8 +2486,6 @@ CreatePlot::verify_params(const conduit::Node &params,
 void
 CreatePlot::execute()
 {
-    auto startT = std::chrono::steady_clock::now();
-
     if(!input(0).check_type<vtkh::DataSet>())
     {
         ASCENT_ERROR("create_plot input must be a vtk-h dataset");
@@ -2467,10 +2502,49 @@ CreatePlot::execute()
     }
 
     vtkh::Renderer *renderer = nullptr;
+    bool is_point_mesh = type == "pseudocolor" && data->IsPointMesh();
+
+    //
+    // reuse the renderer this plot had in the last execute if its
+    // type and params are unchanged. the input, field and range are
+    // applied every cycle, since they change with the data.
+    //
+    const std::string cache_key = detail::renderer_key(&graph().workspace(),
+                                                       this->name());
+    bool reused = false;
+    bool rebuilt = false;
+    {
+      std::lock_guard<std::mutex> lock(detail::g_renderers_mutex);
+      std::map<std::string,detail::PersistentRenderer>::iterator itr;
+      itr = detail::g_renderers.find(cache_key);
+      if(itr != detail::g_renderers.end())
+      {
+        detail::PersistentRenderer &cached = itr->second;
+        Node n_diff_info;
+        if(cached.m_type == type &&
+           cached.m_is_point_mesh == is_point_mesh &&
+           !cached.m_params.diff(plot_params, n_diff_info))
+        {
+          renderer = cached.m_renderer;
+          cached.m_status = "reused";
+          cached.m_reuse_count++;
+          reused = true;
+        }
+        else
+        {
+          delete cached.m_renderer;
+          detail::g_renderers.erase(itr);
+          rebuilt = true;
+        }
+      }
+    }
 
-    if(type == "pseudocolor")
+    if(reused)
+    {
+      // nothing to configure
+    }
+    else if(type == "pseudocolor")
     {
-      bool is_point_mesh = data->IsPointMesh();
       if(is_point_mesh)
       {
         vtkh::PointRenderer *p_renderer = new vtkh::PointRenderer();
@@ -2517,7 +2591,7 @@ CreatePlot::execute()
     }
 
     // get the plot params
-    if(plot_params.has_path("color_table"))
+    if(!reused && plot_params.has_path("color_table"))
     {
       vtkm::cont::ColorTable color_table =  parse_color_table(plot_params["color_table"]);
       renderer->SetColorTable(color_table);
@@ -2582,12 +2656,70 @@ CreatePlot::execute()
 
     renderer->SetInput(data);
 
+    if(!reused)
+    {
+      std::lock_guard<std::mutex> lock(detail::g_renderers_mutex);
+      detail::PersistentRenderer &cached = detail::g_renderers[cache_key];
+      cached.m_renderer = renderer;
+      cached.m_type = type;
+      cached.m_is_point_mesh = is_point_mesh;
+      cached.m_params.set(plot_params);
+      cached.m_status = rebuilt ? "rebuilt" : "created";
+      cached.m_reuse_count = 0;
+    }
+
     detail::RendererContainer *container = new detail::RendererContainer(key,
                                                                          &graph().workspace().registry(),
-                                                                         renderer);
+                                                                         renderer,
+                                                                         true);
     set_output<detail::RendererContainer>(container);
+}
 
-    RecordTime("RenderPlot", std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now()-startT).count());
+//-----------------------------------------------------------------------------
+void
+CreatePlot::release_renderers(const flow::Workspace &w,
+                              const std::set<std::string> &keep)
+{
+    std::lock_guard<std::mutex> lock(detail::g_renderers_mutex);
+    std::map<std::string,detail::PersistentRenderer>::iterator itr;
+    itr = detail::g_renderers.begin();
+    while(itr != detail::g_renderers.end())
+    {
+      std::string plot_name;
+      if(detail::renderer_key_plot_name(&w, itr->first, plot_name) &&
+         keep.find(plot_name) == keep.end())
+      {
+        delete itr->second.m_renderer;
+        detail::g_renderers.erase(itr++);
+      }
+      else
+      {
+        ++itr;
+      }
+    }
+}
+
+//-----------------------------------------------------------------------------
+void
+CreatePlot::renderer_info(const flow::Workspace &w,
+                          conduit::Node &info)
+{
+    info.reset();
+    std::lock_guard<std::mutex> lock(detail::g_renderers_mutex);
+    std::map<std::string,detail::PersistentRenderer>::iterator itr;
+    for(itr = detail::g_renderers.begin();
+        itr != detail::g_renderers.end();
+        ++itr)
+    {
+      std::string plot_name;
+      if(detail::renderer_key_plot_name(&w, itr->first, plot_name))
+      {
+        Node &n_plot = info[plot_name];
+        n_plot["type"] = itr->second.m_type;
+        n_plot["status"] = itr->second.m_status;
+        n_plot["reuse_count"] = itr->second.m_reuse_count;
+      }
+    }
 }
 
 
@@ -2606,6 +2738,7 @@ CreateScene::declare_interface(Node &i)
 {
     i["type_name"]   = "create_scene";
     i["output_port"] = "true";
+    i["field_usage"] = "params";
     i["port_names"] = DataType::empty();
 }
 
@@ -2638,14 +2771,53 @@ ExecScene::declare_interface(conduit::Node &i)
     i["port_names"].append() = "scene";
     i["port_names"].append() = "renders";
     i["output_port"] = "false";
+    i["field_usage"] = "params";
+}
+
+//-----------------------------------------------------------------------------
+bool
+ExecScene::verify_params(const conduit::Node &params,
+                         conduit::Node &info)
+{
+    info.reset();
+    bool res = true;
+
+    std::vector<std::string> valid_paths;
+    std::vector<std::string> ignore_paths;
+    ignore_paths.push_back("batches");
+
+    std::string surprises = surprise_check(valid_paths, ignore_paths, params);
+
+    if(params.has_path("batches"))
+    {
+      std::vector<std::string> b_valid_paths;
+      b_valid_paths.push_back("count");
+      b_valid_paths.push_back("batch_size");
+
+      const conduit::Node &batches = params["batches"];
+      const int num_batches = batches.number_of_children();
+      for(int i = 0; i < num_batches; ++i)
+      {
+        const conduit::Node &batch = batches.child(i);
+        res = check_numeric("count", batch, info, true) && res;
+        res = check_numeric("batch_size", batch, info, true) && res;
+        surprises += surprise_check(b_valid_paths, batch);
+      }
+    }
+
+    if(surprises != "")
+    {
+      res = false;
+      info["errors"].append() = surprises;
+    }
+
+    return res;
 }
 
 //-----------------------------------------------------------------------------
 void
 ExecScene::execute()
 {
-    auto startT = std::chrono::steady_clock::now();
-
     if(!input(0).check_type<detail::AscentScene>())
     {
         ASCENT_ERROR("'scene' must be a AscentScene * instance");
@@ -2658,9 +2830,19 @@ ExecScene::execute()
 
     detail::AscentScene *scene = input<detail::AscentScene>(0);
     std::vector<vtkh::Render> * renders = input<std::vector<vtkh::Render>>(1);
-    scene->Execute(*renders);
 
-    RecordTime("ExecScene", std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now()-startT).count());
+    std::vector<std::pair<int,int>> batches;
+    if(params().has_path("batches"))
+    {
+      const conduit::Node &n_batches = params()["batches"];
+      for(int i = 0; i < n_batches.number_of_children(); ++i)
+      {
+        batches.push_back(std::make_pair(n_batches.child(i)["count"].to_int32(),
+                                         n_batches.child(i)["batch_size"].to_int32()));
+      }
+    }
+
+    scene->Execute(*renders, batches);
 
     // the images should exist now so add them to the image list
     // this can be used for the web server or jupyter
@@ -2672,11 +2854,34 @@ ExecScene::execute()
     }
 
     conduit::Node *image_list = graph().workspace().registry().fetch<Node>("image_list");
+
+    Node * meta = graph().workspace().registry().fetch<Node>("metadata");
+    int cycle = 0;
+    if(meta->has_path("cycle"))
+    {
+      cycle = (*meta)["cycle"].as_int32();
+    }
+
+    const bool publish = ImageChannel::Enabled() && vtkh::GetMPIRank() == 0;
+
     for(int i = 0; i < renders->size(); ++i)
     {
       const std::string image_name = renders->at(i).GetImageName() + ".png";
+      if(publish)
+      {
+        // vtk-h encoded and wrote the image on rank 0 inside
+        // Scene::Render, hand those bytes to the channel rather
+        // than encoding the canvas a second time
+        ImageChannel::PublishFile(image_name,
+                                  cycle,
+                                  renders->at(i).GetWidth(),
+                                  renders->at(i).GetHeight(),
+                                  image_name);
+      }
+
       conduit::Node image_data;
       image_data["image_name"] = image_name;
+      image_data["cycle"] = cycle;
       image_data["image_width"] = renders->at(i).GetWidth();
       image_data["image_height"] = renders->at(i).GetHeight();
 
@@ -2823,6 +3028,8 @@ VTKHLog::declare_interface(Node &i)
     i["type_name"]   = "vtkh_log";
     i["port_names"].append() = "in";
     i["output_port"] = "true";
+    i["cacheable"]   = "true";
+    i["field_usage"] = "params";
 }
 
 //-----------------------------------------------------------------------------
@@ -2898,6 +3105,8 @@ VTKHRecenter::declare_interface(Node &i)
     i["type_name"]   = "vtkh_recenter";
     i["port_names"].append() = "in";
     i["output_port"] = "true";
+    i["cacheable"]   = "true";
+    i["field_usage"] = "params";
 }
 
 //-----------------------------------------------------------------------------
@@ -3103,6 +3312,7 @@ VTKHNoOp::declare_interface(Node &i)
     i["type_name"]   = "vtkh_no_op";
     i["port_names"].append() = "in";
     i["output_port"] = "true";
+    i["cacheable"]   = "true";
 }
 
 //-----------------------------------------------------------------------------
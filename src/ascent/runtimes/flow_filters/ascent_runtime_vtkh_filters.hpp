@@ -56,6 +56,9 @@
 
 #include <flow_filter.hpp>
 
+#include <set>
+#include <string>
+
 
 //-----------------------------------------------------------------------------
 // -- begin ascent:: --
@@ -317,6 +320,13 @@ public:
                                  conduit::Node &info);
     virtual void   execute();
 
+    // plots keep their renderer between executes, releases the
+    // renderers of w whose plot names are not in keep
+    static void    release_renderers(const flow::Workspace &w,
+                                     const std::set<std::string> &keep);
+    // status of the renderers kept for w, by plot name
+    static void    renderer_info(const flow::Workspace &w,
+                                 conduit::Node &info);
 };
 
 //-----------------------------------------------------------------------------
@@ -352,6 +362,8 @@ public:
    ~ExecScene();
 
     virtual void declare_interface(conduit::Node &i);
+    virtual bool verify_params(const conduit::Node &params,
+                               conduit::Node &info);
 
     virtual void execute();
 };
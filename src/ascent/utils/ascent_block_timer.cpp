@@ -49,6 +49,7 @@
 //-----------------------------------------------------------------------------
 
 #include "ascent_block_timer.hpp"
+#include "ascent_logging.hpp"
 #include <climits>
 #include <math.h>
 #include <stdio.h>
@@ -87,10 +88,25 @@ namespace ascent
 // Initialize BlockTimer static data members.
 int                             BlockTimer::s_global_depth = 0;
 conduit::Node                   BlockTimer::s_global_root;
+conduit::Node                   BlockTimer::s_reduced_root;
 std::string                     BlockTimer::s_current_path = "";
 std::map<std::string, timeval>  BlockTimer::s_timers;
 std::set<std::string>           BlockTimer::s_visited;
 int                             BlockTimer::s_rank = 0;
+int                             BlockTimer::s_mpi_comm_id = -1;
+
+#ifdef ASCENT_MPI_ENABLED
+//-----------------------------------------------------------------------------
+static MPI_Comm
+block_timer_comm(int mpi_comm_id)
+{
+    if(mpi_comm_id == -1)
+    {
+        return MPI_COMM_WORLD;
+    }
+    return MPI_Comm_f2c(mpi_comm_id);
+}
+#endif
 
 //-----------------------------------------------------------------------------
 BlockTimer::BlockTimer(std::string const &name)
@@ -113,6 +129,13 @@ BlockTimer::StopTimer(const char *name)
   std::string s_name(name);
   Stop(s_name);
 }
+
+//-----------------------------------------------------------------------------
+void
+BlockTimer::SetMPICommHandle(int mpi_comm_id)
+{
+    s_mpi_comm_id = mpi_comm_id;
+}
 //-----------------------------------------------------------------------------
 int
 parseLine(char *line)
@@ -134,8 +157,7 @@ void
 BlockTimer::Start(const std::string &name)
 {
 #ifdef ASCENT_MPI_ENABLED
-    MPI_Comm_rank(MPI_COMM_WORLD, &s_rank);
-    MPI_Barrier(MPI_COMM_WORLD);
+    MPI_Comm_rank(block_timer_comm(s_mpi_comm_id), &s_rank);
 #else
     s_rank = 0;
 #endif
@@ -161,9 +183,6 @@ BlockTimer::Start(const std::string &name)
 void
 BlockTimer::Stop(const std::string &name)
 {
-#ifdef ASCENT_MPI_ENABLED
-    //MPI_Barrier(MPI_COMM_WORLD);
-#endif
     if (s_global_depth <= MAX_DEPTH)
     {
         // Record timer.
@@ -247,7 +266,7 @@ Node &
 BlockTimer::Finalize()
 {
     BlockTimer::ReduceGlobalRoot();
-    return GlobalRoot();
+    return s_reduced_root;
 }
 
 
@@ -270,6 +289,8 @@ void BlockTimer::Precheck()
         curr["value"]      = 0.0;
         curr["id"]         = s_rank;
         curr["count"]      = 0u;
+        // number of ranks that visited this location
+        curr["ranks"]      = 1u;
         // added after max (the following 3)
         curr["min"]        = 0.0;
         curr["minid"]      = s_rank;
@@ -283,13 +304,14 @@ void BlockTimer::Precheck()
 
 //-----------------------------------------------------------------------------
 bool
-BlockTimer::CheckForKnownPath(std::string &path)
+BlockTimer::CheckForKnownPath(const std::string &path)
 {
   if(path == "value")       return true;
   if(path == "id")          return true;
   if(path == "count")       return true;
+  if(path == "ranks")       return true;
   if(path == "avg")         return true;
-  if(path == "minimum")     return true;
+  if(path == "min")         return true;
   if(path == "minid")       return true;
   if(path == "sysMemUsed")  return true;
   if(path == "procMemMB")   return true;
@@ -335,15 +357,16 @@ BlockTimer::GoUp()
 }
 
 //-----------------------------------------------------------------------------
-void
+// Merges the timings in b into a. Locations only b visited are copied.
 //-----------------------------------------------------------------------------
-BlockTimer::Reduce(Node &a, Node &b)
+void
+BlockTimer::Reduce(Node &a, const Node &b)
 {
-    // If a has it
-    if (a.dtype().is_object() && a.has_path("value"))
+    if (a.has_child("value") && b.has_child("value"))
     {
-      // Update (reduce) data
-      a["count"] = a["count"].as_uint32() + b["count"].as_uint32();
+      const unsigned int count_a = a["count"].as_uint32();
+      const unsigned int count_b = b["count"].as_uint32();
+      const unsigned int count   = count_a + count_b;
 
       if (b["value"].as_float64() > a["value"].as_float64())
       {
@@ -358,16 +381,21 @@ BlockTimer::Reduce(Node &a, Node &b)
           a["minid"] = b["minid"];
       }
 
-      unsigned int count_a = a["count"].as_uint32();
-      unsigned int count_b = b["count"].as_uint32();
-      a["avg"] = (a["avg"].as_float64() * count_a + b["avg"].as_float64() * count_b) / (count_a + count_b);
+      if (count > 0)
+      {
+          a["avg"] = (a["avg"].as_float64() * count_a +
+                      b["avg"].as_float64() * count_b) / count;
+      }
+
+      a["count"] = count;
+      a["ranks"] = a["ranks"].as_uint32() + b["ranks"].as_uint32();
     }
 
-    NodeIterator itr_b(&b);
+    NodeConstIterator itr_b = b.children();
 
     while(itr_b.has_next())
     {
-        itr_b.next();
+        const Node &b_child = itr_b.next();
         std::string bpath = itr_b.name();
         //
         // If we don't know the path then
@@ -378,24 +406,34 @@ BlockTimer::Reduce(Node &a, Node &b)
             continue;
         }
 
-        if (a.dtype().is_object() &&  a.has_path(bpath))
+        if (a.has_child(bpath))
+        {
+            Reduce(a[bpath], b_child);
+        }
+        else
         {
-            Reduce(a[bpath], b[bpath]);
+            a[bpath].set(b_child);
         }
     }
-
-    return;
 }
+
+//-----------------------------------------------------------------------------
+// Converts the reduced totals into the time per call on the ranks that
+// visited each location.
 //-----------------------------------------------------------------------------
 void
-BlockTimer::AverageByCount(Node &node, int numRanks)
+BlockTimer::AverageByCount(Node &node)
 {
-    if(node.dtype().is_object() && node.has_path("value"))
+    if(node.dtype().is_object() && node.has_child("value"))
     {
-        double count  = node["count"].as_uint32()  / numRanks;
-        node["value"] = node["value"].as_float64() / count;
-        node["min"]   = node["min"].as_float64()   / count;
-        node["avg"]   = node["avg"].as_float64()   / count;
+        const unsigned int ranks = node["ranks"].as_uint32();
+        double count  = (double)node["count"].as_uint32() / ranks;
+        if(count > 0)
+        {
+            node["value"] = node["value"].as_float64() / count;
+            node["min"]   = node["min"].as_float64()   / count;
+            node["avg"]   = node["avg"].as_float64()   / count;
+        }
         node["count"] = uint32(count);
     }
 
@@ -412,82 +450,92 @@ BlockTimer::AverageByCount(Node &node, int numRanks)
             continue;
         }
 
-        AverageByCount(curr_node, numRanks);
+        AverageByCount(curr_node);
     }
 
     return;
 }
 
+//-----------------------------------------------------------------------------
+// Reduces the timings of all ranks to rank 0 using a binomial tree: in
+// round k, ranks with bit k set send their partial result to the rank
+// without it and drop out, so rank 0 merges log2(P) trees.
 //-----------------------------------------------------------------------------
 void
 BlockTimer::ReduceAll(Node &thisRanksNode)
 {
 #ifdef ASCENT_MPI_ENABLED
-    int temp;
-    MPI_Comm_size(MPI_COMM_WORLD, &temp);
-    const unsigned int numProcesses = temp;
-    MPI_Comm_rank(MPI_COMM_WORLD, &temp);
-    const unsigned int rank = temp;
-
-    std::vector<Node> recvNodes(numProcesses+1);
-
-    if (rank == 0)
+    MPI_Comm comm = block_timer_comm(s_mpi_comm_id);
+    int rank = 0;
+    int num_ranks = 1;
+    MPI_Comm_rank(comm, &rank);
+    MPI_Comm_size(comm, &num_ranks);
+    s_rank = rank;
+
+    for(int mask = 1; mask < num_ranks; mask <<= 1)
     {
-        for (unsigned int i = 1; i < numProcesses; ++i)
+        if((rank & mask) != 0)
         {
-          recv(recvNodes[i], // node
-               i, // source
-               42, // tag
-               MPI_COMM_WORLD // comm
-               );
-           }
-     }
-     else
-     {
-         send(thisRanksNode, // node
-              0, // dest
-              42, // tag
-              MPI_COMM_WORLD // comm
-              );
-    }
-
-    if (rank == 0)
-    {
-        for (unsigned int i = 1; i < numProcesses; ++i)
+            // ranks may not have visited any timers, wrap the tree so
+            // the message always has a schema
+            Node msg;
+            msg["rank"] = rank;
+            msg["timers"].set_external(thisRanksNode);
+            send_using_schema(msg, rank - mask, 42, comm);
+            break;
+        }
+        else if(rank + mask < num_ranks)
         {
-            Reduce(thisRanksNode.fetch("children"),
-                   recvNodes[i].fetch("children"));
+            Node msg;
+            recv_using_schema(msg, rank + mask, 42, comm);
+            Reduce(thisRanksNode, msg["timers"]);
         }
     }
 
     // Get the average time per iteration
     if(rank == 0)
     {
-        AverageByCount(s_global_root, numProcesses);
+        AverageByCount(thisRanksNode);
     }
 
 #else
-    AverageByCount(BlockTimer::GlobalRoot(),1);
+    AverageByCount(thisRanksNode);
 #endif
 }
 
 //-----------------------------------------------------------------------------
+// Reduces a copy, since reducing merges the trees of other ranks and
+// averages by count, which must only happen once for the recorded values.
 void BlockTimer::ReduceGlobalRoot()
 {
-    ReduceAll(GlobalRoot());
+    s_reduced_root.set(GlobalRoot());
+    ReduceAll(s_reduced_root);
 }
 
 //-----------------------------------------------------------------------------
-void BlockTimer::WriteLogFile()
+void BlockTimer::WriteLogFile(const std::string &protocol)
 {
-    BlockTimer::ReduceGlobalRoot();
+    if(protocol != "json" && protocol != "conduit_bin")
+    {
+        ASCENT_ERROR("BlockTimer log protocol must be 'json' or 'conduit_bin',"
+                     " given '" << protocol << "'");
+    }
 
-    std::string logfile = "ascent.log";
+    BlockTimer::ReduceGlobalRoot();
 
     if(s_rank == 0 )
     {
-        GlobalRoot().print();
-        GlobalRoot().to_json_stream(logfile.c_str(), "json", 2, 5);
+        if(protocol == "json")
+        {
+            std::string logfile = "ascent.log";
+            s_reduced_root.print();
+            s_reduced_root.to_json_stream(logfile.c_str(), "json", 2, 5);
+        }
+        else
+        {
+            // compact data, with the schema stored in ascent_log.bin_json
+            s_reduced_root.save("ascent_log.bin", "conduit_bin");
+        }
     }
 }
 
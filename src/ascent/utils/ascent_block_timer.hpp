@@ -78,8 +78,16 @@ public:
     ~BlockTimer();
     static void StartTimer(const char *name);
     static void StopTimer(const char *name);
+    // sets the communicator used to reduce the timings of all ranks
+    // (default = MPI_COMM_WORLD)
+    static void SetMPICommHandle(int mpi_comm_id);
+    // reduces the timings of all ranks (collective), the result is valid
+    // on rank 0. The recorded timings are left untouched, so this can be
+    // called more than once.
     static conduit::Node &Finalize();
-    static void           WriteLogFile();
+    // writes the reduced timings on rank 0, either as json (ascent.log)
+    // or in compact binary form (protocol "conduit_bin", ascent_log.bin)
+    static void           WriteLogFile(const std::string &protocol = "json");
 
 private:
 
@@ -107,12 +115,11 @@ private:
     static conduit::Node &CurrentNode();
 
     static void Reduce(conduit::Node &,
-                       conduit::Node &);
+                       const conduit::Node &);
 
-    static bool CheckForKnownPath(std::string &);
+    static bool CheckForKnownPath(const std::string &);
 
-    static void AverageByCount(conduit::Node &,
-                               int);
+    static void AverageByCount(conduit::Node &);
     static void FillDataArray(conduit::Node &,
                               const int &,
                               double &,
@@ -120,7 +127,10 @@ private:
                               std::string);
     // static data members
     static conduit::Node                  s_global_root;
+    // reduced copy of s_global_root
+    static conduit::Node                  s_reduced_root;
     static int                            s_rank; // MPI rank
+    static int                            s_mpi_comm_id;
     static int                            s_global_depth;
     static std::string                    s_current_path;
     static std::map<std::string, timeval> s_timers;
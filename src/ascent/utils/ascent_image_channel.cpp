@@ -0,0 +1,423 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2015-2019, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-716457
+//
+// All rights reserved.
+//
+// This file is part of Ascent.
+//
+// For details, see: http://ascent.readthedocs.io/.
+//
+// Please also read ascent/LICENSE
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the disclaimer below.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the disclaimer (as noted below) in the
+//   documentation and/or other materials provided with the distribution.
+//
+// * Neither the name of the LLNS/LLNL nor the names of its contributors may
+//   be used to endorse or promote products derived from this software without
+//   specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL LAWRENCE LIVERMORE NATIONAL SECURITY,
+// LLC, THE U.S. DEPARTMENT OF ENERGY OR CONTRIBUTORS BE LIABLE FOR ANY
+// DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//-----------------------------------------------------------------------------
+///
+/// file: ascent_image_channel.cpp
+///
+//-----------------------------------------------------------------------------
+
+#include "ascent_image_channel.hpp"
+
+#include "ascent_logging.hpp"
+
+// standard includes
+#include <stdlib.h>
+#include <atomic>
+#include <deque>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <set>
+
+using namespace conduit;
+
+//-----------------------------------------------------------------------------
+// -- begin ascent:: --
+//-----------------------------------------------------------------------------
+namespace ascent
+{
+
+//-----------------------------------------------------------------------------
+// -- begin ascent::detail --
+//-----------------------------------------------------------------------------
+namespace detail
+{
+
+//-----------------------------------------------------------------------------
+struct ImageChannelState
+{
+    ImageChannelState()
+    : max_cycles(1)
+    {}
+
+    // releases the frames of cycles older than the newest max_cycles,
+    // names that change every cycle (cinema time steps) are released
+    // with their cycle
+    void evict()
+    {
+        while((int)cycles.size() > max_cycles)
+        {
+            const int oldest = *cycles.begin();
+            cycles.erase(cycles.begin());
+
+            std::map<std::string, std::deque<ImageChannel::FramePtr>>::iterator itr
+              = frames.begin();
+            while(itr != frames.end())
+            {
+                std::deque<ImageChannel::FramePtr> &name_frames = itr->second;
+                while(!name_frames.empty() &&
+                      name_frames.front()->Cycle() <= oldest)
+                {
+                    name_frames.pop_front();
+                }
+
+                if(name_frames.empty())
+                {
+                    frames.erase(itr++);
+                }
+                else
+                {
+                    itr++;
+                }
+            }
+        }
+    }
+
+    std::mutex                                                mutex;
+    int                                                       max_cycles;
+    // cycles that have frames
+    std::set<int>                                             cycles;
+    // frames of each render, ordered by cycle
+    std::map<std::string, std::deque<ImageChannel::FramePtr>> frames;
+};
+
+//-----------------------------------------------------------------------------
+ImageChannelState &
+image_channel_state()
+{
+    static ImageChannelState state;
+    return state;
+}
+
+static std::atomic<bool> image_channel_enabled(false);
+
+//-----------------------------------------------------------------------------
+};
+//-----------------------------------------------------------------------------
+// -- end ascent::detail --
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+ImageFrame::ImageFrame(const std::string &name,
+                       int cycle,
+                       int width,
+                       int height,
+                       unsigned char *png,
+                       size_t png_size)
+: m_name(name),
+  m_cycle(cycle),
+  m_width(width),
+  m_height(height),
+  m_png(png),
+  m_png_size(png_size)
+{}
+
+//-----------------------------------------------------------------------------
+ImageFrame::~ImageFrame()
+{
+    if(m_png != NULL)
+    {
+        // allocated by lodepng
+        free(m_png);
+    }
+}
+
+//-----------------------------------------------------------------------------
+const std::string &
+ImageFrame::Name() const
+{
+    return m_name;
+}
+
+//-----------------------------------------------------------------------------
+int
+ImageFrame::Cycle() const
+{
+    return m_cycle;
+}
+
+//-----------------------------------------------------------------------------
+int
+ImageFrame::Width() const
+{
+    return m_width;
+}
+
+//-----------------------------------------------------------------------------
+int
+ImageFrame::Height() const
+{
+    return m_height;
+}
+
+//-----------------------------------------------------------------------------
+const unsigned char *
+ImageFrame::Png() const
+{
+    return m_png;
+}
+
+//-----------------------------------------------------------------------------
+size_t
+ImageFrame::PngSize() const
+{
+    return m_png_size;
+}
+
+//-----------------------------------------------------------------------------
+void
+ImageFrame::Base64Encode(Node &out) const
+{
+    out.reset();
+
+    Node encoded;
+    encoded.set(DataType::char8_str(m_png_size*2));
+    utils::base64_encode(m_png,
+                         m_png_size,
+                         encoded.data_ptr());
+
+    out = "data:image/png;base64," + encoded.as_string();
+}
+
+//-----------------------------------------------------------------------------
+void
+ImageFrame::Save(const std::string &path) const
+{
+    std::ofstream ofs(path.c_str(), std::ios::binary);
+    if(!ofs.is_open() ||
+       !ofs.write((const char*)m_png, m_png_size))
+    {
+        ASCENT_WARN("Error saving PNG buffer to file: " << path);
+    }
+}
+
+//-----------------------------------------------------------------------------
+void
+ImageChannel::Enable(bool enabled)
+{
+    detail::image_channel_enabled = enabled;
+}
+
+//-----------------------------------------------------------------------------
+bool
+ImageChannel::Enabled()
+{
+    return detail::image_channel_enabled;
+}
+
+//-----------------------------------------------------------------------------
+void
+ImageChannel::SetMaxCycles(int max_cycles)
+{
+    if(max_cycles < 1)
+    {
+        ASCENT_ERROR("image channel max cycles must be greater than zero,"
+                     " given " << max_cycles);
+    }
+
+    detail::ImageChannelState &state = detail::image_channel_state();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    state.max_cycles = max_cycles;
+    state.evict();
+}
+
+//-----------------------------------------------------------------------------
+ImageChannel::FramePtr
+ImageChannel::Publish(const std::string &name,
+                      int cycle,
+                      int width,
+                      int height,
+                      unsigned char *png,
+                      size_t png_size)
+{
+    if(png == NULL)
+    {
+        ASCENT_ERROR("Publish requires a png buffer");
+    }
+
+    FramePtr frame(new ImageFrame(name,
+                                  cycle,
+                                  width,
+                                  height,
+                                  png,
+                                  png_size));
+
+    detail::ImageChannelState &state = detail::image_channel_state();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    std::deque<FramePtr> &frames = state.frames[name];
+
+    // replace a frame from the same cycle, otherwise keep cycle order
+    std::deque<FramePtr>::iterator itr = frames.begin();
+    while(itr != frames.end() && (*itr)->Cycle() < cycle)
+    {
+        itr++;
+    }
+
+    if(itr != frames.end() && (*itr)->Cycle() == cycle)
+    {
+        *itr = frame;
+    }
+    else
+    {
+        frames.insert(itr, frame);
+    }
+
+    state.cycles.insert(cycle);
+    state.evict();
+
+    return frame;
+}
+
+//-----------------------------------------------------------------------------
+ImageChannel::FramePtr
+ImageChannel::PublishFile(const std::string &name,
+                          int cycle,
+                          int width,
+                          int height,
+                          const std::string &path)
+{
+    std::ifstream ifs(path.c_str(), std::ios::binary | std::ios::ate);
+    if(!ifs.is_open())
+    {
+        ASCENT_WARN("Image channel could not open: " << path);
+        return FramePtr();
+    }
+
+    const std::streamoff png_size = ifs.tellg();
+    ifs.seekg(0, std::ios::beg);
+
+    // released by the frame
+    unsigned char *png = (unsigned char*)malloc(png_size);
+    if(png_size <= 0 ||
+       png == NULL ||
+       !ifs.read((char*)png, png_size))
+    {
+        free(png);
+        ASCENT_WARN("Image channel could not read: " << path);
+        return FramePtr();
+    }
+
+    return Publish(name, cycle, width, height, png, (size_t)png_size);
+}
+
+//-----------------------------------------------------------------------------
+ImageChannel::FramePtr
+ImageChannel::Fetch(const std::string &name, int cycle)
+{
+    detail::ImageChannelState &state = detail::image_channel_state();
+    std::lock_guard<std::mutex> lock(state.mutex);
+
+    std::map<std::string, std::deque<FramePtr>>::const_iterator itr
+      = state.frames.find(name);
+    if(itr != state.frames.end())
+    {
+        const std::deque<FramePtr> &frames = itr->second;
+        for(size_t i = 0; i < frames.size(); ++i)
+        {
+            if(frames[i]->Cycle() == cycle)
+            {
+                return frames[i];
+            }
+        }
+    }
+    return FramePtr();
+}
+
+//-----------------------------------------------------------------------------
+ImageChannel::FramePtr
+ImageChannel::Latest(const std::string &name)
+{
+    detail::ImageChannelState &state = detail::image_channel_state();
+    std::lock_guard<std::mutex> lock(state.mutex);
+
+    std::map<std::string, std::deque<FramePtr>>::const_iterator itr
+      = state.frames.find(name);
+    if(itr == state.frames.end() || itr->second.empty())
+    {
+        return FramePtr();
+    }
+    return itr->second.back();
+}
+
+//-----------------------------------------------------------------------------
+void
+ImageChannel::Info(Node &out)
+{
+    out.reset();
+
+    detail::ImageChannelState &state = detail::image_channel_state();
+    std::lock_guard<std::mutex> lock(state.mutex);
+
+    std::map<std::string, std::deque<FramePtr>>::const_iterator itr;
+    for(itr = state.frames.begin(); itr != state.frames.end(); ++itr)
+    {
+        const std::deque<FramePtr> &frames = itr->second;
+        for(size_t i = 0; i < frames.size(); ++i)
+        {
+            Node &frame = out.append();
+            frame["name"]   = frames[i]->Name();
+            frame["cycle"]  = frames[i]->Cycle();
+            frame["width"]  = frames[i]->Width();
+            frame["height"] = frames[i]->Height();
+            frame["bytes"]  = (uint64)frames[i]->PngSize();
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+void
+ImageChannel::Clear()
+{
+    detail::ImageChannelState &state = detail::image_channel_state();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    state.frames.clear();
+    state.cycles.clear();
+}
+
+//-----------------------------------------------------------------------------
+};
+//-----------------------------------------------------------------------------
+// -- end ascent:: --
+//-----------------------------------------------------------------------------
@@ -0,0 +1,162 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2015-2019, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-716457
+//
+// All rights reserved.
+//
+// This file is part of Ascent.
+//
+// For details, see: http://ascent.readthedocs.io/.
+//
+// Please also read ascent/LICENSE
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the disclaimer below.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the disclaimer (as noted below) in the
+//   documentation and/or other materials provided with the distribution.
+//
+// * Neither the name of the LLNS/LLNL nor the names of its contributors may
+//   be used to endorse or promote products derived from this software without
+//   specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL LAWRENCE LIVERMORE NATIONAL SECURITY,
+// LLC, THE U.S. DEPARTMENT OF ENERGY OR CONTRIBUTORS BE LIABLE FOR ANY
+// DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//-----------------------------------------------------------------------------
+///
+/// file: ascent_image_channel.hpp
+///
+//-----------------------------------------------------------------------------
+#ifndef ASCENT_IMAGE_CHANNEL_HPP
+#define ASCENT_IMAGE_CHANNEL_HPP
+
+#include <conduit.hpp>
+
+#include <memory>
+#include <string>
+
+//-----------------------------------------------------------------------------
+// -- begin ascent:: --
+//-----------------------------------------------------------------------------
+namespace ascent
+{
+
+//-----------------------------------------------------------------------------
+// An encoded png image, owned by the image channel.
+//-----------------------------------------------------------------------------
+class ImageFrame
+{
+public:
+    // takes ownership of a png buffer allocated with malloc
+    ImageFrame(const std::string &name,
+               int cycle,
+               int width,
+               int height,
+               unsigned char *png,
+               size_t png_size);
+    ~ImageFrame();
+
+    const std::string   &Name() const;
+    int                  Cycle() const;
+    int                  Width() const;
+    int                  Height() const;
+
+    const unsigned char *Png() const;
+    size_t               PngSize() const;
+
+    // sets out to a "data:image/png;base64,..." string
+    void                 Base64Encode(conduit::Node &out) const;
+    // writes the png to a file
+    void                 Save(const std::string &path) const;
+
+private:
+    ImageFrame(const ImageFrame &);
+    ImageFrame &operator=(const ImageFrame &);
+
+    std::string          m_name;
+    int                  m_cycle;
+    int                  m_width;
+    int                  m_height;
+    unsigned char       *m_png;
+    size_t               m_png_size;
+};
+
+//-----------------------------------------------------------------------------
+// Holds the most recent rendered frames in memory, keyed by render name
+// and cycle, so clients (web streaming, jupyter) can use the png encoded
+// by the renderer without reading it back from disk.
+//
+// Frames are shared, a frame that is replaced stays valid for the clients
+// that still hold it.
+//-----------------------------------------------------------------------------
+class ImageChannel
+{
+public:
+    typedef std::shared_ptr<const ImageFrame> FramePtr;
+
+    // renderers only publish frames when the channel is enabled
+    static void     Enable(bool enabled);
+    static bool     Enabled();
+
+    // number of cycles kept (default = 1), frames from older cycles
+    // are released
+    static void     SetMaxCycles(int max_cycles);
+
+    // takes ownership of a png buffer allocated with malloc
+    static FramePtr Publish(const std::string &name,
+                            int cycle,
+                            int width,
+                            int height,
+                            unsigned char *png,
+                            size_t png_size);
+
+    // publishes the png a renderer already encoded and wrote to path,
+    // returns NULL if the file can't be read
+    static FramePtr PublishFile(const std::string &name,
+                                int cycle,
+                                int width,
+                                int height,
+                                const std::string &path);
+
+    // returns NULL if the frame is not available
+    static FramePtr Fetch(const std::string &name, int cycle);
+    static FramePtr Latest(const std::string &name);
+
+    // describes the frames held by the channel
+    static void     Info(conduit::Node &out);
+
+    // releases all frames
+    static void     Clear();
+};
+
+//-----------------------------------------------------------------------------
+};
+//-----------------------------------------------------------------------------
+// -- end ascent:: --
+//-----------------------------------------------------------------------------
+
+#endif
+//-----------------------------------------------------------------------------
+// -- end header ifdef guard
+//-----------------------------------------------------------------------------
+
@@ -50,10 +50,17 @@
 
 #include "ascent_png_encoder.hpp"
 
+#include "ascent_config.h"
 #include "ascent_logging.hpp"
 
 // standard includes
 #include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+#ifdef ASCENT_USE_OPENMP
+#include <omp.h>
+#endif
 
 // thirdparty includes
 #include <lodepng.h>
@@ -66,10 +73,208 @@ using namespace conduit;
 namespace ascent
 {
 
+//-----------------------------------------------------------------------------
+// -- begin ascent::detail --
+//-----------------------------------------------------------------------------
+namespace detail
+{
+
+// rows are compressed in independent chunks of at least this many bytes
+static const size_t PNG_MIN_CHUNK_BYTES = 256 * 1024;
+
+//-----------------------------------------------------------------------------
+static inline unsigned char
+paeth_predictor(int a, int b, int c)
+{
+    int p  = a + b - c;
+    int pa = p > a ? p - a : a - p;
+    int pb = p > b ? p - b : b - p;
+    int pc = p > c ? p - c : c - p;
+
+    if(pa <= pb && pa <= pc)
+    {
+        return (unsigned char)a;
+    }
+    else if(pb <= pc)
+    {
+        return (unsigned char)b;
+    }
+    return (unsigned char)c;
+}
+
+//-----------------------------------------------------------------------------
+// applies png filter 'type' to one rgba8 row, prev is NULL for the first row
+static void
+filter_row(const unsigned char *row,
+           const unsigned char *prev,
+           const size_t row_bytes,
+           const int type,
+           unsigned char *out)
+{
+    const size_t bpp = 4;
+
+    switch(type)
+    {
+        case 0:
+            memcpy(out, row, row_bytes);
+            break;
+        case 1:
+            memcpy(out, row, bpp);
+            for(size_t i = bpp; i < row_bytes; ++i)
+            {
+                out[i] = row[i] - row[i - bpp];
+            }
+            break;
+        case 2:
+            if(prev == NULL)
+            {
+                memcpy(out, row, row_bytes);
+                break;
+            }
+            for(size_t i = 0; i < row_bytes; ++i)
+            {
+                out[i] = row[i] - prev[i];
+            }
+            break;
+        case 3:
+            if(prev == NULL)
+            {
+                memcpy(out, row, bpp);
+                for(size_t i = bpp; i < row_bytes; ++i)
+                {
+                    out[i] = row[i] - (row[i - bpp] >> 1);
+                }
+                break;
+            }
+            for(size_t i = 0; i < bpp; ++i)
+            {
+                out[i] = row[i] - (prev[i] >> 1);
+            }
+            for(size_t i = bpp; i < row_bytes; ++i)
+            {
+                out[i] = row[i] - ((row[i - bpp] + prev[i]) >> 1);
+            }
+            break;
+        default: // 4, paeth
+            if(prev == NULL)
+            {
+                // paeth of the first row reduces to sub
+                filter_row(row, prev, row_bytes, 1, out);
+                break;
+            }
+            for(size_t i = 0; i < bpp; ++i)
+            {
+                out[i] = row[i] - prev[i];
+            }
+            for(size_t i = bpp; i < row_bytes; ++i)
+            {
+                out[i] = row[i] - paeth_predictor(row[i - bpp],
+                                                  prev[i],
+                                                  prev[i - bpp]);
+            }
+            break;
+    }
+}
+
+//-----------------------------------------------------------------------------
+// sum of the filtered bytes as signed values, smaller usually compresses
+// better (lodepng's LFS_MINSUM heuristic)
+static size_t
+filter_cost(const unsigned char *filtered, const size_t row_bytes)
+{
+    size_t sum = 0;
+    for(size_t i = 0; i < row_bytes; ++i)
+    {
+        const unsigned char v = filtered[i];
+        sum += v < 128 ? v : 256 - v;
+    }
+    return sum;
+}
+
+//-----------------------------------------------------------------------------
+static unsigned
+adler32(const unsigned char *data, size_t size)
+{
+    const unsigned base = 65521;
+    unsigned s1 = 1;
+    unsigned s2 = 0;
+
+    while(size > 0)
+    {
+        // 5552 is the largest n such that the sums don't overflow
+        size_t n = size > 5552 ? 5552 : size;
+        size -= n;
+        while(n-- > 0)
+        {
+            s1 += *data++;
+            s2 += s1;
+        }
+        s1 %= base;
+        s2 %= base;
+    }
+    return (s2 << 16) | s1;
+}
+
+//-----------------------------------------------------------------------------
+// checksum of a followed by b, given their checksums and the size of b
+static unsigned
+adler32_combine(unsigned adler_a, unsigned adler_b, size_t size_b)
+{
+    const unsigned base = 65521;
+    const unsigned rem = (unsigned)(size_b % base);
+    unsigned s1 = adler_a & 0xffff;
+    unsigned s2 = (unsigned)(((unsigned long long)rem * s1) % base);
+
+    s1 += (adler_b & 0xffff) + base - 1;
+    s2 += ((adler_a >> 16) & 0xffff) + ((adler_b >> 16) & 0xffff) + base - rem;
+
+    if(s1 >= base) s1 -= base;
+    if(s1 >= base) s1 -= base;
+    if(s2 >= (base << 1)) s2 -= (base << 1);
+    if(s2 >= base) s2 -= base;
+
+    return (s2 << 16) | s1;
+}
+
+//-----------------------------------------------------------------------------
+static void
+append_uint32(std::vector<unsigned char> &out, unsigned value)
+{
+    out.push_back((unsigned char)(value >> 24));
+    out.push_back((unsigned char)(value >> 16));
+    out.push_back((unsigned char)(value >> 8));
+    out.push_back((unsigned char)(value));
+}
+
+//-----------------------------------------------------------------------------
+static int
+max_threads()
+{
+#ifdef ASCENT_USE_OPENMP
+    return omp_get_max_threads();
+#else
+    return 1;
+#endif
+}
+
+//-----------------------------------------------------------------------------
+static inline unsigned char
+quantize(const float v)
+{
+    return v <= 0.f ? 0 : (v >= 1.f ? 255 : (unsigned char)(v * 255.f));
+}
+
+//-----------------------------------------------------------------------------
+};
+//-----------------------------------------------------------------------------
+// -- end ascent::detail --
+//-----------------------------------------------------------------------------
+
 //-----------------------------------------------------------------------------
 PNGEncoder::PNGEncoder()
 :m_buffer(NULL),
- m_buffer_size(0)
+ m_buffer_size(0),
+ m_compression(COMPRESSION_DEFAULT)
 {}
 
 //-----------------------------------------------------------------------------
@@ -80,36 +285,51 @@ PNGEncoder::~PNGEncoder()
 
 //-----------------------------------------------------------------------------
 void
-PNGEncoder::Encode(const unsigned char *rgba_in,
-                   const int width,
-                   const int height)
+PNGEncoder::SetCompression(const std::string &compression)
 {
-    Cleanup();
-
-    // upside down relative to what lodepng wants
-    unsigned char *rgba_flip = new unsigned char[width * height *4];
-
-    for (int y=0; y<height; ++y)
+    if(compression == "default")
     {
-        memcpy(&(rgba_flip[y*width*4]),
-               &(rgba_in[(height-y-1)*width*4]),
-               width*4);
+        m_compression = COMPRESSION_DEFAULT;
     }
+    else if(compression == "fast")
+    {
+        m_compression = COMPRESSION_FAST;
+    }
+    else if(compression == "none")
+    {
+        m_compression = COMPRESSION_NONE;
+    }
+    else
+    {
+        ASCENT_ERROR("Unknown png compression '" << compression << "'."
+                     " Valid options are 'default', 'fast' and 'none'");
+    }
+}
 
-     unsigned error = lpng::lodepng_encode_memory(&m_buffer,
-                                            &m_buffer_size,
-                                            &rgba_flip[0],
-                                            width,
-                                            height,
-                                            lpng::LCT_RGBA, // these settings match those for
-                                            8);       // lodepng_encode32_file
-
-    delete [] rgba_flip;
-
-    if(error)
+//-----------------------------------------------------------------------------
+std::string
+PNGEncoder::Compression() const
+{
+    if(m_compression == COMPRESSION_FAST)
     {
-        ASCENT_WARN("lodepng_encode_memory failed")
+        return "fast";
     }
+    else if(m_compression == COMPRESSION_NONE)
+    {
+        return "none";
+    }
+    return "default";
+}
+
+//-----------------------------------------------------------------------------
+void
+PNGEncoder::Encode(const unsigned char *rgba_in,
+                   const int width,
+                   const int height)
+{
+    // upside down relative to what png wants, the rows are
+    // read bottom up while filtering
+    EncodeRows(rgba_in, width, height, true);
 }
 
 //-----------------------------------------------------------------------------
@@ -117,41 +337,237 @@ void
 PNGEncoder::Encode(const float *rgba_in,
                    const int width,
                    const int height)
+{
+    // quantize and flip in one pass
+    const size_t row_size = (size_t)width * 4;
+    std::vector<unsigned char> rgba(row_size * height);
+
+#ifdef ASCENT_USE_OPENMP
+    #pragma omp parallel for
+#endif
+    for(int y = 0; y < height; ++y)
+    {
+        const float *in_row = rgba_in + (size_t)(height - y - 1) * row_size;
+        unsigned char *out_row = &rgba[0] + (size_t)y * row_size;
+        for(size_t i = 0; i < row_size; ++i)
+        {
+            out_row[i] = detail::quantize(in_row[i]);
+        }
+    }
+
+    EncodeRows(rgba.empty() ? NULL : &rgba[0], width, height, false);
+}
+
+//-----------------------------------------------------------------------------
+void
+PNGEncoder::EncodeRows(const unsigned char *rgba,
+                       const int width,
+                       const int height,
+                       const bool flip)
 {
     Cleanup();
 
-    // upside down relative to what lodepng wants
-    unsigned char *rgba_flip = new unsigned char[width * height *4];
+    if(width <= 0 || height <= 0)
+    {
+        ASCENT_WARN("png encoding failed: invalid image size "
+                    << width << "x" << height);
+        return;
+    }
 
+    const size_t row_size = (size_t)width * 4;
+    // each filtered row starts with its filter type
+    const size_t filtered_row_size = row_size + 1;
 
-    for(int x = 0; x < width; ++x)
+    //
+    // filter the rows
+    //
+    std::vector<unsigned char> filtered(filtered_row_size * height);
 
 #ifdef ASCENT_USE_OPENMP
-        #pragma omp parrallel for
+    #pragma omp parallel
 #endif
-        for (int y = 0; y < height; ++y)
+    {
+        std::vector<unsigned char> attempt;
+        if(m_compression == COMPRESSION_DEFAULT)
         {
-            int inOffset = (y * width + x) * 4;
-            int outOffset = ((height - y - 1) * width + x) * 4;
-            rgba_flip[outOffset + 0] = (unsigned char)(rgba_in[inOffset + 0] * 255.f);
-            rgba_flip[outOffset + 1] = (unsigned char)(rgba_in[inOffset + 1] * 255.f);
-            rgba_flip[outOffset + 2] = (unsigned char)(rgba_in[inOffset + 2] * 255.f);
-            rgba_flip[outOffset + 3] = (unsigned char)(rgba_in[inOffset + 3] * 255.f);
+            attempt.resize(row_size);
         }
 
-     unsigned error = lpng::lodepng_encode_memory(&m_buffer,
-                                            &m_buffer_size,
-                                            &rgba_flip[0],
-                                            width,
-                                            height,
-                                            lpng::LCT_RGBA, // these settings match those for
-                                            8);       // lodepng_encode32_file
+#ifdef ASCENT_USE_OPENMP
+        #pragma omp for
+#endif
+        for(int y = 0; y < height; ++y)
+        {
+            const unsigned char *row  = rgba + (size_t)(flip ? height - y - 1 : y) * row_size;
+            const unsigned char *prev = NULL;
+            if(y > 0)
+            {
+                prev = rgba + (size_t)(flip ? height - y : y - 1) * row_size;
+            }
+
+            unsigned char *out = &filtered[0] + (size_t)y * filtered_row_size;
+
+            if(m_compression == COMPRESSION_NONE)
+            {
+                out[0] = 0;
+                detail::filter_row(row, prev, row_size, 0, out + 1);
+            }
+            else if(m_compression == COMPRESSION_FAST)
+            {
+                out[0] = 2;
+                detail::filter_row(row, prev, row_size, 2, out + 1);
+            }
+            else
+            {
+                // keep the filter with the smallest cost
+                size_t best_cost = 0;
+                for(int type = 0; type < 5; ++type)
+                {
+                    detail::filter_row(row, prev, row_size, type, &attempt[0]);
+                    size_t cost = detail::filter_cost(&attempt[0], row_size);
+                    if(type == 0 || cost < best_cost)
+                    {
+                        best_cost = cost;
+                        out[0] = (unsigned char)type;
+                        memcpy(out + 1, &attempt[0], row_size);
+                    }
+                }
+            }
+        }
+    }
+
+    //
+    // deflate groups of rows as independent chunks of one stream
+    //
+    lpng::LodePNGCompressSettings settings;
+    lpng::lodepng_compress_settings_init(&settings);
+
+    if(m_compression == COMPRESSION_NONE)
+    {
+        settings.btype = 0;
+    }
+    else if(m_compression == COMPRESSION_FAST)
+    {
+        settings.windowsize   = 256;
+        settings.nicematch    = 32;
+        settings.lazymatching = 0;
+    }
+
+    size_t rows_per_chunk = height;
+    const int threads = detail::max_threads();
+    if(threads > 1)
+    {
+        rows_per_chunk = (height + threads - 1) / threads;
+        size_t min_rows = detail::PNG_MIN_CHUNK_BYTES / filtered_row_size + 1;
+        if(rows_per_chunk < min_rows)
+        {
+            rows_per_chunk = min_rows;
+        }
+    }
+
+    const int num_chunks = (int)((height + rows_per_chunk - 1) / rows_per_chunk);
+    std::vector<unsigned char*> chunks(num_chunks, NULL);
+    std::vector<size_t>         chunk_sizes(num_chunks, 0);
+    std::vector<size_t>         chunk_input_sizes(num_chunks, 0);
+    std::vector<unsigned>       chunk_adlers(num_chunks, 0);
+    std::vector<unsigned>       chunk_errors(num_chunks, 0);
+
+#ifdef ASCENT_USE_OPENMP
+    #pragma omp parallel for schedule(dynamic, 1)
+#endif
+    for(int c = 0; c < num_chunks; ++c)
+    {
+        const size_t row_begin = c * rows_per_chunk;
+        size_t row_end = row_begin + rows_per_chunk;
+        if(row_end > (size_t)height)
+        {
+            row_end = height;
+        }
 
-    delete [] rgba_flip;
+        const unsigned char *in = &filtered[0] + row_begin * filtered_row_size;
+        const size_t in_size = (row_end - row_begin) * filtered_row_size;
+
+        chunk_input_sizes[c] = in_size;
+        chunk_adlers[c] = detail::adler32(in, in_size);
+        chunk_errors[c] = lpng::lodepng_deflate_chunk(&chunks[c],
+                                                      &chunk_sizes[c],
+                                                      in,
+                                                      in_size,
+                                                      &settings,
+                                                      c == num_chunks - 1);
+    }
+
+    unsigned error = 0;
+    size_t zlib_size = 2 + 4; // header and checksum
+    unsigned adler = 1;
+    for(int c = 0; c < num_chunks; ++c)
+    {
+        if(chunk_errors[c] != 0)
+        {
+            error = chunk_errors[c];
+        }
+        zlib_size += chunk_sizes[c];
+        adler = c == 0 ? chunk_adlers[c] :
+                detail::adler32_combine(adler,
+                                        chunk_adlers[c],
+                                        chunk_input_sizes[c]);
+    }
+
+    if(error == 0)
+    {
+        //
+        // assemble the zlib stream and the png
+        //
+        std::vector<unsigned char> zlib;
+        zlib.reserve(zlib_size);
+        // zlib header: deflate with a 32k window, matches lodepng
+        zlib.push_back(0x78);
+        zlib.push_back(0x01);
+        for(int c = 0; c < num_chunks; ++c)
+        {
+            zlib.insert(zlib.end(), chunks[c], chunks[c] + chunk_sizes[c]);
+        }
+        detail::append_uint32(zlib, adler);
+
+        std::vector<unsigned char> header;
+        detail::append_uint32(header, width);
+        detail::append_uint32(header, height);
+        header.push_back(8); // bit depth
+        header.push_back(6); // color type rgba
+        header.push_back(0); // compression method
+        header.push_back(0); // filter method
+        header.push_back(0); // no interlacing
+
+        static const unsigned char signature[8] = {137, 80, 78, 71, 13, 10, 26, 10};
+        m_buffer = (unsigned char*)malloc(8);
+        memcpy(m_buffer, signature, 8);
+        m_buffer_size = 8;
+
+        error = lpng::lodepng_chunk_create(&m_buffer, &m_buffer_size,
+                                           (unsigned)header.size(), "IHDR",
+                                           &header[0]);
+        if(!error)
+        {
+            error = lpng::lodepng_chunk_create(&m_buffer, &m_buffer_size,
+                                               (unsigned)zlib.size(), "IDAT",
+                                               &zlib[0]);
+        }
+        if(!error)
+        {
+            error = lpng::lodepng_chunk_create(&m_buffer, &m_buffer_size,
+                                               0, "IEND", NULL);
+        }
+    }
+
+    for(int c = 0; c < num_chunks; ++c)
+    {
+        free(chunks[c]);
+    }
 
     if(error)
     {
-        ASCENT_WARN("lodepng_encode_memory failed")
+        Cleanup();
+        ASCENT_WARN("png encoding failed: " << lpng::lodepng_error_text(error));
     }
 }
 
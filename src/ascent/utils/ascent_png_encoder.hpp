@@ -65,6 +65,13 @@ public:
     PNGEncoder();
     ~PNGEncoder();
 
+    // compression of the png data: "default", "fast" or "none".
+    // "none" stores the rows uncompressed, which is the fastest to
+    // encode and decode
+    void           SetCompression(const std::string &compression);
+    std::string    Compression() const;
+
+    // rows are filtered and deflated in parallel when openmp is enabled
     void           Encode(const unsigned char *rgba_in,
                           const int width,
                           const int height);
@@ -82,8 +89,21 @@ public:
     void           Cleanup();
 
 private:
+    enum CompressionType
+    {
+        COMPRESSION_DEFAULT,
+        COMPRESSION_FAST,
+        COMPRESSION_NONE
+    };
+
+    void           EncodeRows(const unsigned char *rgba,
+                              const int width,
+                              const int height,
+                              const bool flip);
+
     unsigned char *m_buffer;
     size_t         m_buffer_size;
+    CompressionType m_compression;
     conduit::Node  m_base64_data;
 };
 
@@ -52,6 +52,7 @@
 
 #include <ascent_config.h>
 #include <ascent_file_system.hpp>
+#include <ascent_image_channel.hpp>
 #include <ascent_logging.hpp>
 
 // thirdparty includes
@@ -178,9 +179,26 @@ WebInterface::PushRenders(const Node &renders)
     while(itr.has_next())
     {
         const Node &curr = itr.next();
-        EncodeImage(curr.as_string(),
-                    msg["renders"].append());
+        const std::string image_name = curr["image_name"].as_string();
+        Node &render = msg["renders"].append();
 
+        // use the png held in memory if the renderer published it,
+        // otherwise read it back from disk
+        ImageChannel::FramePtr frame;
+        if(curr.has_child("cycle"))
+        {
+            frame = ImageChannel::Fetch(image_name,
+                                        curr["cycle"].to_int32());
+        }
+
+        if(frame)
+        {
+            frame->Base64Encode(render["data"]);
+        }
+        else
+        {
+            EncodeImage(image_name, render);
+        }
     }
 
 
@@ -84,6 +84,8 @@ public:
     void                            Enable();
 
     void                            PushMessage(const conduit::Node &msg);
+    // renders is the list of image params produced by the scenes
+    // (image_name, cycle, ...)
     void                            PushRenders(const conduit::Node &renders);
 
 private:
@@ -0,0 +1,1067 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2015-2019, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-716457
+//
+// All rights reserved.
+//
+// This file is part of Ascent.
+//
+// For details, see: http://ascent.readthedocs.io/.
+//
+// Please also read ascent/LICENSE
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the disclaimer below.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the disclaimer (as noted below) in the
+//   documentation and/or other materials provided with the distribution.
+//
+// * Neither the name of the LLNS/LLNL nor the names of its contributors may
+//   be used to endorse or promote products derived from this software without
+//   specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL LAWRENCE LIVERMORE NATIONAL SECURITY,
+// LLC, THE U.S. DEPARTMENT OF ENERGY OR CONTRIBUTORS BE LIABLE FOR ANY
+// DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//-----------------------------------------------------------------------------
+///
+/// file: ascent_benchmark.cpp
+///
+/// In situ benchmark driver. Publishes synthetic noise data sets (uniform,
+/// rectilinear, explicit hex or tet meshes) to Ascent and reports the time
+/// of each stage, and the bytes copied, as json.
+///
+//-----------------------------------------------------------------------------
+
+#include "open_simplex_noise.h"
+
+#include <ascent.hpp>
+#include <conduit.hpp>
+#include <flow_trace.hpp>
+
+#include <algorithm>
+#include <assert.h>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#ifdef PARALLEL
+#include <mpi.h>
+#include <conduit_relay_mpi.hpp>
+#endif
+
+struct Options
+{
+  int         m_dims[3];
+  std::string m_mesh_type;
+  int         m_domains;
+  int         m_cycles;
+  int         m_warmup;
+  double      m_time_delta;
+  std::string m_actions;
+  std::string m_actions_file;
+  std::string m_output;
+
+  Options()
+    : m_dims{32,32,32},
+      m_mesh_type("uniform"),
+      m_domains(1),
+      m_cycles(10),
+      m_warmup(1),
+      m_time_delta(0.5),
+      m_actions("render"),
+      m_actions_file(""),
+      m_output("ascent_benchmark")
+  {
+  }
+
+  void Parse(int argc, char** argv)
+  {
+    for(int i = 1; i < argc; ++i)
+    {
+      if(contains(argv[i], "--dims="))
+      {
+        std::vector<std::string> dims = split(GetArg(argv[i]), ',');
+
+        if(dims.size() != 3)
+        {
+          Usage(argv[i]);
+        }
+
+        m_dims[0] = stoi(dims[0]);
+        m_dims[1] = stoi(dims[1]);
+        m_dims[2] = stoi(dims[2]);
+      }
+      else if(contains(argv[i], "--mesh="))
+      {
+        m_mesh_type = GetArg(argv[i]);
+        if(m_mesh_type != "uniform" &&
+           m_mesh_type != "rectilinear" &&
+           m_mesh_type != "hexs" &&
+           m_mesh_type != "tets")
+        {
+          Usage(argv[i]);
+        }
+      }
+      else if(contains(argv[i], "--domains="))
+      {
+        m_domains = stoi(GetArg(argv[i]));
+        if(m_domains < 1)
+        {
+          Usage(argv[i]);
+        }
+      }
+      else if(contains(argv[i], "--cycles="))
+      {
+        m_cycles = stoi(GetArg(argv[i]));
+      }
+      else if(contains(argv[i], "--warmup="))
+      {
+        m_warmup = stoi(GetArg(argv[i]));
+      }
+      else if(contains(argv[i], "--time_delta="))
+      {
+        m_time_delta = stof(GetArg(argv[i]));
+      }
+      else if(contains(argv[i], "--actions_file="))
+      {
+        m_actions_file = GetArg(argv[i]);
+      }
+      else if(contains(argv[i], "--actions="))
+      {
+        m_actions = GetArg(argv[i]);
+        if(m_actions != "render" &&
+           m_actions != "contour" &&
+           m_actions != "volume" &&
+           m_actions != "slice" &&
+           m_actions != "extract" &&
+           m_actions != "all")
+        {
+          Usage(argv[i]);
+        }
+      }
+      else if(contains(argv[i], "--output="))
+      {
+        m_output = GetArg(argv[i]);
+      }
+      else
+      {
+        Usage(argv[i]);
+      }
+    }
+  }
+
+  std::string GetArg(const char *arg)
+  {
+    std::vector<std::string> parse;
+    std::string s_arg(arg);
+    std::string res;
+
+    parse = split(s_arg, '=');
+
+    if(parse.size() != 2)
+    {
+      Usage(arg);
+    }
+    else
+    {
+      res = parse[1];
+    }
+    return res;
+  }
+
+  void Print() const
+  {
+    std::cout<<"======== Benchmark Options =========\n";
+    std::cout<<"dims         : ("<<m_dims[0]<<", "<<m_dims[1]<<", "<<m_dims[2]<<")\n";
+    std::cout<<"mesh         : "<<m_mesh_type<<"\n";
+    std::cout<<"domains/rank : "<<m_domains<<"\n";
+    std::cout<<"cycles       : "<<m_cycles<<" (+ "<<m_warmup<<" warmup)\n";
+    if(m_actions_file != "")
+    {
+      std::cout<<"actions file : "<<m_actions_file<<"\n";
+    }
+    else
+    {
+      std::cout<<"actions      : "<<m_actions<<"\n";
+    }
+    std::cout<<"output       : "<<m_output<<".json\n";
+    std::cout<<"====================================\n";
+  }
+
+  void Usage(std::string bad_arg)
+  {
+    std::cerr<<"Invalid argument \""<<bad_arg<<"\"\n";
+    std::cout<<"Benchmark usage: "
+             <<"       --dims         : global data set dimensions in cells (ex: --dims=32,32,32)\n"
+             <<"       --mesh         : uniform, rectilinear, hexs or tets (ex: --mesh=uniform)\n"
+             <<"       --domains      : number of domains per rank (ex: --domains=1)\n"
+             <<"       --cycles       : number of measured cycles (ex: --cycles=10)\n"
+             <<"       --warmup       : number of cycles run before measuring (ex: --warmup=1)\n"
+             <<"       --time_delta   : amount of time to advance per cycle (ex: --time_delta=0.5)\n"
+             <<"       --actions      : render, contour, volume, slice, extract or all (ex: --actions=render)\n"
+             <<"       --actions_file : ascent actions file used instead of --actions\n"
+             <<"       --output       : base name of the json results (ex: --output=ascent_benchmark)\n";
+    exit(0);
+  }
+
+  std::vector<std::string> &split(const std::string &s,
+                                  char delim,
+                                  std::vector<std::string> &elems)
+  {
+    std::stringstream ss(s);
+    std::string item;
+
+    while (std::getline(ss, item, delim))
+    {
+       elems.push_back(item);
+    }
+    return elems;
+  }
+
+  std::vector<std::string> split(const std::string &s, char delim)
+  {
+    std::vector<std::string> elems;
+    split(s, delim, elems);
+    return elems;
+  }
+
+  bool contains(const std::string haystack, std::string needle)
+  {
+    std::size_t found = haystack.find(needle);
+    return (found != std::string::npos);
+  }
+};
+
+struct SpatialDivision
+{
+  int m_mins[3];
+  int m_maxs[3];
+
+  SpatialDivision()
+    : m_mins{0,0,0},
+      m_maxs{1,1,1}
+  {
+
+  }
+
+  bool CanSplit(int dim)
+  {
+    return m_maxs[dim] - m_mins[dim] + 1> 1;
+  }
+
+  SpatialDivision Split(int dim)
+  {
+    SpatialDivision r_split;
+    r_split = *this;
+    assert(CanSplit(dim));
+    int size = m_maxs[dim] - m_mins[dim] + 1;
+    int left_offset = size / 2;
+
+    //shrink the left side
+    m_maxs[dim] = m_mins[dim] + left_offset - 1;
+    //shrink the right side
+    r_split.m_mins[dim] = m_maxs[dim] + 1;
+    return r_split;
+  }
+};
+
+//
+// splits div into count pieces, alternating the split dimension.
+// pieces that can't be split any further are left empty.
+//
+std::vector<SpatialDivision> Divide(const SpatialDivision &div, int count)
+{
+  std::vector<SpatialDivision> divs;
+  divs.push_back(div);
+  int avail = count - 1;
+  int current_dim = 0;
+  int missed_splits = 0;
+  const int num_dims = 3;
+  while(avail > 0)
+  {
+    const int current_size = divs.size();
+    int temp_avail = avail;
+    for(int i = 0; i < current_size; ++i)
+    {
+      if(avail == 0) break;
+      if(!divs[i].CanSplit(current_dim))
+      {
+        continue;
+      }
+      divs.push_back(divs[i].Split(current_dim));
+      --avail;
+    }
+    if(temp_avail == avail)
+    {
+      missed_splits++;
+      if(missed_splits == 3)
+      {
+        // we tried all three dims and could not make a split
+        for(int i = 0; i < avail; ++i)
+        {
+          SpatialDivision empty;
+          empty.m_maxs[0] = -1;
+          divs.push_back(empty);
+        }
+        avail = 0;
+      }
+    }
+    else
+    {
+      missed_splits = 0;
+    }
+
+    current_dim = (current_dim + 1) % num_dims;
+  }
+  return divs;
+}
+
+struct Domain
+{
+  int                 m_cell_dims[3];
+  int                 m_point_dims[3];
+  int                 m_point_size;
+  int                 m_hex_size;
+  int                 m_cell_size;
+  double              m_spacing[3];
+  double              m_origin[3];
+  std::string         m_mesh_type;
+  int                 m_domain_id;
+
+  std::vector<double> m_coords[3];
+  std::vector<int>    m_conn;
+  std::vector<double> m_nodal_scalars;
+  std::vector<double> m_zonal_scalars;
+
+  Domain(const Options &options,
+         const SpatialDivision &div,
+         int domain_id)
+    : m_mesh_type(options.m_mesh_type),
+      m_domain_id(domain_id)
+  {
+    for(int d = 0; d < 3; ++d)
+    {
+      m_cell_dims[d]  = std::max(div.m_maxs[d] - div.m_mins[d] + 1, 0);
+      m_point_dims[d] = m_cell_dims[d] + 1;
+      m_spacing[d]    = 10. / double(options.m_dims[d]);
+      m_origin[d]     = double(div.m_mins[d]) * m_spacing[d];
+    }
+
+    m_point_size = m_point_dims[0] * m_point_dims[1] * m_point_dims[2];
+    m_hex_size   = m_cell_dims[0] * m_cell_dims[1] * m_cell_dims[2];
+    // each hex is split into 6 tets
+    m_cell_size  = m_mesh_type == "tets" ? 6 * m_hex_size : m_hex_size;
+
+    m_nodal_scalars.resize(m_point_size);
+    m_zonal_scalars.resize(m_cell_size);
+
+    if(m_mesh_type == "rectilinear")
+    {
+      for(int d = 0; d < 3; ++d)
+      {
+        m_coords[d].resize(m_point_dims[d]);
+        for(int i = 0; i < m_point_dims[d]; ++i)
+        {
+          m_coords[d][i] = m_origin[d] + m_spacing[d] * double(i);
+        }
+      }
+    }
+    else if(m_mesh_type == "hexs" || m_mesh_type == "tets")
+    {
+      InitExplicit();
+    }
+  }
+
+  int PointId(int x, int y, int z) const
+  {
+    return z * m_point_dims[0] * m_point_dims[1] +
+           y * m_point_dims[0] + x;
+  }
+
+  void InitExplicit()
+  {
+    for(int d = 0; d < 3; ++d)
+    {
+      m_coords[d].resize(m_point_size);
+    }
+
+    for(int z = 0; z < m_point_dims[2]; ++z)
+      for(int y = 0; y < m_point_dims[1]; ++y)
+        for(int x = 0; x < m_point_dims[0]; ++x)
+        {
+          const int id = PointId(x,y,z);
+          m_coords[0][id] = m_origin[0] + m_spacing[0] * double(x);
+          m_coords[1][id] = m_origin[1] + m_spacing[1] * double(y);
+          m_coords[2][id] = m_origin[2] + m_spacing[2] * double(z);
+        }
+
+    const bool tets = m_mesh_type == "tets";
+    m_conn.reserve(tets ? m_hex_size * 24 : m_hex_size * 8);
+
+    for(int z = 0; z < m_cell_dims[2]; ++z)
+      for(int y = 0; y < m_cell_dims[1]; ++y)
+        for(int x = 0; x < m_cell_dims[0]; ++x)
+        {
+          int hex[8];
+          hex[0] = PointId(x,   y,   z);
+          hex[1] = PointId(x+1, y,   z);
+          hex[2] = PointId(x+1, y+1, z);
+          hex[3] = PointId(x,   y+1, z);
+          hex[4] = PointId(x,   y,   z+1);
+          hex[5] = PointId(x+1, y,   z+1);
+          hex[6] = PointId(x+1, y+1, z+1);
+          hex[7] = PointId(x,   y+1, z+1);
+
+          if(!tets)
+          {
+            m_conn.insert(m_conn.end(), hex, hex + 8);
+            continue;
+          }
+
+          // six tets around the 0-6 diagonal
+          const int tet_verts[6][4] = {{0,1,2,6},
+                                       {0,2,3,6},
+                                       {0,3,7,6},
+                                       {0,7,4,6},
+                                       {0,4,5,6},
+                                       {0,5,1,6}};
+          for(int t = 0; t < 6; ++t)
+          {
+            for(int v = 0; v < 4; ++v)
+            {
+              m_conn.push_back(hex[tet_verts[t][v]]);
+            }
+          }
+        }
+  }
+
+  // the simulation step, not measured
+  void Update(osn_context *ctx_nodal, osn_context *ctx_zonal, double time)
+  {
+    const int cells_per_hex = m_mesh_type == "tets" ? 6 : 1;
+    for(int z = 0; z < m_point_dims[2]; ++z)
+      for(int y = 0; y < m_point_dims[1]; ++y)
+#ifdef NOISE_USE_OPENMP
+        #pragma omp parallel for
+#endif
+        for(int x = 0; x < m_point_dims[0]; ++x)
+        {
+          double coord[3];
+          coord[0] = m_origin[0] + m_spacing[0] * double(x);
+          coord[1] = m_origin[1] + m_spacing[1] * double(y);
+          coord[2] = m_origin[2] + m_spacing[2] * double(z);
+          m_nodal_scalars[PointId(x,y,z)] =
+            open_simplex_noise4(ctx_nodal, coord[0], coord[1], coord[2], time);
+
+          if(x < m_cell_dims[0] &&
+             y < m_cell_dims[1] &&
+             z < m_cell_dims[2] )
+          {
+            double val_cell =
+              open_simplex_noise4(ctx_zonal, coord[0], coord[1], coord[2], time);
+            const int hex = z * m_cell_dims[0] * m_cell_dims[1] +
+                            y * m_cell_dims[0] + x;
+            for(int c = 0; c < cells_per_hex; ++c)
+            {
+              m_zonal_scalars[hex * cells_per_hex + c] = val_cell;
+            }
+          }
+        }
+  }
+
+  void PopulateNode(conduit::Node &node)
+  {
+    node["state/domain_id"] = m_domain_id;
+
+    if(m_mesh_type == "uniform")
+    {
+      node["coordsets/coords/type"] = "uniform";
+
+      node["coordsets/coords/dims/i"] = m_point_dims[0];
+      node["coordsets/coords/dims/j"] = m_point_dims[1];
+      node["coordsets/coords/dims/k"] = m_point_dims[2];
+
+      node["coordsets/coords/origin/x"] = m_origin[0];
+      node["coordsets/coords/origin/y"] = m_origin[1];
+      node["coordsets/coords/origin/z"] = m_origin[2];
+
+      node["coordsets/coords/spacing/dx"] = m_spacing[0];
+      node["coordsets/coords/spacing/dy"] = m_spacing[1];
+      node["coordsets/coords/spacing/dz"] = m_spacing[2];
+
+      node["topologies/mesh/type"]     = "uniform";
+      node["topologies/mesh/coordset"] = "coords";
+    }
+    else if(m_mesh_type == "rectilinear")
+    {
+      node["coordsets/coords/type"] = "rectilinear";
+      node["coordsets/coords/values/x"].set_external(m_coords[0]);
+      node["coordsets/coords/values/y"].set_external(m_coords[1]);
+      node["coordsets/coords/values/z"].set_external(m_coords[2]);
+
+      node["topologies/mesh/type"]     = "rectilinear";
+      node["topologies/mesh/coordset"] = "coords";
+    }
+    else
+    {
+      node["coordsets/coords/type"] = "explicit";
+      node["coordsets/coords/values/x"].set_external(m_coords[0]);
+      node["coordsets/coords/values/y"].set_external(m_coords[1]);
+      node["coordsets/coords/values/z"].set_external(m_coords[2]);
+
+      node["topologies/mesh/type"]     = "unstructured";
+      node["topologies/mesh/coordset"] = "coords";
+      node["topologies/mesh/elements/shape"] =
+        m_mesh_type == "tets" ? "tet" : "hex";
+      node["topologies/mesh/elements/connectivity"].set_external(m_conn);
+    }
+
+    node["fields/nodal_noise/association"] = "vertex";
+    node["fields/nodal_noise/type"]        = "scalar";
+    node["fields/nodal_noise/topology"]    = "mesh";
+    node["fields/nodal_noise/values"].set_external(m_nodal_scalars);
+
+    node["fields/zonal_noise/association"] = "element";
+    node["fields/zonal_noise/type"]        = "scalar";
+    node["fields/zonal_noise/topology"]    = "mesh";
+    node["fields/zonal_noise/values"].set_external(m_zonal_scalars);
+  }
+
+  bool Empty() const
+  {
+    return m_hex_size == 0;
+  }
+};
+
+int Rank()
+{
+  int rank = 0;
+#ifdef PARALLEL
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+#endif
+  return rank;
+}
+
+int Size()
+{
+  int size = 1;
+#ifdef PARALLEL
+  MPI_Comm_size(MPI_COMM_WORLD, &size);
+#endif
+  return size;
+}
+
+void BuildActions(const std::string &action_set,
+                  const std::string &output,
+                  conduit::Node &actions)
+{
+  const bool all = action_set == "all";
+
+  conduit::Node pipelines;
+  conduit::Node scenes;
+  conduit::Node extracts;
+
+  if(all || action_set == "render")
+  {
+    scenes["s_render/plots/p1/type"]  = "pseudocolor";
+    scenes["s_render/plots/p1/field"] = "zonal_noise";
+    scenes["s_render/image_prefix"]   = output + "_render_%04d";
+  }
+
+  if(all || action_set == "contour")
+  {
+    pipelines["pl_contour/f1/type"] = "contour";
+    pipelines["pl_contour/f1/params/field"] = "nodal_noise";
+    pipelines["pl_contour/f1/params/iso_values"] = 0.3;
+
+    scenes["s_contour/plots/p1/type"]     = "pseudocolor";
+    scenes["s_contour/plots/p1/pipeline"] = "pl_contour";
+    scenes["s_contour/plots/p1/field"]    = "nodal_noise";
+    scenes["s_contour/image_prefix"]      = output + "_contour_%04d";
+  }
+
+  if(all || action_set == "volume")
+  {
+    scenes["s_volume/plots/p1/type"]  = "volume";
+    scenes["s_volume/plots/p1/field"] = "zonal_noise";
+    scenes["s_volume/image_prefix"]   = output + "_volume_%04d";
+  }
+
+  if(all || action_set == "slice")
+  {
+    pipelines["pl_slice/f1/type"] = "slice";
+    pipelines["pl_slice/f1/params/point/x"] = 5.0;
+    pipelines["pl_slice/f1/params/point/y"] = 5.0;
+    pipelines["pl_slice/f1/params/point/z"] = 5.0;
+    pipelines["pl_slice/f1/params/normal/x"] = 0.0;
+    pipelines["pl_slice/f1/params/normal/y"] = 0.0;
+    pipelines["pl_slice/f1/params/normal/z"] = 1.0;
+
+    scenes["s_slice/plots/p1/type"]     = "pseudocolor";
+    scenes["s_slice/plots/p1/pipeline"] = "pl_slice";
+    scenes["s_slice/plots/p1/field"]    = "zonal_noise";
+    scenes["s_slice/image_prefix"]      = output + "_slice_%04d";
+  }
+
+  if(all || action_set == "extract")
+  {
+    extracts["e_relay/type"] = "relay";
+    extracts["e_relay/params/path"] = output + "_extract";
+    extracts["e_relay/params/protocol"] = "blueprint/mesh/hdf5";
+  }
+
+  if(pipelines.number_of_children() > 0)
+  {
+    conduit::Node &add_pipelines = actions.append();
+    add_pipelines["action"] = "add_pipelines";
+    add_pipelines["pipelines"] = pipelines;
+  }
+
+  if(scenes.number_of_children() > 0)
+  {
+    conduit::Node &add_scenes = actions.append();
+    add_scenes["action"] = "add_scenes";
+    add_scenes["scenes"] = scenes;
+  }
+
+  if(extracts.number_of_children() > 0)
+  {
+    conduit::Node &add_extracts = actions.append();
+    add_extracts["action"] = "add_extracts";
+    add_extracts["extracts"] = extracts;
+  }
+}
+
+bool StartsWith(const std::string &str, const std::string &prefix)
+{
+  return str.compare(0, prefix.size(), prefix) == 0;
+}
+
+void Accumulate(conduit::Node &node, double value)
+{
+  if(node.dtype().is_empty())
+  {
+    node = 0.0;
+  }
+  node = node.to_float64() + value;
+}
+
+//
+// sorts the trace events of a cycle into stages, times are in seconds
+//
+//   conversion : ensure_* and blueprint_verify filters
+//   filters    : pipeline filters and the rest of the graph
+//   render     : exec_scene and rover filters (includes vtk-h compositing)
+//   composite  : rover compositing
+//   io         : relay filters and async relay writes
+//
+void CycleStages(const conduit::Node &events,
+                 int cycle,
+                 conduit::Node &stats)
+{
+  stats["stages/conversion"] = 0.0;
+  stats["stages/filters"]    = 0.0;
+  stats["stages/render"]     = 0.0;
+  stats["stages/composite"]  = 0.0;
+  stats["stages/io"]         = 0.0;
+  stats["bytes/written"]     = 0.0;
+
+  const int num_events = events.number_of_children();
+  for(int i = 0; i < num_events; ++i)
+  {
+    const conduit::Node &event = events.child(i);
+    if(event["cycle"].to_int() != cycle)
+    {
+      continue;
+    }
+
+    const std::string name = event["name"].as_string();
+    const std::string cat  = event["cat"].as_string();
+    const std::string node = event["node"].as_string();
+    const double dur = event["dur"].to_float64() * 1e-6;
+
+    if(StartsWith(cat, "flow"))
+    {
+      if(node == "")
+      {
+        // the graph execute, measured by the driver
+        continue;
+      }
+
+      conduit::Node &filter = stats["filters"][node];
+      filter["type"] = name;
+      Accumulate(filter["time"], dur);
+
+      std::string stage = "filters";
+      if(StartsWith(name, "ensure_") || name == "blueprint_verify")
+      {
+        stage = "conversion";
+      }
+      else if(name == "exec_scene" || StartsWith(name, "rover_"))
+      {
+        stage = "render";
+      }
+      else if(StartsWith(name, "relay_"))
+      {
+        stage = "io";
+        if(event.has_child("bytes"))
+        {
+          Accumulate(stats["bytes/written"], event["bytes"].to_float64());
+        }
+      }
+      Accumulate(stats["stages/" + stage], dur);
+    }
+    else if(cat == "rover" && name.find("composit") != std::string::npos)
+    {
+      Accumulate(stats["stages/composite"], dur);
+    }
+    else if(cat == "io")
+    {
+      Accumulate(stats["stages/io"], dur);
+    }
+  }
+}
+
+//
+// bytes the vtk-m conversion copied or viewed in place
+//
+void CycleBytes(const conduit::Node &info, conduit::Node &stats)
+{
+  stats["bytes/copied"]      = 0.0;
+  stats["bytes/zero_copied"] = 0.0;
+  if(!info.has_child("field_import"))
+  {
+    return;
+  }
+
+  const conduit::Node &fields = info["field_import"];
+  for(int i = 0; i < fields.number_of_children(); ++i)
+  {
+    const conduit::Node &field = fields.child(i);
+    const double bytes = field["bytes"].to_float64();
+    if(field["copied"].as_string() == "true")
+    {
+      Accumulate(stats["bytes/copied"], bytes);
+    }
+    else
+    {
+      Accumulate(stats["bytes/zero_copied"], bytes);
+    }
+  }
+}
+
+//
+// min, avg and max over ranks of every numeric leaf of rank 0's stats
+//
+void ReduceLeaves(const std::vector<const conduit::Node*> &ranks,
+                  const conduit::Node &node,
+                  const std::string &path,
+                  conduit::Node &out)
+{
+  if(node.number_of_children() > 0)
+  {
+    for(int i = 0; i < node.number_of_children(); ++i)
+    {
+      const conduit::Node &child = node.child(i);
+      std::string child_path = path == "" ? child.name()
+                                          : path + "/" + child.name();
+      ReduceLeaves(ranks, child, child_path, out[child.name()]);
+    }
+    return;
+  }
+
+  if(node.dtype().is_string())
+  {
+    out = node.as_string();
+    return;
+  }
+  double min_val = 0.;
+  double max_val = 0.;
+  double sum = 0.;
+  for(size_t r = 0; r < ranks.size(); ++r)
+  {
+    double val = 0.;
+    if(ranks[r]->has_path(path))
+    {
+      val = (*ranks[r])[path].to_float64();
+    }
+    min_val = r == 0 ? val : std::min(min_val, val);
+    max_val = r == 0 ? val : std::max(max_val, val);
+    sum += val;
+  }
+  out["min"] = min_val;
+  out["avg"] = sum / double(ranks.size());
+  out["max"] = max_val;
+}
+
+void ReduceStats(const conduit::Node &stats, conduit::Node &out)
+{
+  std::vector<const conduit::Node*> ranks;
+#ifdef PARALLEL
+  conduit::Node gathered;
+  conduit::relay::mpi::gather_using_schema(stats,
+                                           gathered,
+                                           0,
+                                           MPI_COMM_WORLD);
+  if(Rank() != 0)
+  {
+    return;
+  }
+  for(int r = 0; r < gathered.number_of_children(); ++r)
+  {
+    ranks.push_back(&gathered.child(r));
+  }
+  ReduceLeaves(ranks, gathered.child(0), "", out);
+#else
+  ranks.push_back(&stats);
+  ReduceLeaves(ranks, stats, "", out);
+#endif
+}
+
+//
+// mean over cycles of the per cycle max over ranks
+//
+void Summarize(const conduit::Node &cycles, conduit::Node &summary)
+{
+  const int num_cycles = cycles.number_of_children();
+  if(num_cycles == 0)
+  {
+    return;
+  }
+
+  const conduit::Node &first = cycles.child(0);
+  std::vector<std::string> keys;
+  keys.push_back("publish");
+  keys.push_back("execute");
+  keys.push_back("stages");
+  keys.push_back("bytes");
+
+  for(size_t k = 0; k < keys.size(); ++k)
+  {
+    if(!first.has_child(keys[k]))
+    {
+      continue;
+    }
+    const conduit::Node &n_first = first[keys[k]];
+    const bool is_leaf = n_first.has_child("max");
+    const int num_children = is_leaf ? 1 : n_first.number_of_children();
+    for(int c = 0; c < num_children; ++c)
+    {
+      std::string path = keys[k];
+      if(!is_leaf)
+      {
+        path += "/" + n_first.child(c).name();
+      }
+
+      double sum = 0.;
+      for(int i = 0; i < num_cycles; ++i)
+      {
+        if(cycles.child(i).has_path(path + "/max"))
+        {
+          sum += cycles.child(i)[path + "/max"].to_float64();
+        }
+      }
+      summary[path] = sum / double(num_cycles);
+    }
+  }
+}
+
+int main(int argc, char** argv)
+{
+#ifdef PARALLEL
+  MPI_Init(&argc, &argv);
+#endif
+
+  Options options;
+  options.Parse(argc, argv);
+
+  const int rank = Rank();
+  const int size = Size();
+
+  if(rank == 0) options.Print();
+
+  //
+  // split the global cells across ranks, then each rank's cells into
+  // its domains. Inclusive ranges: cell dim = 32 -> [0,31]
+  //
+  SpatialDivision global_div;
+  global_div.m_maxs[0] = options.m_dims[0] - 1;
+  global_div.m_maxs[1] = options.m_dims[1] - 1;
+  global_div.m_maxs[2] = options.m_dims[2] - 1;
+
+  SpatialDivision rank_div = Divide(global_div, size).at(rank);
+  std::vector<SpatialDivision> domain_divs = Divide(rank_div, options.m_domains);
+
+  std::vector<Domain*> domains;
+  for(size_t i = 0; i < domain_divs.size(); ++i)
+  {
+    const int domain_id = rank * options.m_domains + int(i);
+    domains.push_back(new Domain(options, domain_divs[i], domain_id));
+  }
+
+  struct osn_context *ctx_zonal;
+  struct osn_context *ctx_nodal;
+  open_simplex_noise(77374, &ctx_nodal);
+  open_simplex_noise(59142, &ctx_zonal);
+
+  double time = 0;
+  int cycle = 0;
+
+  //
+  // Open and setup ascent, tracing gives the per filter times
+  //
+  ascent::Ascent ascent;
+  conduit::Node ascent_opts;
+#ifdef PARALLEL
+  ascent_opts["mpi_comm"] = MPI_Comm_c2f(MPI_COMM_WORLD);
+#endif
+  ascent_opts["runtime/type"] = "ascent";
+  // a failed execute should fail the run, not skew the timings
+  ascent_opts["exceptions"] = "forward";
+  ascent_opts["trace/enabled"] = "true";
+  ascent_opts["trace/file"] = options.m_output + "_trace";
+  ascent_opts["trace/output"] = "merged";
+  ascent_opts["trace/buffer_size"] = 1 << 20;
+  if(options.m_actions_file != "")
+  {
+    ascent_opts["actions_file"] = options.m_actions_file;
+  }
+  ascent.open(ascent_opts);
+
+  conduit::Node mesh_data;
+  for(size_t i = 0; i < domains.size(); ++i)
+  {
+    if(domains[i]->Empty())
+    {
+      continue;
+    }
+    conduit::Node &dom = mesh_data.append();
+    dom["state/time"].set_external(&time);
+    dom["state/cycle"].set_external(&cycle);
+    domains[i]->PopulateNode(dom);
+  }
+
+  conduit::Node actions;
+  if(options.m_actions_file == "")
+  {
+    BuildActions(options.m_actions, options.m_output, actions);
+  }
+
+  conduit::Node results;
+  results["options/mesh"] = options.m_mesh_type;
+  results["options/dims"].set(options.m_dims, 3);
+  results["options/domains_per_rank"] = options.m_domains;
+  results["options/ranks"] = size;
+  results["options/cycles"] = options.m_cycles;
+  results["options/warmup"] = options.m_warmup;
+  if(options.m_actions_file != "")
+  {
+    results["options/actions_file"] = options.m_actions_file;
+  }
+  else
+  {
+    results["options/actions"] = options.m_actions;
+  }
+
+  const int total_cycles = options.m_warmup + options.m_cycles;
+  for(int t = 0; t < total_cycles; ++t)
+  {
+    for(size_t i = 0; i < domains.size(); ++i)
+    {
+      domains[i]->Update(ctx_nodal, ctx_zonal, time);
+    }
+
+    time += options.m_time_delta;
+    cycle++;
+
+#ifdef PARALLEL
+    // time ascent, not the simulation imbalance
+    MPI_Barrier(MPI_COMM_WORLD);
+#endif
+
+    auto t_publish = std::chrono::steady_clock::now();
+    ascent.publish(mesh_data);
+    auto t_execute = std::chrono::steady_clock::now();
+    ascent.execute(actions);
+    auto t_done = std::chrono::steady_clock::now();
+
+    if(t < options.m_warmup)
+    {
+      continue;
+    }
+
+    conduit::Node stats;
+    stats["publish"] =
+      std::chrono::duration<double>(t_execute - t_publish).count();
+    stats["execute"] =
+      std::chrono::duration<double>(t_done - t_execute).count();
+
+    conduit::Node events;
+    flow::Tracer::events(events);
+    CycleStages(events, cycle, stats);
+
+    conduit::Node info;
+    ascent.info(info);
+    CycleBytes(info, stats);
+
+    conduit::Node reduced;
+    ReduceStats(stats, reduced);
+    if(rank == 0)
+    {
+      reduced["cycle"] = cycle;
+      results["cycles"].append().set(reduced);
+    }
+  }
+
+  //
+  // cleanup
+  //
+  open_simplex_noise_free(ctx_nodal);
+  open_simplex_noise_free(ctx_zonal);
+  ascent.close();
+
+  if(rank == 0)
+  {
+    if(results.has_child("cycles"))
+    {
+      Summarize(results["cycles"], results["summary"]);
+    }
+
+    std::ofstream out((options.m_output + ".json").c_str());
+    out << results.to_json();
+    out.close();
+    std::cout<<"Benchmark results written to "<<options.m_output<<".json\n";
+  }
+
+  for(size_t i = 0; i < domains.size(); ++i)
+  {
+    delete domains[i];
+  }
+
+#ifdef PARALLEL
+  MPI_Finalize();
+#endif
+}
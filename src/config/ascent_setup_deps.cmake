@@ -44,6 +44,11 @@
 
 include(CMakeFindDependencyMacro)
 
+###############################################################################
+# Setup Threads
+###############################################################################
+find_dependency(Threads REQUIRED)
+
 ###############################################################################
 # Setup Conduit
 ###############################################################################
@@ -100,6 +100,8 @@ Alias::declare_interface(Node &i)
     i["type_name"]   = "alias";
     i["port_names"].append() = "in";
     i["output_port"] = "true";
+    i["cacheable"]   = "true";
+    i["field_usage"] = "params";
 }
 
 
@@ -56,9 +56,14 @@
 
 // standard lib includes
 #include <iostream>
+#include <fstream>
+#include <sstream>
+#include <map>
+#include <set>
 #include <string.h>
 #include <limits.h>
 #include <cstdlib>
+#include <sys/stat.h>
 
 // conduit python module capi header
 #include "conduit_python.hpp"
@@ -132,6 +137,76 @@ class DataWrapper<PyObject>: public Data
 namespace filters
 {
 
+//-----------------------------------------------------------------------------
+// -- begin flow::filters::detail --
+//-----------------------------------------------------------------------------
+namespace detail
+{
+
+// modules whose input and output helpers are set up,
+// keyed by "module:input:set_output"
+static std::set<std::string> s_setup_modules;
+
+// a script compiled to a python code object
+struct CompiledScript
+{
+    CompiledScript()
+    : m_code(NULL),
+      m_stamp(""),
+      m_dict(NULL),
+      m_entry(NULL),
+      m_entry_name("")
+    {}
+
+    // drops the python objects, so the script is compiled again
+    void release()
+    {
+        Py_XDECREF(m_code);
+        Py_XDECREF(m_dict);
+        Py_XDECREF(m_entry);
+        m_code  = NULL;
+        m_dict  = NULL;
+        m_entry = NULL;
+        m_entry_name = "";
+    }
+
+    PyObject    *m_code;
+    // size and mtime of a script file when it was compiled
+    std::string  m_stamp;
+    // with an entry function, the script's own globals (a copy of
+    // the interpreter's globals) and the function it defined there,
+    // so scripts that define the same names don't collide
+    PyObject    *m_dict;
+    PyObject    *m_entry;
+    std::string  m_entry_name;
+};
+
+// compiled scripts, keyed by source text or file path.
+// released by PythonScript::clear_cache()
+static std::map<std::string,CompiledScript> s_scripts;
+
+//-----------------------------------------------------------------------------
+// size and modification time of a file, empty if it can't be read
+std::string
+file_stamp(const std::string &fname)
+{
+    struct stat f_stat;
+    if(stat(fname.c_str(), &f_stat) != 0)
+    {
+        return "";
+    }
+
+    std::ostringstream oss;
+    oss << f_stat.st_size << ":" << f_stat.st_mtime;
+    return oss.str();
+}
+
+//-----------------------------------------------------------------------------
+};
+//-----------------------------------------------------------------------------
+// -- end flow::filters::detail --
+//-----------------------------------------------------------------------------
+
 //-----------------------------------------------------------------------------
 flow::PythonInterpreter *PythonScript::m_interp = NULL;
 
@@ -253,6 +328,19 @@ PythonScript::verify_params(const conduit::Node &params,
             }
         }
 
+        if( n_iface.has_child("entry") )
+        {
+            if( !n_iface["entry"].dtype().is_string() )
+            {
+                info["errors"].append() = "parameter 'interface/entry' is not a string";
+                res = false;
+            }
+            else
+            {
+                info["info"].append().set("provides 'interface/entry' function called each execute");
+            }
+        }
+
         if( n_iface.has_child("set_output") )
         {
             if( !n_iface["set_output"].dtype().is_string() )
@@ -273,6 +361,156 @@ PythonScript::verify_params(const conduit::Node &params,
 
 
 
+//-----------------------------------------------------------------------------
+void
+PythonScript::setup_module(const std::string &module_name,
+                           const std::string &input_func_name,
+                           const std::string &set_output_func_name)
+{
+    PythonInterpreter *py_interp = interpreter();
+
+    std::ostringstream filter_setup_src_oss;
+    // lookup or create a new module
+    filter_setup_src_oss.str("");
+    filter_setup_src_oss << "def flow_setup_module(name):\n"
+                         << "    import sys\n"
+                         << "    import types\n"
+                         << "    if name in sys.modules.keys():\n"
+                         << "       return sys.modules[name]\n"
+                         << "    mymod = types.ModuleType(name)\n"
+                         << "    sys.modules[name] = mymod\n"
+                         << "    return mymod\n"
+                         << "\n"
+                         // setup the module
+                         << "flow_setup_module(\"" << module_name << "\")\n";
+    FLOW_CHECK_PYTHON_ERROR(py_interp->run_script(filter_setup_src_oss.str()));
+
+    filter_setup_src_oss.str("");
+    filter_setup_src_oss << "\n"
+                         // import into the global dict
+                         << "import " << module_name << "\n"
+                         << "\n";
+    FLOW_CHECK_PYTHON_ERROR(py_interp->run_script(filter_setup_src_oss.str()));
+
+    // fetch the module from the global dict (borrowed)
+    PyObject *py_mod = py_interp->get_global_object(module_name);
+
+    // sanity check
+    if( !PyModule_Check(py_mod) )
+    {
+        CONDUIT_ERROR("Unexpected error: " << module_name
+                      << " is not a python module!");
+    }
+
+    PyObject *py_mod_dict = PyModule_GetDict(py_mod);
+
+    // run script to establish input and output helpers in the module
+    // note: global here binds to module scope
+    filter_setup_src_oss.str("");
+    filter_setup_src_oss << "\n"
+                         << "_flow_input  = None\n"
+                         << "_flow_output = None\n"
+                         << "\n"
+                         << "def "<< input_func_name << "():\n"
+                         << "    return _flow_input\n"
+                         << "\n"
+                         << "def " << set_output_func_name <<  "(out):\n"
+                         << "    global _flow_output\n"
+                         << "    _flow_output = out\n"
+                         << "\n";
+
+    FLOW_CHECK_PYTHON_ERROR(py_interp->run_script(filter_setup_src_oss.str(),
+                                                  py_mod_dict));
+
+    // now import binding function names from the module,
+    // so the names are bound to the global ns
+    filter_setup_src_oss.str("");
+    filter_setup_src_oss << "\n"
+                         << "from " << module_name
+                         << " import "
+                         << input_func_name << ", "
+                         << set_output_func_name
+                         << "\n";
+
+    FLOW_CHECK_PYTHON_ERROR(py_interp->run_script(filter_setup_src_oss.str()));
+}
+
+//-----------------------------------------------------------------------------
+detail::CompiledScript &
+PythonScript::compiled_script()
+{
+    PythonInterpreter *py_interp = interpreter();
+
+    std::string key;
+    std::string stamp;
+    std::string code_name;
+
+    if( params().has_child("source") )
+    {
+        key = "source:" + params()["source"].as_string();
+        code_name = "<" + name() + ">";
+    }
+    else // file is the other case
+    {
+        code_name = params()["file"].as_string();
+        key   = "file:" + code_name;
+        stamp = detail::file_stamp(code_name);
+        if(stamp == "")
+        {
+            CONDUIT_ERROR("python_script failed to open " << code_name);
+        }
+    }
+
+    std::map<std::string,detail::CompiledScript>::iterator itr;
+    itr = detail::s_scripts.find(key);
+
+    if(itr != detail::s_scripts.end() &&
+       itr->second.m_stamp == stamp)
+    {
+        return itr->second;
+    }
+
+    // compile the (new or changed) script
+    std::string source;
+    if( params().has_child("source") )
+    {
+        source = params()["source"].as_string();
+    }
+    else
+    {
+        std::ifstream ifs(code_name.c_str());
+        if(!ifs.is_open())
+        {
+            CONDUIT_ERROR("python_script failed to open " << code_name);
+        }
+        source = std::string((std::istreambuf_iterator<char>(ifs)),
+                             std::istreambuf_iterator<char>());
+        ifs.close();
+    }
+
+    PyObject *py_code = py_interp->compile_script(source, code_name);
+    FLOW_CHECK_PYTHON_ERROR(py_code != NULL);
+
+    detail::CompiledScript &script = detail::s_scripts[key];
+    script.release();
+    script.m_code  = py_code;
+    script.m_stamp = stamp;
+
+    return script;
+}
+
+//-----------------------------------------------------------------------------
+void
+PythonScript::clear_cache()
+{
+    std::map<std::string,detail::CompiledScript>::iterator itr;
+    for(itr = detail::s_scripts.begin(); itr != detail::s_scripts.end(); ++itr)
+    {
+        itr->second.release();
+    }
+    detail::s_scripts.clear();
+}
+
 //-----------------------------------------------------------------------------
 void
 PythonScript::execute()
@@ -320,29 +558,29 @@ PythonScript::execute()
         set_output_func_name = params()["interface/set_output"].as_string();
     }
 
-    std::ostringstream filter_setup_src_oss;
-    // lookup or create a new module
-    filter_setup_src_oss.str("");
-    filter_setup_src_oss << "def flow_setup_module(name):\n"
-                         << "    import sys\n"
-                         << "    import imp\n"
-                         << "    if name in sys.modules.keys():\n"
-                         << "       return sys.modules[name]\n"
-                         << "    mymod = imp.new_module(name)\n"
-                         << "    sys.modules[name] = mymod\n"
-                         << "    return mymod\n"
-                         << "\n"
-                         // setup the module
-                         << "flow_setup_module(\"" << module_name << "\")\n";
-    FLOW_CHECK_PYTHON_ERROR(py_interp->run_script(filter_setup_src_oss.str()));
-
-    filter_setup_src_oss.str();
-    filter_setup_src_oss << "\n"
-                         // import into the global dict
-                         << "import " << module_name << "\n"
-                         << "\n";
-    FLOW_CHECK_PYTHON_ERROR(py_interp->run_script(filter_setup_src_oss.str()));
+    std::string entry_func_name = "";
+    if( params().has_path("interface/entry") )
+    {
+        entry_func_name = params()["interface/entry"].as_string();
+    }
 
+    // the module and its helpers are created once, unless the
+    // interpreter was reset since
+    const std::string setup_key = module_name + ":" +
+                                  input_func_name + ":" +
+                                  set_output_func_name;
+
+    if( detail::s_setup_modules.find(setup_key) ==
+            detail::s_setup_modules.end() ||
+        py_interp->get_global_object(module_name) == NULL ||
+        py_interp->get_global_object(input_func_name) == NULL ||
+        py_interp->get_global_object(set_output_func_name) == NULL )
+    {
+        setup_module(module_name,
+                     input_func_name,
+                     set_output_func_name);
+        detail::s_setup_modules.insert(setup_key);
+    }
 
     // fetch the module from the global dict (borrowed)
     PyObject *py_mod = py_interp->get_global_object(module_name);
@@ -350,56 +588,71 @@ PythonScript::execute()
     // sanity check
     if( !PyModule_Check(py_mod) )
     {
-        CONDUIT_ERROR("Unexpected error: " << module_name 
+        CONDUIT_ERROR("Unexpected error: " << module_name
                       << " is not a python module!");
     }
 
     // then grab the module's dict (borrowed)
-    //  where we will place our methods and bind our input data
+    //  where we bind our input data
     PyObject *py_mod_dict = PyModule_GetDict(py_mod);
 
-    // bind our input data
+    // bind our input data, and clear the last output
     FLOW_CHECK_PYTHON_ERROR(py_interp->set_dict_object(py_mod_dict,
                                                        py_input,
                                                        "_flow_input"));
 
-    // run script to establish input and output helpers in the module
-    // note: global here binds to module scope
-    filter_setup_src_oss.str("");
-    filter_setup_src_oss << "\n"
-                         << "_flow_output = None\n"
-                         << "\n"
-                         << "def "<< input_func_name << "():\n"
-                         << "    return _flow_input\n"
-                         << "\n"
-                         << "def " << set_output_func_name <<  "(out):\n"
-                         << "    global _flow_output\n"
-                         << "    _flow_output = out\n"
-                         << "\n";
-
-    FLOW_CHECK_PYTHON_ERROR(py_interp->run_script(filter_setup_src_oss.str(),
-                                                  py_mod_dict));
-
-    // now import binding function names from the module,
-    // so the names are bound to the global ns
-    filter_setup_src_oss.str("");
-    filter_setup_src_oss << "\n"
-                         << "from " << module_name 
-                         << " import " 
-                         << input_func_name << ", "
-                         << set_output_func_name
-                         << "\n";
-
-    FLOW_CHECK_PYTHON_ERROR(py_interp->run_script(filter_setup_src_oss.str()));
+    FLOW_CHECK_PYTHON_ERROR(py_interp->set_dict_object(py_mod_dict,
+                                                       Py_None,
+                                                       "_flow_output"));
 
+    detail::CompiledScript &script = compiled_script();
 
-    if( params().has_child("source") )
+    if(entry_func_name == "")
     {
-        FLOW_CHECK_PYTHON_ERROR(py_interp->run_script(params()["source"].as_string()));
+        // the whole script is the filter
+        FLOW_CHECK_PYTHON_ERROR(py_interp->run_code(script.m_code,
+                                                    py_interp->global_dict()));
     }
-    else // file is the other case
+    else
     {
-        FLOW_CHECK_PYTHON_ERROR(py_interp->run_script_file(params()["file"].as_string()));
+        // the script defines the entry function in its own globals,
+        // and only runs again when it changes
+        if(script.m_dict == NULL)
+        {
+            PyObject *py_dict = PyDict_Copy(py_interp->global_dict());
+            FLOW_CHECK_PYTHON_ERROR(py_dict != NULL);
+            if(!py_interp->run_code(script.m_code, py_dict))
+            {
+                // run again next execute
+                Py_DECREF(py_dict);
+                FLOW_CHECK_PYTHON_ERROR(false);
+            }
+            script.m_dict = py_dict;
+        }
+
+        if(script.m_entry == NULL ||
+           script.m_entry_name != entry_func_name)
+        {
+            Py_XDECREF(script.m_entry);
+            script.m_entry = NULL;
+
+            // borrowed
+            PyObject *py_entry = py_interp->get_dict_object(script.m_dict,
+                                                            entry_func_name);
+            if(py_entry == NULL || !PyCallable_Check(py_entry))
+            {
+                CONDUIT_ERROR("python_script entry function '"
+                              << entry_func_name << "' is not defined");
+            }
+
+            Py_INCREF(py_entry);
+            script.m_entry = py_entry;
+            script.m_entry_name = entry_func_name;
+        }
+
+        PyObject *py_entry_res = PyObject_CallObject(script.m_entry, NULL);
+        Py_XDECREF(py_entry_res);
+        FLOW_CHECK_PYTHON_ERROR(!py_interp->check_error());
     }
 
     PyObject *py_res = py_interp->get_dict_object(py_mod_dict,
@@ -80,6 +80,11 @@ class PythonInterpreter;
 namespace filters
 {
 
+namespace detail
+{
+    struct CompiledScript;
+};
+
 //-----------------------------------------------------------------------------
 ///
 /// PythonScript runs a given python source.
@@ -98,8 +103,20 @@ public:
                                  conduit::Node &info);
     virtual void   execute();
 
+    // releases the compiled scripts (and the globals of entry
+    // function scripts), they are compiled again on their next execute
+    static void    clear_cache();
+
 private:
 
+    // creates the module that binds the input and output helpers
+    void setup_module(const std::string &module_name,
+                      const std::string &input_func_name,
+                      const std::string &set_output_func_name);
+
+    // compiles the script on first use, or when its file changes
+    detail::CompiledScript &compiled_script();
+
     static flow::PythonInterpreter *interpreter();
     static flow::PythonInterpreter *m_interp;
 };
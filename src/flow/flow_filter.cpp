@@ -189,6 +189,53 @@ Filter::output_port() const
     return properties()["interface/output_port"].as_string() == "true";
 }
 
+//-----------------------------------------------------------------------------
+bool
+Filter::cacheable() const
+{
+    const Node &iface = properties()["interface"];
+    return iface.has_child("cacheable") &&
+           iface["cacheable"].as_string() == "true";
+}
+
+//-----------------------------------------------------------------------------
+bool
+Filter::reads_param_fields_only() const
+{
+    const Node &iface = properties()["interface"];
+    return iface.has_child("field_usage") &&
+           iface["field_usage"].as_string() == "params";
+}
+
+//-----------------------------------------------------------------------------
+void
+Filter::param_fields(std::set<std::string> &fields) const
+{
+    if(!properties().has_child("params"))
+    {
+        return;
+    }
+
+    const Node &p = properties()["params"];
+    if(p.has_child("field") && p["field"].dtype().is_string())
+    {
+        fields.insert(p["field"].as_string());
+    }
+
+    if(p.has_child("fields"))
+    {
+        NodeConstIterator itr = p["fields"].children();
+        while(itr.has_next())
+        {
+            const Node &n = itr.next();
+            if(n.dtype().is_string())
+            {
+                fields.insert(n.as_string());
+            }
+        }
+    }
+}
+
 //-----------------------------------------------------------------------------
 bool
 Filter::has_port(const std::string &port_name) const
@@ -316,6 +363,32 @@ Filter::verify_interface(const Node &i,
         info["info"].append().set("interface provides 'default_params'");
     }
 
+    if(i.has_child("cacheable"))
+    {
+        if(!i["cacheable"].dtype().is_string() ||
+           (i["cacheable"].as_string() != "true" &&
+            i["cacheable"].as_string() != "false"))
+        {
+            std::string msg = "interface 'cacheable' must be"
+                              " {\"true\" | \"false\"}";
+            info["errors"].append().set(msg);
+            res = false;
+        }
+    }
+
+    if(i.has_child("field_usage"))
+    {
+        if(!i["field_usage"].dtype().is_string() ||
+           (i["field_usage"].as_string() != "all" &&
+            i["field_usage"].as_string() != "params"))
+        {
+            std::string msg = "interface 'field_usage' must be"
+                              " {\"all\" | \"params\"}";
+            info["errors"].append().set(msg);
+            res = false;
+        }
+    }
+
 
     return res;
 }
@@ -54,6 +54,8 @@
 
 #include <conduit.hpp>
 
+#include <set>
+
 #include <flow_exports.h>
 #include <flow_config.h>
 
@@ -104,6 +106,19 @@ class Graph;
 ///    // inited with a *copy* of the default_params when the filter is
 ///    // added to the filter graph.
 ///    i["default_params"]["inc"].set((int)1);
+///
+///    // Optionally declare that the output only depends on the params
+///    // and the inputs (no side effects). When the workspace result cache
+///    // is enabled, the output of cacheable filters can be reused across
+///    // calls to execute(). (default = "false")
+///    i["cacheable"] = {"true" | "false"};
+///
+///    // Optionally declare which fields of its input this filter reads.
+///    // "params" means only the fields named by "field" and "fields"
+///    // params, other fields are at most passed along. The result cache
+///    // uses this to keep outputs when only unread fields change.
+///    // (default = "all")
+///    i["field_usage"] = {"all" | "params"};
 ///  }
 ///
 ///  2) Implement an execute() method:
@@ -174,6 +189,11 @@ public:
     std::string           type_name()   const;
     const conduit::Node  &port_names()  const;
     bool                  output_port() const;
+    bool                  cacheable() const;
+    /// true if the filter only reads the fields named in its params
+    bool                  reads_param_fields_only() const;
+    /// names of the fields given by the "field" and "fields" params
+    void                  param_fields(std::set<std::string> &fields) const;
 
     const conduit::Node  &default_params() const;
 
@@ -97,6 +97,15 @@ register_builtin()
 #endif
 }
 
+//-----------------------------------------------------------------------------
+void
+clear_python_script_cache()
+{
+#ifdef FLOW_PYTHON_ENABLED
+    PythonScript::clear_cache();
+#endif
+}
+
 
 //-----------------------------------------------------------------------------
 };
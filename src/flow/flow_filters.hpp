@@ -70,6 +70,10 @@ namespace filters
     // registers all built-in filter types.
     void FLOW_API register_builtin();
 
+    // releases the scripts the python_script filter compiled
+    // (no-op without python support)
+    void FLOW_API clear_python_script_cache();
+
 };
 //-----------------------------------------------------------------------------
 // -- end flow::filters --
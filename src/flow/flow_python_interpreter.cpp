@@ -556,6 +556,58 @@ PythonInterpreter::run_script_file(const std::string &fname,
 
 
 
+//-----------------------------------------------------------------------------
+///
+/// Compiles passed python script into a code object
+///
+//-----------------------------------------------------------------------------
+PyObject *
+PythonInterpreter::compile_script(const std::string &script,
+                                  const std::string &name)
+{
+    PyObject *py_code = NULL;
+    if(m_running)
+    {
+        py_code = Py_CompileString((char*)script.c_str(),
+                                   (char*)name.c_str(),
+                                   Py_file_input);
+        if(check_error())
+        {
+            Py_XDECREF(py_code);
+            py_code = NULL;
+        }
+    }
+    return py_code;
+}
+
+//-----------------------------------------------------------------------------
+///
+/// Executes a compiled python script in the given dict
+///
+//-----------------------------------------------------------------------------
+bool
+PythonInterpreter::run_code(PyObject *py_code,
+                            PyObject *py_dict)
+{
+    bool res = false;
+    if(m_running && py_code != NULL)
+    {
+#if defined(IS_PY3K)
+        PyObject *py_res = PyEval_EvalCode(py_code,
+                                           py_dict,
+                                           py_dict);
+#else
+        PyObject *py_res = PyEval_EvalCode((PyCodeObject*)py_code,
+                                           py_dict,
+                                           py_dict);
+#endif
+        Py_XDECREF(py_res);
+        if(!check_error())
+            res = true;
+    }
+    return res;
+}
+
 //-----------------------------------------------------------------------------
 ///
 /// Adds C python object to the global dictionary.
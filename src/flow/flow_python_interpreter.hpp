@@ -105,6 +105,14 @@ public:
     bool         run_script_file(const std::string &fname,
                                  PyObject *py_dict);
 
+    /// compiles a script into a code object that can be run many times,
+    /// returns a new reference or NULL on error
+    PyObject    *compile_script(const std::string &script,
+                                const std::string &name = "<string>");
+    /// executes a compiled script in the given dict
+    bool         run_code(PyObject *py_code,
+                          PyObject *py_dict);
+
     /// set into global dict
     bool         set_global_object(PyObject *py_obj,
                                    const std::string &name);
@@ -56,6 +56,7 @@
 #include <string.h>
 #include <limits.h>
 #include <cstdlib>
+#include <mutex>
 
 using namespace conduit;
 using namespace std;
@@ -142,6 +143,9 @@ public:
                Data &d,
                int refs_needed=-1);
 
+    void   add_untracked(const std::string &key,
+                         Data &d);
+
     bool   has_entry(const std::string &key);
     bool   has_value(void *data_ptr);
 
@@ -157,10 +161,15 @@ public:
 
     void   reset();
 
+    // filters may add entries while the workspace executes
+    // other filters in parallel
+    std::recursive_mutex &mutex() const;
+
 private:
 
     std::map<void*,Value*>         m_values;
     std::map<std::string,Entry*>   m_entries;
+    mutable std::recursive_mutex   m_mutex;
 
 };
 
@@ -396,6 +405,26 @@ Registry::Map::add(const std::string &key,
     }
 }
 
+//-----------------------------------------------------------------------------
+void
+Registry::Map::add_untracked(const std::string &key,
+                             Data &data)
+{
+    std::map<void*,Value*>::iterator itr = m_values.find(data.data_ptr());
+    if( itr != m_values.end() )
+    {
+        // someone else owns this data, other entries for the
+        // pointer must never release it either
+        Value *val = itr->second;
+        val->ref()->set_pending(-1);
+        m_entries[key] = new Entry(val,-1);
+    }
+    else
+    {
+        add(key,data,-1);
+    }
+}
+
 //-----------------------------------------------------------------------------
 Registry::Map::Entry *
 Registry::Map::fetch_entry(const std::string &key)
@@ -480,8 +509,22 @@ Registry::Map::detach(const std::string &key)
     // clean up bookkeeping obj
     delete ent;
     m_entries.erase(key);
-    // make sure we don't reap
-    value->ref()->set_pending(-1);
+
+    // if no other entry refs this pointer, drop the value as well so a
+    // later allocation at the same address isn't mistaken for it
+    std::map<std::string,Entry*>::const_iterator itr;
+    for(itr = m_entries.begin(); itr != m_entries.end(); itr++)
+    {
+        if(itr->second->value() == value)
+        {
+            // make sure we don't reap
+            value->ref()->set_pending(-1);
+            return;
+        }
+    }
+
+    m_values.erase(value->data_ptr());
+    delete value;
 }
 
 
@@ -556,6 +599,13 @@ Registry::Map::reset()
 
 
 
+//-----------------------------------------------------------------------------
+std::recursive_mutex &
+Registry::Map::mutex() const
+{
+    return m_mutex;
+}
+
 //-----------------------------------------------------------------------------
 //-----------------------------------------------------------------------------
 Registry::Registry()
@@ -576,6 +626,7 @@ Registry::~Registry()
 bool
 Registry::has_entry(const std::string &key)
 {
+    std::lock_guard<std::recursive_mutex> lock(m_map->mutex());
     return m_map->has_entry(key);
 }
 
@@ -583,6 +634,7 @@ Registry::has_entry(const std::string &key)
 void
 Registry::consume(const std::string &key)
 {
+    std::lock_guard<std::recursive_mutex> lock(m_map->mutex());
     if(m_map->has_entry(key))
     {
         m_map->dec(key);
@@ -593,6 +645,7 @@ Registry::consume(const std::string &key)
 void
 Registry::detach(const std::string &key)
 {
+    std::lock_guard<std::recursive_mutex> lock(m_map->mutex());
     if(m_map->has_entry(key))
     {
         m_map->detach(key);
@@ -604,6 +657,7 @@ Registry::detach(const std::string &key)
 void
 Registry::reset()
 {
+    std::lock_guard<std::recursive_mutex> lock(m_map->mutex());
     m_map->reset();
 }
 
@@ -612,6 +666,7 @@ Registry::reset()
 void
 Registry::info(Node &out) const
 {
+    std::lock_guard<std::recursive_mutex> lock(m_map->mutex());
     m_map->info(out);
 }
 
@@ -640,6 +695,7 @@ Registry::print() const
 Data &
 Registry::fetch(const std::string &key)
 {
+    std::lock_guard<std::recursive_mutex> lock(m_map->mutex());
     if(!m_map->has_entry(key))
     {
         print();
@@ -655,6 +711,7 @@ Registry::add(const std::string &key,
               Data &data,
               int refs_needed)
 {
+    std::lock_guard<std::recursive_mutex> lock(m_map->mutex());
     if(m_map->has_entry(key))
     {
         CONDUIT_WARN("Attempt to overwrite existing entry with key: " << key);
@@ -666,6 +723,22 @@ Registry::add(const std::string &key,
 }
 
 
+//-----------------------------------------------------------------------------
+void
+Registry::add_untracked(const std::string &key,
+                        Data &data)
+{
+    std::lock_guard<std::recursive_mutex> lock(m_map->mutex());
+    if(m_map->has_entry(key))
+    {
+        CONDUIT_WARN("Attempt to overwrite existing entry with key: " << key);
+    }
+    else
+    {
+        m_map->add_untracked(key, data);
+    }
+}
+
 //-----------------------------------------------------------------------------
 };
 //-----------------------------------------------------------------------------
@@ -117,6 +117,10 @@ namespace flow
 // T * my_data_2 = input(1);
 // life will be managed by the registry
 // output()->set(my_new_data)
+//
+// the registry is thread safe, so filters can add entries (for example
+// to keep an input alive for the rest of the execute) while the
+// workspace executes other filters in parallel
 
 //-----------------------------------------------------------------------------
 class FLOW_API Registry
@@ -153,6 +157,12 @@ public:
                        Data &data,
                        int refs_needed);
 
+    /// adds an entry for data owned outside of the registry
+    /// (e.g. by the workspace result cache). The data is never
+    /// released, even if other entries already track the pointer.
+    void           add_untracked(const std::string &key,
+                                 Data &data);
+
     /// fetch entry by key, does not decrement refs_needed
     Data          &fetch(const std::string &key);
 
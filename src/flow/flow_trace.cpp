@@ -0,0 +1,709 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2015-2019, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-716457
+//
+// All rights reserved.
+//
+// This file is part of Ascent.
+//
+// For details, see: http://ascent.readthedocs.io/.
+//
+// Please also read ascent/LICENSE
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the disclaimer below.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the disclaimer (as noted below) in the
+//   documentation and/or other materials provided with the distribution.
+//
+// * Neither the name of the LLNS/LLNL nor the names of its contributors may
+//   be used to endorse or promote products derived from this software without
+//   specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL LAWRENCE LIVERMORE NATIONAL SECURITY,
+// LLC, THE U.S. DEPARTMENT OF ENERGY OR CONTRIBUTORS BE LIABLE FOR ANY
+// DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+
+
+//-----------------------------------------------------------------------------
+///
+/// file: flow_trace.cpp
+///
+//-----------------------------------------------------------------------------
+
+#include "flow_trace.hpp"
+
+// standard lib includes
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <deque>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+using namespace conduit;
+using namespace std::chrono;
+
+//-----------------------------------------------------------------------------
+// -- begin flow:: --
+//-----------------------------------------------------------------------------
+namespace flow
+{
+
+//-----------------------------------------------------------------------------
+// -- begin flow::detail --
+//-----------------------------------------------------------------------------
+namespace detail
+{
+
+//-----------------------------------------------------------------------------
+// event names, categories and nodes are interned, so recording an event
+// copies three ids instead of three strings. each thread keeps a cache of
+// the ids it used, the shared table is only locked for new names.
+//-----------------------------------------------------------------------------
+struct NameTable
+{
+    std::mutex                        mutex;
+    std::deque<std::string>           names;
+    std::map<std::string,uint32>      ids;
+};
+
+//-----------------------------------------------------------------------------
+NameTable &
+name_table()
+{
+    static NameTable table;
+    return table;
+}
+
+//-----------------------------------------------------------------------------
+uint32
+intern(const std::string &name)
+{
+    static thread_local std::unordered_map<std::string,uint32> cache;
+    std::unordered_map<std::string,uint32>::const_iterator itr = cache.find(name);
+    if(itr != cache.end())
+    {
+        return itr->second;
+    }
+
+    NameTable &table = name_table();
+    uint32 id = 0;
+    {
+        std::lock_guard<std::mutex> lock(table.mutex);
+        std::map<std::string,uint32>::const_iterator t_itr = table.ids.find(name);
+        if(t_itr != table.ids.end())
+        {
+            id = t_itr->second;
+        }
+        else
+        {
+            id = (uint32)table.names.size();
+            table.names.push_back(name);
+            table.ids[name] = id;
+        }
+    }
+    cache[name] = id;
+    return id;
+}
+
+//-----------------------------------------------------------------------------
+struct TraceEvent
+{
+    uint32      name;
+    uint32      category;
+    uint32      node;
+    int         cycle;
+    double      start;
+    double      duration;
+    uint64      bytes;
+};
+
+//-----------------------------------------------------------------------------
+// fixed capacity ring of events written by a single thread. the owning
+// thread records without locking: it fills the next slot and then
+// publishes it by bumping `written`. readers copy the published events and
+// discard the ones the owner overwrote while they were copying. clearing
+// only moves the start of the valid range.
+//-----------------------------------------------------------------------------
+struct TraceBuffer
+{
+    TraceBuffer(int tid, int capacity)
+    : tid(tid),
+      in_use(false),
+      events(capacity),
+      written(0),
+      cleared(0)
+    {}
+
+    // only called by the thread that owns the buffer
+    void record(const TraceEvent &event)
+    {
+        const uint64 idx = written.load(std::memory_order_relaxed);
+        events[idx % events.size()] = event;
+        written.store(idx + 1, std::memory_order_release);
+    }
+
+    // first index still held by the buffer
+    uint64 first(uint64 end) const
+    {
+        const uint64 capacity = events.size();
+        const uint64 begin = end > capacity ? end - capacity : 0;
+        return std::max(begin, cleared.load(std::memory_order_acquire));
+    }
+
+    // appends the events in the order they were recorded
+    void copy(std::vector<TraceEvent> &out) const
+    {
+        const uint64 end = written.load(std::memory_order_acquire);
+        const uint64 begin = first(end);
+        const size_t offset = out.size();
+        for(uint64 i = begin; i < end; i++)
+        {
+            out.push_back(events[i % events.size()]);
+        }
+
+        // drop the events that were overwritten while we copied
+        const uint64 valid = first(written.load(std::memory_order_acquire));
+        if(valid > begin)
+        {
+            const size_t num_torn = (size_t)std::min(valid - begin, end - begin);
+            out.erase(out.begin() + offset, out.begin() + offset + num_torn);
+        }
+    }
+
+    index_t size() const
+    {
+        const uint64 end = written.load(std::memory_order_acquire);
+        return (index_t)(end - first(end));
+    }
+
+    index_t dropped() const
+    {
+        const uint64 end = written.load(std::memory_order_acquire);
+        const uint64 capacity = events.size();
+        const uint64 since_clear = end - cleared.load(std::memory_order_acquire);
+        return since_clear > capacity ? (index_t)(since_clear - capacity) : 0;
+    }
+
+    void clear()
+    {
+        cleared.store(written.load(std::memory_order_acquire),
+                      std::memory_order_release);
+    }
+
+    // not safe while the owner records
+    void resize(int capacity)
+    {
+        events.assign(capacity, TraceEvent());
+        written = 0;
+        cleared = 0;
+    }
+
+    int                     tid;
+    bool                    in_use;
+    std::vector<TraceEvent> events;
+    std::atomic<uint64>     written;
+    std::atomic<uint64>     cleared;
+};
+
+//-----------------------------------------------------------------------------
+// buffers outlive the threads that wrote them, a buffer released by an
+// exited thread is handed to the next new thread.
+//-----------------------------------------------------------------------------
+struct TraceState
+{
+    TraceState()
+    : buffer_size(65536)
+    {}
+
+    ~TraceState()
+    {
+        for(size_t i = 0; i < buffers.size(); i++)
+        {
+            delete buffers[i];
+        }
+    }
+
+    std::mutex                 mutex;
+    std::vector<TraceBuffer*>  buffers;
+    int                        buffer_size;
+};
+
+//-----------------------------------------------------------------------------
+TraceState &
+trace_state()
+{
+    static TraceState state;
+    return state;
+}
+
+static std::atomic<bool>                 trace_enabled(false);
+static std::atomic<int>                  trace_cycle(0);
+static std::atomic<steady_clock::rep>    trace_origin(
+                                  steady_clock::now().time_since_epoch().count());
+
+//-----------------------------------------------------------------------------
+struct ThreadBufferHandle
+{
+    ThreadBufferHandle()
+    : buffer(NULL)
+    {}
+
+    ~ThreadBufferHandle()
+    {
+        if(buffer != NULL)
+        {
+            TraceState &state = trace_state();
+            std::lock_guard<std::mutex> lock(state.mutex);
+            buffer->in_use = false;
+        }
+    }
+
+    TraceBuffer *buffer;
+};
+
+static thread_local ThreadBufferHandle thread_buffer_handle;
+static thread_local TraceScope        *thread_scope = NULL;
+
+//-----------------------------------------------------------------------------
+TraceBuffer *
+thread_buffer()
+{
+    if(thread_buffer_handle.buffer == NULL)
+    {
+        TraceState &state = trace_state();
+        std::lock_guard<std::mutex> lock(state.mutex);
+
+        TraceBuffer *buffer = NULL;
+        for(size_t i = 0; i < state.buffers.size() && buffer == NULL; i++)
+        {
+            if(!state.buffers[i]->in_use)
+            {
+                buffer = state.buffers[i];
+            }
+        }
+
+        if(buffer == NULL)
+        {
+            buffer = new TraceBuffer((int)state.buffers.size(),
+                                     state.buffer_size);
+            state.buffers.push_back(buffer);
+        }
+
+        buffer->in_use = true;
+        thread_buffer_handle.buffer = buffer;
+    }
+
+    return thread_buffer_handle.buffer;
+}
+
+//-----------------------------------------------------------------------------
+void
+record(uint32 name,
+       uint32 category,
+       uint32 node,
+       double start,
+       double duration,
+       uint64 bytes)
+{
+    TraceEvent event;
+    event.name     = name;
+    event.category = category;
+    event.node     = node;
+    event.cycle    = trace_cycle;
+    event.start    = start;
+    event.duration = duration;
+    event.bytes    = bytes;
+
+    thread_buffer()->record(event);
+}
+
+//-----------------------------------------------------------------------------
+// copies the events of all threads, paired with the thread's id
+//-----------------------------------------------------------------------------
+void
+copy_events(std::vector<std::pair<int,TraceEvent>> &out)
+{
+    TraceState &state = trace_state();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    std::vector<TraceEvent> events;
+    for(size_t b = 0; b < state.buffers.size(); b++)
+    {
+        events.clear();
+        state.buffers[b]->copy(events);
+        for(size_t i = 0; i < events.size(); i++)
+        {
+            out.push_back(std::make_pair(state.buffers[b]->tid, events[i]));
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+void
+write_json_string(std::ostream &os, const std::string &str)
+{
+    os << "\"";
+    for(size_t i = 0; i < str.size(); i++)
+    {
+        const char c = str[i];
+        if(c == '"' || c == '\\')
+        {
+            os << "\\" << c;
+        }
+        else if((unsigned char)c < 0x20)
+        {
+            char buff[8];
+            snprintf(buff, sizeof(buff), "\\u%04x", (int)c);
+            os << buff;
+        }
+        else
+        {
+            os << c;
+        }
+    }
+    os << "\"";
+}
+
+//-----------------------------------------------------------------------------
+void
+write_json_number(std::ostream &os, double value)
+{
+    char buff[64];
+    snprintf(buff, sizeof(buff), "%.3f", value);
+    os << buff;
+}
+
+//-----------------------------------------------------------------------------
+};
+//-----------------------------------------------------------------------------
+// -- end flow::detail --
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+// Tracer
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+void
+Tracer::enable(bool enabled)
+{
+    if(enabled && !detail::trace_enabled)
+    {
+        detail::trace_origin = steady_clock::now().time_since_epoch().count();
+    }
+    detail::trace_enabled = enabled;
+}
+
+//-----------------------------------------------------------------------------
+bool
+Tracer::enabled()
+{
+    return detail::trace_enabled;
+}
+
+//-----------------------------------------------------------------------------
+void
+Tracer::set_buffer_size(int num_events)
+{
+    if(num_events < 1)
+    {
+        CONDUIT_ERROR("trace buffer size must be greater than zero,"
+                      " given " << num_events);
+    }
+
+    detail::TraceState &state = detail::trace_state();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    state.buffer_size = num_events;
+    for(size_t i = 0; i < state.buffers.size(); i++)
+    {
+        state.buffers[i]->resize(num_events);
+    }
+}
+
+//-----------------------------------------------------------------------------
+int
+Tracer::buffer_size()
+{
+    detail::TraceState &state = detail::trace_state();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    return state.buffer_size;
+}
+
+//-----------------------------------------------------------------------------
+void
+Tracer::set_cycle(int cycle)
+{
+    detail::trace_cycle = cycle;
+}
+
+//-----------------------------------------------------------------------------
+int
+Tracer::cycle()
+{
+    return detail::trace_cycle;
+}
+
+//-----------------------------------------------------------------------------
+double
+Tracer::now()
+{
+    steady_clock::duration since_origin =
+        steady_clock::now().time_since_epoch() -
+        steady_clock::duration(detail::trace_origin.load());
+    return duration_cast<duration<double,std::micro>>(since_origin).count();
+}
+
+//-----------------------------------------------------------------------------
+void
+Tracer::record(const std::string &name,
+               const std::string &category,
+               const std::string &node,
+               double start,
+               double duration,
+               uint64 bytes)
+{
+    if(!detail::trace_enabled)
+    {
+        return;
+    }
+
+    detail::record(detail::intern(name),
+                   detail::intern(category),
+                   detail::intern(node),
+                   start,
+                   duration,
+                   bytes);
+}
+
+//-----------------------------------------------------------------------------
+index_t
+Tracer::number_of_events()
+{
+    detail::TraceState &state = detail::trace_state();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    index_t res = 0;
+    for(size_t i = 0; i < state.buffers.size(); i++)
+    {
+        res += state.buffers[i]->size();
+    }
+    return res;
+}
+
+//-----------------------------------------------------------------------------
+index_t
+Tracer::number_of_dropped_events()
+{
+    detail::TraceState &state = detail::trace_state();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    index_t res = 0;
+    for(size_t i = 0; i < state.buffers.size(); i++)
+    {
+        res += state.buffers[i]->dropped();
+    }
+    return res;
+}
+
+//-----------------------------------------------------------------------------
+void
+Tracer::clear()
+{
+    detail::TraceState &state = detail::trace_state();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    for(size_t i = 0; i < state.buffers.size(); i++)
+    {
+        state.buffers[i]->clear();
+    }
+}
+
+//-----------------------------------------------------------------------------
+void
+Tracer::events(Node &out)
+{
+    out.reset();
+
+    std::vector<std::pair<int,detail::TraceEvent>> events;
+    detail::copy_events(events);
+
+    std::stable_sort(events.begin(),
+                     events.end(),
+                     [](const std::pair<int,detail::TraceEvent> &a,
+                        const std::pair<int,detail::TraceEvent> &b)
+                     {
+                        return a.second.start < b.second.start;
+                     });
+
+    detail::NameTable &table = detail::name_table();
+    std::lock_guard<std::mutex> lock(table.mutex);
+    for(size_t i = 0; i < events.size(); i++)
+    {
+        const detail::TraceEvent &event = events[i].second;
+
+        Node &e = out.append();
+        e["name"]  = table.names[event.name];
+        e["cat"]   = table.names[event.category];
+        e["ts"]    = event.start;
+        e["dur"]   = event.duration;
+        e["tid"]   = events[i].first;
+        e["node"]  = table.names[event.node];
+        e["cycle"] = event.cycle;
+        e["bytes"] = event.bytes;
+    }
+}
+
+//-----------------------------------------------------------------------------
+void
+Tracer::write_trace_events(std::ostream &os, int pid)
+{
+    // name the process lane, so merged traces show ranks
+    os << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" << pid
+       << ",\"tid\":0,\"args\":{\"name\":\"rank " << pid << "\"}}";
+
+    std::vector<std::pair<int,detail::TraceEvent>> events;
+    detail::copy_events(events);
+
+    detail::NameTable &table = detail::name_table();
+    std::lock_guard<std::mutex> lock(table.mutex);
+    for(size_t i = 0; i < events.size(); i++)
+    {
+        const detail::TraceEvent &event = events[i].second;
+        os << ",\n{\"name\":";
+        detail::write_json_string(os, table.names[event.name]);
+        os << ",\"cat\":";
+        detail::write_json_string(os, table.names[event.category]);
+        os << ",\"ph\":\"X\",\"ts\":";
+        detail::write_json_number(os, event.start);
+        os << ",\"dur\":";
+        detail::write_json_number(os, event.duration);
+        os << ",\"pid\":" << pid
+           << ",\"tid\":" << events[i].first
+           << ",\"args\":{\"node\":";
+        detail::write_json_string(os, table.names[event.node]);
+        os << ",\"cycle\":" << event.cycle
+           << ",\"bytes\":" << event.bytes
+           << "}}";
+    }
+}
+
+//-----------------------------------------------------------------------------
+void
+Tracer::write_trace(std::ostream &os, int pid)
+{
+    os << "{\"traceEvents\":[\n";
+    write_trace_events(os, pid);
+    os << "\n],\n\"displayTimeUnit\":\"ms\",\n"
+       << "\"otherData\":{\"dropped_events\":"
+       << number_of_dropped_events()
+       << "}}\n";
+}
+
+//-----------------------------------------------------------------------------
+void
+Tracer::save_trace(const std::string &path, int pid)
+{
+    std::ofstream ofs;
+    ofs.open(path.c_str());
+    if(!ofs.is_open())
+    {
+        CONDUIT_ERROR("failed to open trace file: " << path);
+    }
+    write_trace(ofs, pid);
+    ofs.close();
+}
+
+//-----------------------------------------------------------------------------
+// TraceScope
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+TraceScope::TraceScope(const std::string &name,
+                       const std::string &category,
+                       const std::string &node)
+: m_active(Tracer::enabled()),
+  m_name(0),
+  m_category(0),
+  m_node(0),
+  m_start(0.0),
+  m_bytes(0),
+  m_parent(NULL)
+{
+    if(m_active)
+    {
+        m_name     = detail::intern(name);
+        m_category = detail::intern(category);
+        m_node     = detail::intern(node);
+        m_parent   = detail::thread_scope;
+        detail::thread_scope = this;
+        m_start    = Tracer::now();
+    }
+}
+
+//-----------------------------------------------------------------------------
+TraceScope::~TraceScope()
+{
+    if(m_active)
+    {
+        detail::thread_scope = m_parent;
+        // tracing may have been turned off while the scope was open
+        if(Tracer::enabled())
+        {
+            try
+            {
+                detail::record(m_name,
+                               m_category,
+                               m_node,
+                               m_start,
+                               Tracer::now() - m_start,
+                               m_bytes);
+            }
+            catch(...)
+            {
+                // never throw from a destructor
+            }
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+void
+TraceScope::set_bytes(uint64 bytes)
+{
+    m_bytes = bytes;
+}
+
+//-----------------------------------------------------------------------------
+void
+TraceScope::add_bytes(uint64 bytes)
+{
+    if(detail::thread_scope != NULL)
+    {
+        detail::thread_scope->m_bytes += bytes;
+    }
+}
+
+//-----------------------------------------------------------------------------
+};
+//-----------------------------------------------------------------------------
+// -- end flow:: --
+//-----------------------------------------------------------------------------
@@ -0,0 +1,182 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2015-2019, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-716457
+//
+// All rights reserved.
+//
+// This file is part of Ascent.
+//
+// For details, see: http://ascent.readthedocs.io/.
+//
+// Please also read ascent/LICENSE
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the disclaimer below.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the disclaimer (as noted below) in the
+//   documentation and/or other materials provided with the distribution.
+//
+// * Neither the name of the LLNS/LLNL nor the names of its contributors may
+//   be used to endorse or promote products derived from this software without
+//   specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL LAWRENCE LIVERMORE NATIONAL SECURITY,
+// LLC, THE U.S. DEPARTMENT OF ENERGY OR CONTRIBUTORS BE LIABLE FOR ANY
+// DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+
+
+//-----------------------------------------------------------------------------
+///
+/// file: flow_trace.hpp
+///
+//-----------------------------------------------------------------------------
+
+#ifndef FLOW_TRACE_HPP
+#define FLOW_TRACE_HPP
+
+#include <conduit.hpp>
+
+#include <flow_exports.h>
+#include <flow_config.h>
+
+#include <ostream>
+#include <string>
+
+//-----------------------------------------------------------------------------
+// -- begin flow:: --
+//-----------------------------------------------------------------------------
+namespace flow
+{
+
+//-----------------------------------------------------------------------------
+///
+/// Tracer records timed events into in-memory, per-thread ring buffers.
+/// Threads record into their own buffer without locking.
+///
+/// Each event carries a name, a category, the graph node that produced it,
+/// the current cycle and an optional byte count. Recording is a no-op while
+/// tracing is disabled. When a thread's buffer is full the oldest events
+/// are overwritten and counted as dropped.
+///
+/// Events can be written as Chrome trace / Perfetto json. Timestamps are
+/// microseconds since tracing was last enabled on this process.
+///
+//-----------------------------------------------------------------------------
+class FLOW_API Tracer
+{
+public:
+    /// turns event recording on or off, enabling resets the time origin
+    static void         enable(bool enabled);
+    static bool         enabled();
+
+    /// max number of events kept per thread (default = 65536)
+    /// changing the size clears all recorded events, and must not
+    /// happen while other threads record events
+    static void         set_buffer_size(int num_events);
+    static int          buffer_size();
+
+    /// cycle attached to events recorded from now on
+    static void         set_cycle(int cycle);
+    static int          cycle();
+
+    /// microseconds since the time origin
+    static double       now();
+
+    /// records an event that started at `start` and lasted `duration`
+    /// (both in microseconds). names are interned, so an event stores
+    /// ids and the recording thread does not lock or allocate once it
+    /// has seen a name.
+    static void         record(const std::string &name,
+                               const std::string &category,
+                               const std::string &node,
+                               double start,
+                               double duration,
+                               conduit::uint64 bytes = 0);
+
+    /// number of recorded events, and those overwritten since the last clear
+    static conduit::index_t number_of_events();
+    static conduit::index_t number_of_dropped_events();
+
+    /// removes all recorded events
+    static void         clear();
+
+    /// recorded events as a list of {name, cat, ts, dur, tid, node,
+    /// cycle, bytes}, ordered by start time
+    static void         events(conduit::Node &out);
+
+    /// writes the recorded events as comma separated chrome trace event
+    /// objects, using `pid` as the process id. This form allows the events
+    /// of several processes to be concatenated into one trace.
+    static void         write_trace_events(std::ostream &os, int pid);
+    /// writes a complete chrome trace json document
+    static void         write_trace(std::ostream &os, int pid);
+    /// saves a complete chrome trace json document to a file
+    static void         save_trace(const std::string &path, int pid);
+};
+
+//-----------------------------------------------------------------------------
+///
+/// TraceScope records one event covering its lifetime.
+///
+/// Code running inside a scope can attribute bytes to the innermost scope
+/// of the calling thread using TraceScope::add_bytes().
+///
+//-----------------------------------------------------------------------------
+class FLOW_API TraceScope
+{
+public:
+    TraceScope(const std::string &name,
+               const std::string &category,
+               const std::string &node = "");
+   ~TraceScope();
+
+    /// sets the byte count reported for this scope
+    void         set_bytes(conduit::uint64 bytes);
+
+    /// adds to the byte count of the innermost active scope on this thread
+    static void  add_bytes(conduit::uint64 bytes);
+
+private:
+    TraceScope(const TraceScope &);
+    TraceScope &operator=(const TraceScope &);
+
+    bool              m_active;
+    // interned names, see Tracer::record
+    conduit::uint32   m_name;
+    conduit::uint32   m_category;
+    conduit::uint32   m_node;
+    double            m_start;
+    conduit::uint64   m_bytes;
+    TraceScope       *m_parent;
+};
+
+//-----------------------------------------------------------------------------
+};
+//-----------------------------------------------------------------------------
+// -- end flow:: --
+//-----------------------------------------------------------------------------
+
+
+#endif
+//-----------------------------------------------------------------------------
+// -- end header ifdef guard
+//-----------------------------------------------------------------------------
+
+
@@ -50,13 +50,22 @@
 //-----------------------------------------------------------------------------
 
 #include "flow_workspace.hpp"
-#include "flow_timer.hpp"
+#include "flow_trace.hpp"
 
 // standard lib includes
 #include <iostream>
 #include <string.h>
 #include <limits.h>
 #include <cstdlib>
+#include <deque>
+#include <map>
+#include <set>
+#include <vector>
+#include <functional>
+#include <exception>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
 
 using namespace conduit;
 using namespace std;
@@ -73,6 +82,8 @@ namespace flow
 // we will try this strategy.
 int Workspace::m_default_mpi_comm = -1;
 
+std::atomic<int> Workspace::m_next_id(0);
+
 //-----------------------------------------------------------------------------
 class Workspace::ExecutionPlan
 {
@@ -81,6 +92,12 @@ class Workspace::ExecutionPlan
         static void generate(Graph &g,
                              conduit::Node &traversals);
 
+        /// removes the skipped filters that no other filter in the
+        /// traversals needs, and updates the use counts
+        static void skip(Graph &g,
+                         const std::set<std::string> &skipped,
+                         conduit::Node &traversals);
+
     private:
         ExecutionPlan();
         ~ExecutionPlan();
@@ -91,6 +108,124 @@ class Workspace::ExecutionPlan
                                        conduit::Node &tarv);
 };
 
+//-----------------------------------------------------------------------------
+// Executes the filters of a set of traversals using a pool of threads.
+//
+// Each filter tracks the number of input edges that are still pending.
+// When a filter finishes, the pending count of each downstream filter is
+// decremented and filters that have no pending inputs are pushed onto
+// the ready queue. All registry access is serialized with a mutex,
+// only Filter::execute() runs concurrently.
+//-----------------------------------------------------------------------------
+class Workspace::ParallelExecutor
+{
+    public:
+        ParallelExecutor(Workspace &w,
+                         conduit::Node &traversals,
+                         int num_threads);
+        ~ParallelExecutor();
+
+        void execute();
+
+    private:
+        struct Task
+        {
+            Filter                  *filter;
+            int                      uref;
+            std::vector<std::string> inputs;
+            std::vector<int>         dependents;
+            int                      pending;
+        };
+
+        void worker();
+        void run_task(Task &task);
+
+        Workspace                 &m_workspace;
+        int                        m_num_threads;
+        std::vector<Task>          m_tasks;
+        std::deque<int>            m_ready;
+        int                        m_num_done;
+        bool                       m_failed;
+        std::exception_ptr         m_error;
+        std::mutex                 m_mutex;
+        std::condition_variable    m_cond;
+};
+
+//-----------------------------------------------------------------------------
+// Holds filter outputs across calls to execute().
+//
+// Each filter is assigned a key that combines its type, params and the
+// keys of its inputs. Keys originate at filters w/o inputs that were
+// given a fingerprint. Only cacheable filters propagate keys, so any
+// non-cacheable filter cuts the chain.
+//
+// Sources can also fingerprint each of their fields. Those are not part
+// of the propagated keys, a filter's key only includes the fingerprints
+// of the fields it or any filter downstream reads, so changing a field
+// keeps the outputs that nothing reading that field depends on.
+//
+// The cache owns the outputs it holds, they are added to the registry
+// untracked so the registry never releases them. Outputs that simply
+// pass an input through are not stored (they are cheap to recreate and
+// the cache does not own them), but they still propagate keys.
+//-----------------------------------------------------------------------------
+class Workspace::ResultCache
+{
+    public:
+        ResultCache();
+        ~ResultCache();
+
+        bool  enabled() const;
+        void  set_enabled(bool enabled);
+
+        void  set_fingerprint(const std::string &filter_name,
+                              const std::string &fingerprint);
+
+        void  set_field_fingerprints(const std::string &filter_name,
+                                     const conduit::Node &fields);
+
+        /// computes the keys for all filters in the given traversals
+        void  prepare(Graph &graph,
+                      conduit::Node &traversals);
+
+        /// returns cached output for the filter, or NULL on miss
+        Data *fetch(Filter *f);
+
+        /// stores the filter output if possible, returns true if the
+        /// cache took ownership of the output
+        bool  store(Filter *f);
+
+        /// adds a result the cache owns to the registry, w/o handing
+        /// over ownership
+        void  attach(Registry &registry,
+                     const std::string &filter_name,
+                     Data &data);
+
+        /// removes all results added via attach() from the registry
+        void  detach(Registry &registry);
+
+        void  clear();
+        void  info(conduit::Node &out) const;
+
+    private:
+        struct Entry
+        {
+            std::string  key;
+            Data        *data;
+        };
+
+        void  release(const std::string &filter_name);
+
+        bool                                m_enabled;
+        std::map<std::string,Entry>         m_entries;
+        std::map<std::string,std::string>   m_keys;
+        std::map<std::string,std::string>   m_fingerprints;
+        std::map<std::string,conduit::Node> m_field_fingerprints;
+        std::set<std::string>               m_attached;
+        int                                 m_hits;
+        int                                 m_misses;
+};
+
 //-----------------------------------------------------------------------------
 class Workspace::FilterFactory
 {
@@ -185,6 +320,78 @@ Workspace::ExecutionPlan::generate(Graph &graph,
 }
 
 
+//-----------------------------------------------------------------------------
+void
+Workspace::ExecutionPlan::skip(Graph &graph,
+                               const std::set<std::string> &skipped,
+                               conduit::Node &traversals)
+{
+    // traversals are in topological order, so the consumers of a
+    // filter are decided before the filter when walking backwards
+    std::vector<std::string> order;
+    NodeIterator travs_itr = traversals.children();
+    while(travs_itr.has_next())
+    {
+        NodeIterator trav_itr(&travs_itr.next());
+        while(trav_itr.has_next())
+        {
+            trav_itr.next();
+            order.push_back(trav_itr.name());
+        }
+    }
+
+    // a filter runs if it is not skipped, or a filter that runs reads it
+    std::map<std::string,int> urefs;
+    for(int i = (int)order.size() - 1; i >= 0; i--)
+    {
+        const std::string &f_name = order[i];
+        Filter *f = graph.filters()[f_name];
+
+        int num_refs = 0;
+        if(f->output_port())
+        {
+            NodeConstIterator dest_itr(&graph.edges_out(f_name));
+            while(dest_itr.has_next())
+            {
+                if(urefs.count(dest_itr.next().as_string()) > 0)
+                {
+                    num_refs++;
+                }
+            }
+        }
+
+        if(num_refs > 0 || skipped.count(f_name) == 0)
+        {
+            urefs[f_name] = num_refs > 0 ? num_refs : 1;
+        }
+    }
+
+    Node kept;
+    travs_itr = traversals.children();
+    while(travs_itr.has_next())
+    {
+        Node trav;
+        NodeIterator trav_itr(&travs_itr.next());
+        while(trav_itr.has_next())
+        {
+            trav_itr.next();
+            std::map<std::string,int>::const_iterator itr;
+            itr = urefs.find(trav_itr.name());
+            if(itr != urefs.end())
+            {
+                trav[itr->first] = itr->second;
+            }
+        }
+
+        if(trav.number_of_children() > 0)
+        {
+            kept.append().set(trav);
+        }
+    }
+
+    traversals.set(kept);
+}
+
 //-----------------------------------------------------------------------------
 void
 Workspace::ExecutionPlan::bf_topo_sort_visit(Graph &graph,
@@ -244,23 +451,641 @@ Workspace::ExecutionPlan::bf_topo_sort_visit(Graph &graph,
 
 }
 
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
+//
+// Workspace::ParallelExecutor
+//
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+Workspace::ParallelExecutor::ParallelExecutor(Workspace &w,
+                                              conduit::Node &traversals,
+                                              int num_threads)
+: m_workspace(w),
+  m_num_threads(num_threads),
+  m_num_done(0),
+  m_failed(false)
+{
+    Graph &graph = m_workspace.graph();
+
+    // flatten the traversals into a task list.
+    // note: a filter is only visited once during plan generation,
+    // so it appears in at most one traversal
+    std::map<std::string,int> task_ids;
+
+    NodeIterator travs_itr = traversals.children();
+    while(travs_itr.has_next())
+    {
+        NodeIterator trav_itr(&travs_itr.next());
+        while(trav_itr.has_next())
+        {
+            Node &t = trav_itr.next();
+            std::string f_name = trav_itr.name();
+
+            Task task;
+            task.filter      = graph.filters()[f_name];
+            task.uref        = t.to_int32();
+            task.pending     = 0;
+
+            // resolve input names up front, so the worker threads
+            // never touch the graph's conduit trees
+            NodeConstIterator ports_itr(&task.filter->port_names());
+            while(ports_itr.has_next())
+            {
+                std::string port_name = ports_itr.next().as_string();
+                task.inputs.push_back(graph.edges_in(f_name)[port_name].as_string());
+            }
+
+            task_ids[f_name] = (int)m_tasks.size();
+            m_tasks.push_back(task);
+        }
+    }
+
+    // wire up dependencies, each connected port is one pending input
+    for(size_t i = 0; i < m_tasks.size(); i++)
+    {
+        Task &task = m_tasks[i];
+        for(size_t p = 0; p < task.inputs.size(); p++)
+        {
+            std::map<std::string,int>::const_iterator itr;
+            itr = task_ids.find(task.inputs[p]);
+            if(itr != task_ids.end())
+            {
+                m_tasks[itr->second].dependents.push_back((int)i);
+                task.pending++;
+            }
+        }
+    }
+
+    // seed the ready queue in traversal order
+    for(size_t i = 0; i < m_tasks.size(); i++)
+    {
+        if(m_tasks[i].pending == 0)
+        {
+            m_ready.push_back((int)i);
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+Workspace::ParallelExecutor::~ParallelExecutor()
+{
+    // empty
+}
+
+//-----------------------------------------------------------------------------
+void
+Workspace::ParallelExecutor::execute()
+{
+    if(m_tasks.empty())
+    {
+        return;
+    }
+
+    int num_threads = m_num_threads;
+    if(num_threads > (int)m_tasks.size())
+    {
+        num_threads = (int)m_tasks.size();
+    }
+
+    std::vector<std::thread> threads;
+    for(int i = 0; i < num_threads; i++)
+    {
+        threads.push_back(std::thread(&ParallelExecutor::worker,this));
+    }
+
+    for(size_t i = 0; i < threads.size(); i++)
+    {
+        threads[i].join();
+    }
+
+    // forward the first error we caught to the caller
+    if(m_error)
+    {
+        std::rethrow_exception(m_error);
+    }
+}
+
+//-----------------------------------------------------------------------------
+void
+Workspace::ParallelExecutor::worker()
+{
+    while(true)
+    {
+        int task_id = -1;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            while(m_ready.empty() &&
+                  !m_failed &&
+                  m_num_done < (int)m_tasks.size())
+            {
+                m_cond.wait(lock);
+            }
+
+            if(m_failed || m_ready.empty())
+            {
+                // all tasks are done, or a filter threw
+                return;
+            }
+
+            task_id = m_ready.front();
+            m_ready.pop_front();
+        }
+
+        try
+        {
+            run_task(m_tasks[task_id]);
+        }
+        catch(...)
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if(!m_failed)
+            {
+                m_failed = true;
+                m_error  = std::current_exception();
+            }
+            m_cond.notify_all();
+            return;
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+void
+Workspace::ParallelExecutor::run_task(Task &task)
+{
+    Filter   *f        = task.filter;
+    Registry &registry = m_workspace.registry();
+
+    // fetch inputs from reg, attach to filter's ports
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        f->reset_inputs_and_output();
+        for(size_t p = 0; p < task.inputs.size(); p++)
+        {
+            f->set_input(f->port_index_to_name((int)p),
+                         &registry.fetch(task.inputs[p]));
+        }
+    }
+
+    // execute, unless we can reuse a cached result
+    Data *cached = NULL;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        cached = m_workspace.m_result_cache->fetch(f);
+    }
+
+    const double start = Tracer::now();
+    if(cached == NULL)
+    {
+        TraceScope trace(f->type_name(), "flow", f->name());
+        f->execute();
+    }
+    else
+    {
+        TraceScope trace(f->type_name(), "flow,cached", f->name());
+    }
+    m_workspace.record_timing(f->name(), start);
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    if(cached != NULL)
+    {
+        // the cache owns this result, don't track it
+        m_workspace.m_result_cache->attach(registry,
+                                           f->name(),
+                                           *cached);
+    }
+    // if has output, set output
+    else if(f->output_port())
+    {
+        if(f->output().data_ptr() == NULL)
+        {
+            CONDUIT_ERROR("filter output is NULL, was set_output() called?");
+        }
+
+        if(m_workspace.m_result_cache->store(f))
+        {
+            // the cache took ownership of the output
+            m_workspace.m_result_cache->attach(registry,
+                                               f->name(),
+                                               f->output());
+        }
+        else
+        {
+            registry.add(f->name(),
+                         f->output(),
+                         task.uref);
+        }
+    }
+
+    f->reset_inputs_and_output();
+
+    // consume inputs
+    for(size_t p = 0; p < task.inputs.size(); p++)
+    {
+        registry.consume(task.inputs[p]);
+    }
+
+    // release any filters that were waiting on this one
+    for(size_t d = 0; d < task.dependents.size(); d++)
+    {
+        Task &dep = m_tasks[task.dependents[d]];
+        dep.pending--;
+        if(dep.pending == 0)
+        {
+            m_ready.push_back(task.dependents[d]);
+        }
+    }
+
+    m_num_done++;
+    m_cond.notify_all();
+}
+
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
+//
+// Workspace::ResultCache
+//
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+Workspace::ResultCache::ResultCache()
+: m_enabled(false),
+  m_hits(0),
+  m_misses(0)
+{
+    // empty
+}
+
+//-----------------------------------------------------------------------------
+Workspace::ResultCache::~ResultCache()
+{
+    clear();
+}
+
+//-----------------------------------------------------------------------------
+bool
+Workspace::ResultCache::enabled() const
+{
+    return m_enabled;
+}
+
+//-----------------------------------------------------------------------------
+void
+Workspace::ResultCache::set_enabled(bool enabled)
+{
+    m_enabled = enabled;
+    if(!m_enabled)
+    {
+        clear();
+    }
+}
+
+//-----------------------------------------------------------------------------
+void
+Workspace::ResultCache::set_fingerprint(const std::string &filter_name,
+                                        const std::string &fingerprint)
+{
+    m_fingerprints[filter_name] = fingerprint;
+}
+
+//-----------------------------------------------------------------------------
+void
+Workspace::ResultCache::set_field_fingerprints(const std::string &filter_name,
+                                               const conduit::Node &fields)
+{
+    m_field_fingerprints[filter_name] = fields;
+}
+
+//-----------------------------------------------------------------------------
+void
+Workspace::ResultCache::prepare(Graph &graph,
+                                Node &traversals)
+{
+    m_keys.clear();
+
+    if(!m_enabled)
+    {
+        return;
+    }
+
+    std::hash<std::string> hasher;
+
+    // traversals are in topological order, and each filter is
+    // listed once, so inputs always have their keys before use
+    std::vector<std::string> order;
+    NodeIterator travs_itr = traversals.children();
+    while(travs_itr.has_next())
+    {
+        NodeIterator trav_itr(&travs_itr.next());
+        while(trav_itr.has_next())
+        {
+            trav_itr.next();
+            order.push_back(trav_itr.name());
+        }
+    }
+
+    // the fields each filter's output must have current: the ones the
+    // filter reads, plus the ones read downstream
+    std::map<std::string,std::set<std::string> > read_fields;
+    std::set<std::string> reads_all;
+    for(int i = (int)order.size() - 1; i >= 0; i--)
+    {
+        const std::string &f_name = order[i];
+        Filter *f = graph.filters()[f_name];
+
+        bool all = !f->reads_param_fields_only();
+        std::set<std::string> &fields = read_fields[f_name];
+        f->param_fields(fields);
+
+        if(f->output_port())
+        {
+            NodeConstIterator dest_itr(&graph.edges_out(f_name));
+            while(dest_itr.has_next() && !all)
+            {
+                std::string dest = dest_itr.next().as_string();
+                std::map<std::string,std::set<std::string> >::const_iterator ditr;
+                ditr = read_fields.find(dest);
+                if(ditr == read_fields.end() || reads_all.count(dest) > 0)
+                {
+                    all = true;
+                }
+                else
+                {
+                    fields.insert(ditr->second.begin(), ditr->second.end());
+                }
+            }
+        }
+
+        if(all)
+        {
+            reads_all.insert(f_name);
+        }
+    }
+
+    // keys propagated between filters, w/o field fingerprints
+    std::map<std::string,std::string> chain_keys;
+    // the sources (with field fingerprints) upstream of each filter
+    std::map<std::string,std::set<std::string> > sources;
+
+    for(size_t o = 0; o < order.size(); o++)
+    {
+        const std::string &f_name = order[o];
+        Filter *f = graph.filters()[f_name];
+        std::set<std::string> &f_sources = sources[f_name];
+
+        ostringstream oss;
+        oss << f->type_name() << "\n"
+            << f->params().to_json() << "\n";
+
+        bool keyed = true;
+
+        if(f->number_of_input_ports() == 0)
+        {
+            std::map<std::string,std::string>::const_iterator itr;
+            itr = m_fingerprints.find(f_name);
+            keyed = itr != m_fingerprints.end();
+            if(keyed)
+            {
+                oss << itr->second;
+            }
+            if(m_field_fingerprints.count(f_name) > 0)
+            {
+                f_sources.insert(f_name);
+            }
+        }
+        else
+        {
+            keyed = f->cacheable();
+            NodeConstIterator ports_itr(&f->port_names());
+            while(ports_itr.has_next() && keyed)
+            {
+                std::string port_name = ports_itr.next().as_string();
+                std::string f_input_name = graph.edges_in(f_name)[port_name].as_string();
+
+                std::map<std::string,std::string>::const_iterator itr;
+                itr = chain_keys.find(f_input_name);
+                keyed = itr != chain_keys.end();
+                if(keyed)
+                {
+                    oss << itr->second << "\n";
+                    f_sources.insert(sources[f_input_name].begin(),
+                                     sources[f_input_name].end());
+                }
+            }
+        }
+
+        if(keyed)
+        {
+            ostringstream key;
+            key << std::hex << hasher(oss.str());
+            chain_keys[f_name] = key.str();
+
+            // add the fingerprints of the fields this output
+            // needs to have current
+            const bool all = reads_all.count(f_name) > 0;
+            const std::set<std::string> &fields = read_fields[f_name];
+            std::set<std::string>::const_iterator s_itr;
+            for(s_itr = f_sources.begin(); s_itr != f_sources.end(); ++s_itr)
+            {
+                NodeConstIterator fp_itr(&m_field_fingerprints[*s_itr]);
+                while(fp_itr.has_next())
+                {
+                    const Node &fp = fp_itr.next();
+                    if(all || fields.count(fp_itr.name()) > 0)
+                    {
+                        oss << fp_itr.name() << " " << fp.as_string() << "\n";
+                    }
+                }
+            }
+
+            ostringstream cache_key;
+            cache_key << std::hex << hasher(oss.str());
+            m_keys[f_name] = cache_key.str();
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+Data *
+Workspace::ResultCache::fetch(Filter *f)
+{
+    if(!m_enabled || !f->output_port() || f->number_of_input_ports() == 0)
+    {
+        return NULL;
+    }
+
+    const std::string f_name = f->name();
+
+    std::map<std::string,std::string>::const_iterator kitr;
+    kitr = m_keys.find(f_name);
+    if(kitr == m_keys.end())
+    {
+        return NULL;
+    }
+
+    std::map<std::string,Entry>::iterator eitr;
+    eitr = m_entries.find(f_name);
+    if(eitr != m_entries.end() && eitr->second.key == kitr->second)
+    {
+        m_hits++;
+        return eitr->second.data;
+    }
+
+    m_misses++;
+    return NULL;
+}
+
+//-----------------------------------------------------------------------------
+bool
+Workspace::ResultCache::store(Filter *f)
+{
+    if(!m_enabled || !f->output_port() || f->number_of_input_ports() == 0)
+    {
+        return false;
+    }
+
+    const std::string f_name = f->name();
+
+    std::map<std::string,std::string>::const_iterator kitr;
+    kitr = m_keys.find(f_name);
+    if(kitr == m_keys.end())
+    {
+        return false;
+    }
+
+    void *data_ptr = f->output().data_ptr();
+
+    // we only take ownership of new data, skip pass through outputs
+    for(int i = 0; i < f->number_of_input_ports(); i++)
+    {
+        if(f->input(i).data_ptr() == data_ptr)
+        {
+            return false;
+        }
+    }
+
+    std::map<std::string,Entry>::const_iterator eitr;
+    for(eitr = m_entries.begin(); eitr != m_entries.end(); eitr++)
+    {
+        if(eitr->first != f_name &&
+           eitr->second.data->data_ptr() == data_ptr)
+        {
+            return false;
+        }
+    }
+
+    // replace any stale result
+    release(f_name);
+
+    Entry &ent = m_entries[f_name];
+    ent.key  = kitr->second;
+    ent.data = f->output().wrap(data_ptr);
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+void
+Workspace::ResultCache::release(const std::string &filter_name)
+{
+    std::map<std::string,Entry>::iterator itr;
+    itr = m_entries.find(filter_name);
+    if(itr == m_entries.end())
+    {
+        return;
+    }
+
+    Data *data = itr->second.data;
+    m_entries.erase(itr);
+
+    data->release();
+    delete data;
+}
+
+//-----------------------------------------------------------------------------
+void
+Workspace::ResultCache::attach(Registry &registry,
+                               const std::string &filter_name,
+                               Data &data)
+{
+    registry.add_untracked(filter_name, data);
+    m_attached.insert(filter_name);
+}
+
+//-----------------------------------------------------------------------------
+void
+Workspace::ResultCache::detach(Registry &registry)
+{
+    std::set<std::string>::const_iterator itr;
+    for(itr = m_attached.begin(); itr != m_attached.end(); itr++)
+    {
+        registry.detach(*itr);
+    }
+    m_attached.clear();
+}
+
+//-----------------------------------------------------------------------------
+void
+Workspace::ResultCache::clear()
+{
+    while(!m_entries.empty())
+    {
+        release(m_entries.begin()->first);
+    }
+
+    m_keys.clear();
+    m_attached.clear();
+    m_fingerprints.clear();
+    m_field_fingerprints.clear();
+}
+
+//-----------------------------------------------------------------------------
+void
+Workspace::ResultCache::info(Node &out) const
+{
+    out.reset();
+    out["enabled"] = m_enabled ? "true" : "false";
+    out["hits"]    = m_hits;
+    out["misses"]  = m_misses;
+
+    Node &ents = out["entries"];
+    ents.set(DataType::object());
+
+    std::map<std::string,Entry>::const_iterator itr;
+    for(itr = m_entries.begin(); itr != m_entries.end(); itr++)
+    {
+        ents[itr->first]["key"] = itr->second.key;
+    }
+}
+
 //-----------------------------------------------------------------------------
 //-----------------------------------------------------------------------------
 
 //-----------------------------------------------------------------------------
 Workspace::Workspace()
-:m_graph(this),
+:m_id(m_next_id++),
+ m_graph(this),
  m_registry(),
+ m_result_cache(NULL),
+ m_max_threads(1),
  m_timing_exec_count(0),
  m_timing_info()
 {
-
+    m_result_cache = new ResultCache();
 }
 
 //-----------------------------------------------------------------------------
 Workspace::~Workspace()
 {
-
+    // make sure the registry no longer refs any cached results
+    // before we release them
+    m_registry.reset();
+    delete m_result_cache;
 }
 
 //-----------------------------------------------------------------------------
@@ -292,6 +1117,13 @@ Workspace::registry() const
     return m_registry;
 }
 
+//-----------------------------------------------------------------------------
+int
+Workspace::id() const
+{
+    return m_id;
+}
+
 //-----------------------------------------------------------------------------
 void
 Workspace::traversals(Node &traversals)
@@ -300,13 +1132,143 @@ Workspace::traversals(Node &traversals)
     ExecutionPlan::generate(graph(),traversals);
 }
 
+//-----------------------------------------------------------------------------
+void
+Workspace::set_max_threads(int max_threads)
+{
+    if(max_threads < 1)
+    {
+        CONDUIT_ERROR("flow::Workspace max_threads must be at least 1,"
+                      " (value = " << max_threads << ")");
+    }
+    m_max_threads = max_threads;
+}
+
+//-----------------------------------------------------------------------------
+int
+Workspace::max_threads() const
+{
+    return m_max_threads;
+}
+
+//-----------------------------------------------------------------------------
+void
+Workspace::enable_result_cache(bool enabled)
+{
+    if(!enabled)
+    {
+        // make sure the registry no longer refs any cached results
+        registry().reset();
+    }
+    m_result_cache->set_enabled(enabled);
+}
+
+//-----------------------------------------------------------------------------
+bool
+Workspace::result_cache_enabled() const
+{
+    return m_result_cache->enabled();
+}
+
+//-----------------------------------------------------------------------------
+void
+Workspace::set_fingerprint(const std::string &filter_name,
+                           const std::string &fingerprint)
+{
+    m_result_cache->set_fingerprint(filter_name, fingerprint);
+}
+
+//-----------------------------------------------------------------------------
+void
+Workspace::set_field_fingerprints(const std::string &filter_name,
+                                  const conduit::Node &fields)
+{
+    m_result_cache->set_field_fingerprints(filter_name, fields);
+}
+
+//-----------------------------------------------------------------------------
+void
+Workspace::clear_result_cache()
+{
+    // make sure the registry no longer refs any cached results
+    registry().reset();
+    m_result_cache->clear();
+}
+
+//-----------------------------------------------------------------------------
+void
+Workspace::set_skipped_filters(const std::set<std::string> &filter_names)
+{
+    m_skipped_filters = filter_names;
+}
+
 //-----------------------------------------------------------------------------
 void
 Workspace::execute()
 {
-    Timer t_total_exec;
+    const double start = Tracer::now();
+    TraceScope trace("execute", "flow");
     Node traversals;
     ExecutionPlan::generate(graph(),traversals);
+    // keys come from the whole graph, so they don't depend on which
+    // filters are skipped
+    m_result_cache->prepare(graph(),traversals);
+
+    if(!m_skipped_filters.empty())
+    {
+        ExecutionPlan::skip(graph(), m_skipped_filters, traversals);
+    }
+
+    try
+    {
+        if(m_max_threads > 1)
+        {
+            {
+                std::lock_guard<std::mutex> lock(m_timing_mutex);
+                m_timing_info << m_timing_exec_count
+                              << " [schedule] parallel "
+                              << m_max_threads
+                              << "\n";
+            }
+            ParallelExecutor executor(*this, traversals, m_max_threads);
+            executor.execute();
+        }
+        else
+        {
+            execute_serial(traversals);
+        }
+    }
+    catch(...)
+    {
+        m_result_cache->detach(registry());
+        throw;
+    }
+
+    // the cache may release these results before the next execute,
+    // so the registry must not keep refs to them
+    m_result_cache->detach(registry());
+
+    record_timing("[total]", start);
+    m_timing_exec_count++;
+}
+
+//-----------------------------------------------------------------------------
+void
+Workspace::record_timing(const std::string &name,
+                         double start)
+{
+    const double elapsed = (Tracer::now() - start) / 1.0e6;
+    std::lock_guard<std::mutex> lock(m_timing_mutex);
+    m_timing_info << m_timing_exec_count
+                  << " " << name
+                  << " " << std::fixed << elapsed
+                  << "\n";
+}
+
+//-----------------------------------------------------------------------------
+void
+Workspace::execute_serial(Node &traversals)
+{
     // execute traversals
     NodeIterator travs_itr = traversals.children();
 
@@ -335,26 +1297,48 @@ Workspace::execute()
                 f->set_input(port_name,&registry().fetch(f_input_name));
             }
 
-            Timer t_flt_exec;
-            // execute
-            f->execute();
-
-            m_timing_info << m_timing_exec_count
-                          << " " << f->name()
-                          << " " << std::fixed << t_flt_exec.elapsed()
-                          <<"\n";
+            // execute, unless we can reuse a cached result
+            Data *cached = m_result_cache->fetch(f);
+            const double start = Tracer::now();
+            if(cached == NULL)
+            {
+                TraceScope trace(f->type_name(), "flow", f_name);
+                f->execute();
+            }
+            else
+            {
+                TraceScope trace(f->type_name(), "flow,cached", f_name);
+            }
+            record_timing(f_name, start);
 
+            if(cached != NULL)
+            {
+                // the cache owns this result, don't track it
+                m_result_cache->attach(registry(),
+                                       f_name,
+                                       *cached);
+            }
             // if has output, set output
-            if(f->output_port())
+            else if(f->output_port())
             {
                 if(f->output().data_ptr() == NULL)
                 {
                     CONDUIT_ERROR("filter output is NULL, was set_output() called?");
                 }
 
-                registry().add(f_name,
-                               f->output(),
-                               uref);
+                if(m_result_cache->store(f))
+                {
+                    // the cache took ownership of the output
+                    m_result_cache->attach(registry(),
+                                           f_name,
+                                           f->output());
+                }
+                else
+                {
+                    registry().add(f_name,
+                                   f->output(),
+                                   uref);
+                }
             }
 
             f->reset_inputs_and_output();
@@ -369,15 +1353,6 @@ Workspace::execute()
             }
         }
     }
-
-    m_timing_info << m_timing_exec_count
-                  << " [total] "
-                  << std::fixed << t_total_exec.elapsed()
-                  <<"\n";
-
-
-    m_timing_exec_count++;
-
 }
 
 
@@ -387,6 +1362,9 @@ Workspace::reset()
 {
     graph().reset();
     registry().reset();
+    m_skipped_filters.clear();
+    // cached results are only valid for the graph that created them
+    m_result_cache->clear();
 }
 
 
@@ -398,6 +1376,7 @@ Workspace::info(Node &out) const
 
     graph().info(out["graph"]);
     registry().info(out["registry"]);
+    m_result_cache->info(out["result_cache"]);
     out["timings"] = timing_info();
 }
 
@@ -424,13 +1403,16 @@ Workspace::print() const
 void
 Workspace::reset_timing_info()
 {
+    std::lock_guard<std::mutex> lock(m_timing_mutex);
     m_timing_exec_count = 0;
     m_timing_info.str("");
 }
+
 //-----------------------------------------------------------------------------
 string
 Workspace::timing_info() const
 {
+    std::lock_guard<std::mutex> lock(m_timing_mutex);
     return m_timing_info.str();
 }
 
@@ -59,6 +59,9 @@
 #include <flow_data.hpp>
 #include <flow_registry.hpp>
 #include <flow_graph.hpp>
+#include <atomic>
+#include <mutex>
+#include <set>
 #include <sstream>
 
 
@@ -98,12 +101,61 @@ public:
     /// const access to the registry
     const Registry  &registry() const;
 
+    /// returns an id that is unique among the workspaces created by
+    /// this process. ids are assigned in creation order, so they match
+    /// across ranks that create their workspaces in the same order.
+    int              id() const;
+
     /// compute and return the graph traverals
     void             traversals(conduit::Node &out);
 
     /// execute the filter graph.
+    /// when flow::Tracer is enabled, an event is recorded for the
+    /// execute and for each filter.
     void             execute();
 
+    /// sets the max number of threads used to execute filters.
+    /// with more than one thread, filters whose inputs are ready
+    /// are dispatched concurrently to a pool of worker threads.
+    /// (default = 1, filters are executed serially in traversal order)
+    ///
+    /// Note: concurrent execution is only safe when the filters in the
+    /// graph are thread safe and do not issue MPI collectives.
+    void             set_max_threads(int max_threads);
+    /// returns the max number of threads used to execute filters.
+    int              max_threads() const;
+
+    /// enables or disables caching of filter outputs across calls
+    /// to execute(). (default = disabled)
+    ///
+    /// Only outputs of filters that declare themselves "cacheable" are
+    /// kept. A cached output is reused when the filter's params and the
+    /// fingerprints of all of its inputs match the last execute.
+    /// Fingerprints start at filters without inputs, which must be
+    /// provided a fingerprint using set_fingerprint().
+    void             enable_result_cache(bool enabled);
+    /// returns if the result cache is enabled
+    bool             result_cache_enabled() const;
+    /// sets the fingerprint for a filter w/o inputs (a data source)
+    /// the fingerprint should change whenever the source's output changes.
+    void             set_fingerprint(const std::string &filter_name,
+                                     const std::string &fingerprint);
+    /// sets fingerprints for the fields of a source (an object of
+    /// field name to fingerprint string). A cached output is only
+    /// invalidated by the fields it (or a filter downstream) reads,
+    /// see the "field_usage" filter interface option.
+    void             set_field_fingerprints(const std::string &filter_name,
+                                            const conduit::Node &fields);
+    /// releases all cached filter outputs
+    void             clear_result_cache();
+
+    /// sets the filters that execute() leaves out. A filter in the set
+    /// still executes when a filter that is not left out reads its
+    /// output. The graph and the result cache are kept, so filters can
+    /// be left out of one execute and run again in the next.
+    /// (default = none, cleared by reset())
+    void             set_skipped_filters(const std::set<std::string> &filter_names);
+
     /// reset the registry and graph
     void             reset();
 
@@ -115,9 +167,12 @@ public:
     /// print json version of info
     void           print() const;
 
-    /// resets state used to capture timing events
+    /// resets the timing summary
     void           reset_timing_info();
-    /// return a string of recorded timing events
+    /// return a summary of the filter executions of this workspace,
+    /// one "<execute> <filter> <seconds>" line per filter and one
+    /// "<execute> [total] <seconds>" line per execute. the summary is
+    /// recorded whether or not flow::Tracer is enabled.
     std::string    timing_info() const;
 
     // ------------------------------------------------------------------------
@@ -185,14 +240,27 @@ private:
     static Filter *create_filter(const std::string &filter_type);
 
     static int  m_default_mpi_comm;
+    static std::atomic<int> m_next_id;
 
     class ExecutionPlan;
+    class ParallelExecutor;
+    class ResultCache;
     class FilterFactory;
 
+    void              execute_serial(conduit::Node &traversals);
+    // adds a line to the timing summary for an event started at `start`
+    void              record_timing(const std::string &name,
+                                    double start);
+
+    int               m_id;
     Graph             m_graph;
     Registry          m_registry;
+    ResultCache      *m_result_cache;
+    std::set<std::string> m_skipped_filters;
+    int               m_max_threads;
     int               m_timing_exec_count;
     std::stringstream m_timing_info;
+    mutable std::mutex m_timing_mutex;
 
 };
 
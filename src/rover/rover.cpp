@@ -40,6 +40,7 @@
 //
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 #include <scheduler.hpp>
+#include <static_scheduler.hpp>
 #include <rover.hpp>
 #include <rover_exceptions.hpp>
 #include <vtkm_typedefs.hpp>
@@ -59,6 +60,7 @@ public:
 protected:
   SchedulerBase            *m_scheduler;
   TracePrecision            m_precision;
+  SchedulerType             m_scheduler_type;
 #ifdef ROVER_PARALLEL
   MPI_Comm                  m_comm_handle;
   int                       m_rank;
@@ -70,11 +72,44 @@ protected:
 
   }
 
+  SchedulerBase* create_scheduler()
+  {
+    if(m_precision == ROVER_DOUBLE)
+    {
+      if(m_scheduler_type == static_scheduler)
+      {
+        return new StaticScheduler<vtkm::Float64>();
+      }
+      return new Scheduler<vtkm::Float64>();
+    }
+
+    if(m_scheduler_type == static_scheduler)
+    {
+      return new StaticScheduler<vtkm::Float32>();
+    }
+    return new Scheduler<vtkm::Float32>();
+  }
+
+  //
+  // replaces the scheduler after a precision or scheduler type change,
+  // keeping the domains and settings already provided
+  //
+  void reset_scheduler()
+  {
+    std::vector<Domain> domains = m_scheduler->get_domains();
+    RenderSettings render_settings = m_scheduler->get_render_settings();
+    delete m_scheduler;
+    m_scheduler = create_scheduler();
+    m_scheduler->set_domains(domains);
+    m_scheduler->set_render_settings(render_settings);
+  }
+
 public:
   InternalsType()
   {
     m_precision = ROVER_FLOAT;
-    m_scheduler = new Scheduler<vtkm::Float32>();
+    m_scheduler_type = composite_scheduler;
+    m_scheduler = create_scheduler();
 
 #ifdef ROVER_PARALLEL
     m_rank = 1;
@@ -103,9 +138,11 @@ public:
     //       be benificial in the case where we may or may not scatter in a given
     //       domain. Thus, avoid waiting for the ray to emerge or throw out the results
 //#else
-     //if(render_settings compared to old means new schedular)
-     //if(m_scheduler == NULL) delete m_scheduler;
-     //m_scheduler = new Scheduler<FloatType>();
+     if(render_settings.m_scheduler_type != m_scheduler_type)
+     {
+       m_scheduler_type = render_settings.m_scheduler_type;
+       reset_scheduler();
+     }
      m_scheduler->set_render_settings(render_settings);
 //#endif
    }
@@ -203,9 +240,8 @@ public:
   {
     if(m_precision == ROVER_DOUBLE)
     {
-      std::vector<Domain> domains = m_scheduler->get_domains();
-      delete m_scheduler;
-      m_scheduler = new Scheduler<vtkm::Float32>();
+      m_precision = ROVER_FLOAT;
+      reset_scheduler();
     }
   }
 
@@ -213,9 +249,8 @@ public:
   {
     if(m_precision == ROVER_FLOAT)
     {
-      std::vector<Domain> domains = m_scheduler->get_domains();
-      delete m_scheduler;
-      m_scheduler = new Scheduler<vtkm::Float64>();
+      m_precision = ROVER_DOUBLE;
+      reset_scheduler();
     }
   }
 
@@ -67,6 +67,15 @@ enum RayScope
   local_rays    // ran only exist in a single domain st any given time
 };
 //
+// Scheduler type is only meaningful in parallel and is ignored otherwise
+//
+enum SchedulerType
+{
+  composite_scheduler, // all ranks composite every ray on a common image
+  static_scheduler     // image tiles are owned by the ranks whose screen space
+                       // footprints cover them, and rays are only sent to tile owners
+};
+//
 // Volume rendering specific settigns
 //
 struct VolumeSettings
@@ -95,6 +104,7 @@ struct RenderSettings
   RenderMode     m_render_mode;
   ScatteringType m_scattering_type;
   RayScope       m_ray_scope;
+  SchedulerType  m_scheduler_type;
   vtkmColorTable m_color_table;
   std::string    m_primary_field;
   std::string    m_secondary_field;
@@ -109,6 +119,7 @@ struct RenderSettings
     m_render_mode     = volume;
     m_scattering_type = non_scattering;
     m_ray_scope       = global_rays;
+    m_scheduler_type  = composite_scheduler;
   }
 
   void print()
@@ -57,6 +57,32 @@
 
 namespace rover {
 
+namespace detail
+{
+//
+// Converts each partial image into the compositor's representation.
+// Partial images are independent (one or more per domain), so when
+// there is more than one, the images are extracted concurrently and
+// the per-image loops run serially inside each thread. This keeps
+// all cores busy on ranks that hold many small domains.
+//
+template<typename PartialType, typename FloatType>
+void extract_all_partials(std::vector<PartialImage<FloatType>> &images,
+                          std::vector<std::vector<PartialType>> &partials)
+{
+  const int num_partials = static_cast<int>(images.size());
+  partials.resize(num_partials);
+#ifdef ROVER_ENABLE_OPENMP
+  #pragma omp parallel for schedule(dynamic) if(num_partials > 1)
+#endif
+  for(int i = 0; i < num_partials; ++i)
+  {
+    images[i].extract_partials(partials[i]);
+  }
+}
+
+} // namespace detail
+
 template<typename FloatType>
 Scheduler<FloatType>::Scheduler()
 {
@@ -267,15 +293,10 @@ void Scheduler<FloatType>::composite()
 #ifdef ROVER_PARALLEL
     compositor.set_comm_handle(MPI_Comm_c2f(m_comm_handle));
 #endif
-    const int num_partials = m_partial_images.size();
     int width = m_partial_images[0].m_width;
     int height = m_partial_images[0].m_height;
     std::vector<std::vector<vtkh::VolumePartial<FloatType>>> partials;
-    partials.resize(num_partials);
-    for(int i = 0; i < num_partials; ++i)
-    {
-      m_partial_images[i].extract_partials(partials[i]);
-    }
+    detail::extract_all_partials(m_partial_images, partials);
     std::vector<vtkh::VolumePartial<FloatType>> result;
     compositor.composite(partials, result);
     PartialImage<FloatType> p_result;
@@ -297,15 +318,10 @@ void Scheduler<FloatType>::composite()
 #ifdef ROVER_PARALLEL
       compositor.set_comm_handle(MPI_Comm_c2f(m_comm_handle));
 #endif
-      const int num_partials = m_partial_images.size();
       int width = m_partial_images[0].m_width;
       int height = m_partial_images[0].m_height;
       std::vector<std::vector<vtkh::EmissionPartial<FloatType>>> partials;
-      partials.resize(num_partials);
-      for(int i = 0; i < num_partials; ++i)
-      {
-        m_partial_images[i].extract_partials(partials[i]);
-      }
+      detail::extract_all_partials(m_partial_images, partials);
       std::vector<vtkh::EmissionPartial<FloatType>> result;
       compositor.composite(partials, result);
       PartialImage<FloatType> p_result;
@@ -325,15 +341,10 @@ void Scheduler<FloatType>::composite()
 #ifdef ROVER_PARALLEL
       compositor.set_comm_handle(MPI_Comm_c2f(m_comm_handle));
 #endif
-      const int num_partials = m_partial_images.size();
       int width = m_partial_images[0].m_width;
       int height = m_partial_images[0].m_height;
       std::vector<std::vector<vtkh::AbsorptionPartial<FloatType>>> partials;
-      partials.resize(num_partials);
-      for(int i = 0; i < num_partials; ++i)
-      {
-        m_partial_images[i].extract_partials(partials[i]);
-      }
+      detail::extract_all_partials(m_partial_images, partials);
       std::vector<vtkh::AbsorptionPartial<FloatType>> result;
       compositor.composite(partials, result);
       PartialImage<FloatType> p_result;
@@ -398,6 +409,11 @@ Scheduler<FloatType>::trace_rays()
   this->set_global_scalar_range();
   this->set_global_bounds();
 
+  //
+  // Setting the coordinate system miminizes the number of rays generated
+  //
+  CameraGenerator *camera_generator = dynamic_cast<CameraGenerator*>(m_ray_generator);
+
   vtkmTimer trace_timer;
   trace_timer.Start();
   for(int i = 0; i < num_domains; ++i)
@@ -409,13 +425,9 @@ Scheduler<FloatType>::trace_rays()
     ROVER_DATA_OPEN(domain_s.str());
 
     vtkmLogger::GetInstance()->Clear();
-    if(dynamic_cast<CameraGenerator*>(m_ray_generator) != NULL)
+    if(camera_generator != NULL)
     {
-      //
-      // Setting the coordinate system miminizes the number of rays generated
-      //
-      CameraGenerator *generator = dynamic_cast<CameraGenerator*>(m_ray_generator);
-      generator->set_coordinates(m_domains[i].get_data_set().GetCoordinateSystem());
+      camera_generator->set_coordinates(m_domains[i].get_data_set().GetCoordinateSystem());
     }
     ROVER_INFO("Generating rays for domian "<<i);
 
@@ -425,6 +437,19 @@ Scheduler<FloatType>::trace_rays()
     m_ray_generator->get_rays(rays);
 
     ROVER_INFO("Generated "<<rays.NumRays<<" rays");
+    time = timer.GetElapsedTime();
+    ROVER_DATA_ADD("domain_generate_rays", time);
+
+    // domains outside of the view do not contribute to the image
+    if(rays.NumRays == 0)
+    {
+      time = domain_timer.GetElapsedTime();
+      ROVER_DATA_CLOSE(time);
+      ROVER_INFO("Schedule: skipping domain "<<i<<" (no rays)");
+      continue;
+    }
+
+    timer.Start();
     m_domains[i].init_rays(rays);
     time = timer.GetElapsedTime();
     ROVER_DATA_ADD("domain_init_rays", time);
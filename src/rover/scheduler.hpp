@@ -78,7 +78,7 @@ public:
   virtual void get_result(Image<vtkm::Float32> &image) override;
   virtual void get_result(Image<vtkm::Float64> &image) override;
 protected:
-  void composite();
+  virtual void composite();
   void set_global_scalar_range();
   void set_global_bounds();
   int  get_global_channels();
@@ -108,6 +108,12 @@ SchedulerBase::add_data_set(vtkmDataSet &dataset)
   m_domains.push_back(domain);
 }
 
+RenderSettings
+SchedulerBase::get_render_settings() const
+{
+  return m_render_settings;
+}
+
 vtkmDataSet
 SchedulerBase::get_data_set(const int &domain)
 {
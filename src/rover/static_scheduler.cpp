@@ -0,0 +1,539 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2018, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-749865
+//
+// All rights reserved.
+//
+// This file is part of Rover.
+//
+// Please also read rover/LICENSE
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the disclaimer below.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the disclaimer (as noted below) in the
+//   documentation and/or other materials provided with the distribution.
+//
+// * Neither the name of the LLNS/LLNL nor the names of its contributors may
+//   be used to endorse or promote products derived from this software without
+//   specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL LAWRENCE LIVERMORE NATIONAL SECURITY,
+// LLC, THE U.S. DEPARTMENT OF ENERGY OR CONTRIBUTORS BE LIABLE FOR ANY
+// DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include <static_scheduler.hpp>
+#include <rover_exceptions.hpp>
+#include <utils/rover_logging.hpp>
+
+#ifdef ROVER_PARALLEL
+#include <mpi.h>
+#include <vtkh/rendering/PartialCompositor.hpp>
+#endif
+
+#include <algorithm>
+#include <limits>
+
+namespace rover {
+
+#ifdef ROVER_PARALLEL
+namespace detail
+{
+
+// edge length of the square image tiles in pixels
+const int static_tile_size = 64;
+
+//
+// Computes the tile owners from the screen space footprints of all ranks
+// (x_min, x_max, y_min, y_max in pixels). Each tile goes to the rank whose
+// footprint covers most of it, as long as that rank does not already own
+// twice its fair share of the covered tiles. Tiles that no footprint
+// covers have no rays and get an owner of -1. Every rank computes the
+// same assignment.
+//
+void assign_tiles(const std::vector<int> &footprints,
+                  const int width,
+                  const int height,
+                  std::vector<int> &owners)
+{
+  const int num_ranks = static_cast<int>(footprints.size() / 4);
+  const int tiles_x = (width + static_tile_size - 1) / static_tile_size;
+  const int tiles_y = (height + static_tile_size - 1) / static_tile_size;
+  const int num_tiles = tiles_x * tiles_y;
+
+  std::vector<long long> overlaps(num_tiles * num_ranks, 0);
+  int covered_tiles = 0;
+  for(int t = 0; t < num_tiles; ++t)
+  {
+    const int tile_x_min = (t % tiles_x) * static_tile_size;
+    const int tile_y_min = (t / tiles_x) * static_tile_size;
+    const int tile_x_max = std::min(width, tile_x_min + static_tile_size) - 1;
+    const int tile_y_max = std::min(height, tile_y_min + static_tile_size) - 1;
+
+    bool covered = false;
+    for(int r = 0; r < num_ranks; ++r)
+    {
+      const int *footprint = &footprints[r * 4];
+      const long long x = std::min(footprint[1], tile_x_max) -
+                          std::max(footprint[0], tile_x_min) + 1;
+      const long long y = std::min(footprint[3], tile_y_max) -
+                          std::max(footprint[2], tile_y_min) + 1;
+      if(x > 0 && y > 0)
+      {
+        overlaps[t * num_ranks + r] = x * y;
+        covered = true;
+      }
+    }
+    if(covered) covered_tiles++;
+  }
+
+  const int fair_share = (covered_tiles + num_ranks - 1) / num_ranks;
+  const int max_tiles = std::max(1, 2 * fair_share);
+
+  std::vector<int> loads(num_ranks, 0);
+  owners.resize(num_tiles);
+  for(int t = 0; t < num_tiles; ++t)
+  {
+    int owner = -1;
+    long long best_overlap = 0;
+    bool covered = false;
+    for(int r = 0; r < num_ranks; ++r)
+    {
+      const long long overlap = overlaps[t * num_ranks + r];
+      if(overlap == 0) continue;
+      covered = true;
+      if(loads[r] >= max_tiles) continue;
+      if(overlap > best_overlap ||
+         (overlap == best_overlap && loads[r] < loads[owner]))
+      {
+        owner = r;
+        best_overlap = overlap;
+      }
+    }
+
+    if(covered && owner == -1)
+    {
+      // every rank covering this tile is full, use the least loaded rank
+      owner = static_cast<int>(std::min_element(loads.begin(), loads.end()) - loads.begin());
+    }
+
+    if(owner != -1)
+    {
+      loads[owner]++;
+    }
+    owners[t] = owner;
+  }
+}
+
+//
+// Rays stored as flat arrays so they can be sent with MPI
+//
+template<typename FloatType>
+struct RayArrays
+{
+  std::vector<vtkm::Id>  m_pixel_ids;
+  std::vector<FloatType> m_distances;
+  std::vector<FloatType> m_buffer;
+  std::vector<FloatType> m_intensities;
+};
+
+template<typename FloatType>
+void append_ray(RayArrays<FloatType> &rays,
+                const vtkm::Id pixel_id,
+                const FloatType distance,
+                const FloatType *buffer,
+                const FloatType *intensities,
+                const int num_channels)
+{
+  rays.m_pixel_ids.push_back(pixel_id);
+  rays.m_distances.push_back(distance);
+  rays.m_buffer.insert(rays.m_buffer.end(), buffer, buffer + num_channels);
+  if(intensities != NULL)
+  {
+    rays.m_intensities.insert(rays.m_intensities.end(),
+                              intensities,
+                              intensities + num_channels);
+  }
+}
+
+//
+// MPI counts and displacements are ints. Sending elements of sizeof(T)
+// bytes (instead of raw bytes) keeps large images within range, and the
+// totals are checked so an overflow is an error instead of a bad message.
+//
+template<typename T>
+MPI_Datatype element_type()
+{
+  MPI_Datatype type;
+  MPI_Type_contiguous(static_cast<int>(sizeof(T)), MPI_BYTE, &type);
+  MPI_Type_commit(&type);
+  return type;
+}
+
+inline int check_count(const size_t count)
+{
+  if(count > static_cast<size_t>(std::numeric_limits<int>::max()))
+  {
+    throw RoverException("Static scheduler: message exceeds the maximum MPI count");
+  }
+  return static_cast<int>(count);
+}
+
+//
+// Sends rays[r] to rank r and returns everything received
+//
+template<typename T>
+void exchange(std::vector<std::vector<T>> &send,
+              std::vector<T> &recv,
+              MPI_Comm comm)
+{
+  const int num_ranks = static_cast<int>(send.size());
+  std::vector<int> send_counts(num_ranks);
+  std::vector<int> send_displs(num_ranks);
+  std::vector<int> recv_counts(num_ranks);
+  std::vector<int> recv_displs(num_ranks);
+
+  std::vector<T> send_buffer;
+  for(int r = 0; r < num_ranks; ++r)
+  {
+    send_displs[r] = check_count(send_buffer.size());
+    send_counts[r] = check_count(send[r].size());
+    send_buffer.insert(send_buffer.end(), send[r].begin(), send[r].end());
+  }
+  check_count(send_buffer.size());
+
+  MPI_Alltoall(&send_counts[0], 1, MPI_INT, &recv_counts[0], 1, MPI_INT, comm);
+
+  size_t recv_size = 0;
+  for(int r = 0; r < num_ranks; ++r)
+  {
+    recv_displs[r] = check_count(recv_size);
+    recv_size += recv_counts[r];
+  }
+  check_count(recv_size);
+  recv.resize(recv_size);
+
+  MPI_Datatype type = element_type<T>();
+  MPI_Alltoallv(send_buffer.data(), &send_counts[0], &send_displs[0], type,
+                recv.data(), &recv_counts[0], &recv_displs[0], type,
+                comm);
+  MPI_Type_free(&type);
+}
+
+//
+// Gathers the values from all ranks on rank 0
+//
+template<typename T>
+void gather(std::vector<T> &send,
+            std::vector<T> &recv,
+            MPI_Comm comm)
+{
+  int rank, num_ranks;
+  MPI_Comm_rank(comm, &rank);
+  MPI_Comm_size(comm, &num_ranks);
+
+  int send_count = check_count(send.size());
+  std::vector<int> recv_counts(num_ranks, 0);
+  std::vector<int> recv_displs(num_ranks, 0);
+
+  MPI_Gather(&send_count, 1, MPI_INT, &recv_counts[0], 1, MPI_INT, 0, comm);
+
+  // only rank 0 has the counts, so only rank 0 can detect an overflow
+  // before the collective. Agree on it so no rank is left waiting.
+  int overflow = 0;
+  size_t recv_size = 0;
+  if(rank == 0)
+  {
+    for(int r = 0; r < num_ranks; ++r)
+    {
+      recv_displs[r] = static_cast<int>(recv_size);
+      recv_size += recv_counts[r];
+    }
+    overflow = recv_size > static_cast<size_t>(std::numeric_limits<int>::max()) ? 1 : 0;
+  }
+  MPI_Bcast(&overflow, 1, MPI_INT, 0, comm);
+  if(overflow == 1)
+  {
+    throw RoverException("Static scheduler: message exceeds the maximum MPI count");
+  }
+
+  if(rank == 0)
+  {
+    recv.resize(recv_size);
+  }
+
+  MPI_Datatype type = element_type<T>();
+  MPI_Gatherv(send.data(), send_count, type,
+              recv.data(), &recv_counts[0], &recv_displs[0], type,
+              0, comm);
+  MPI_Type_free(&type);
+}
+
+template<typename FloatType>
+void to_partial_image(RayArrays<FloatType> &rays,
+                      const int num_channels,
+                      const int width,
+                      const int height,
+                      PartialImage<FloatType> &image)
+{
+  const vtkm::Id size = static_cast<vtkm::Id>(rays.m_pixel_ids.size());
+  image.allocate(size, num_channels);
+  image.m_width = width;
+  image.m_height = height;
+
+  auto id_portal = image.m_pixel_ids.GetPortalControl();
+  auto depth_portal = image.m_distances.GetPortalControl();
+  auto buffer_portal = image.m_buffer.Buffer.GetPortalControl();
+  auto intensity_portal = image.m_intensities.Buffer.GetPortalControl();
+  const bool has_intensities = rays.m_intensities.size() != 0;
+
+  for(vtkm::Id i = 0; i < size; ++i)
+  {
+    id_portal.Set(i, rays.m_pixel_ids[i]);
+    depth_portal.Set(i, rays.m_distances[i]);
+    for(int c = 0; c < num_channels; ++c)
+    {
+      const vtkm::Id index = i * num_channels + c;
+      buffer_portal.Set(index, rays.m_buffer[index]);
+      if(has_intensities)
+      {
+        intensity_portal.Set(index, rays.m_intensities[index]);
+      }
+    }
+  }
+}
+
+//
+// Composites the rays of the tiles owned by this rank
+//
+template<typename PartialType, typename FloatType>
+void composite_tiles(PartialImage<FloatType> &rays,
+                     const std::vector<double> &background,
+                     PartialImage<FloatType> &result)
+{
+  std::vector<std::vector<PartialType>> partials(1);
+  rays.extract_partials(partials[0]);
+
+  // tiles are complete on this rank, so composite without communication
+  vtkh::PartialCompositor<PartialType> compositor;
+  compositor.set_background(background);
+  compositor.set_comm_handle(MPI_Comm_c2f(MPI_COMM_SELF));
+
+  std::vector<PartialType> output;
+  compositor.composite(partials, output);
+  result.store(output, background, rays.m_width, rays.m_height);
+}
+
+} // namespace detail
+#endif
+
+template<typename FloatType>
+StaticScheduler<FloatType>::StaticScheduler()
+{
+}
+
+template<typename FloatType>
+StaticScheduler<FloatType>::~StaticScheduler()
+{
+}
+
+template<typename FloatType>
+void
+StaticScheduler<FloatType>::composite()
+{
+#ifdef ROVER_PARALLEL
+  MPI_Comm comm = this->m_comm_handle;
+  int rank, num_ranks;
+  MPI_Comm_rank(comm, &rank);
+  MPI_Comm_size(comm, &num_ranks);
+
+  if(num_ranks == 1)
+  {
+    Scheduler<FloatType>::composite();
+    return;
+  }
+
+  std::vector<PartialImage<FloatType>> &images = this->m_partial_images;
+  const int width = images[0].m_width;
+  const int height = images[0].m_height;
+  const int num_channels = images[0].m_buffer.GetNumChannels();
+  const bool has_intensities = this->m_render_settings.m_render_mode != volume &&
+                               this->m_render_settings.m_secondary_field != "";
+
+  //
+  // find the screen space footprint of this rank and share it
+  //
+  int footprint[4] = {width, -1, height, -1};
+  for(size_t p = 0; p < images.size(); ++p)
+  {
+    auto id_portal = images[p].m_pixel_ids.GetPortalConstControl();
+    const vtkm::Id size = id_portal.GetNumberOfValues();
+    for(vtkm::Id i = 0; i < size; ++i)
+    {
+      const int x = static_cast<int>(id_portal.Get(i) % width);
+      const int y = static_cast<int>(id_portal.Get(i) / width);
+      footprint[0] = std::min(footprint[0], x);
+      footprint[1] = std::max(footprint[1], x);
+      footprint[2] = std::min(footprint[2], y);
+      footprint[3] = std::max(footprint[3], y);
+    }
+  }
+
+  std::vector<int> footprints(num_ranks * 4);
+  MPI_Allgather(footprint, 4, MPI_INT, &footprints[0], 4, MPI_INT, comm);
+
+  std::vector<int> owners;
+  detail::assign_tiles(footprints, width, height, owners);
+  const int tiles_x = (width + detail::static_tile_size - 1) / detail::static_tile_size;
+
+  //
+  // send each ray to the owner of its tile
+  //
+  std::vector<detail::RayArrays<FloatType>> outgoing(num_ranks);
+  for(size_t p = 0; p < images.size(); ++p)
+  {
+    const vtkm::Id size = images[p].m_pixel_ids.GetNumberOfValues();
+    if(size == 0)
+    {
+      continue;
+    }
+
+    auto id_portal = images[p].m_pixel_ids.GetPortalConstControl();
+    auto depth_portal = images[p].m_distances.GetPortalConstControl();
+    const FloatType *buffer = get_vtkm_ptr(images[p].m_buffer.Buffer);
+    const FloatType *intensities = has_intensities
+                                   ? get_vtkm_ptr(images[p].m_intensities.Buffer)
+                                   : NULL;
+    for(vtkm::Id i = 0; i < size; ++i)
+    {
+      const vtkm::Id pixel_id = id_portal.Get(i);
+      const int x = static_cast<int>(pixel_id % width);
+      const int y = static_cast<int>(pixel_id / width);
+      const int tile = (y / detail::static_tile_size) * tiles_x + x / detail::static_tile_size;
+      const int owner = owners[tile];
+      detail::append_ray(outgoing[owner],
+                         pixel_id,
+                         depth_portal.Get(i),
+                         buffer + i * num_channels,
+                         has_intensities ? intensities + i * num_channels : NULL,
+                         num_channels);
+    }
+  }
+
+  std::vector<std::vector<vtkm::Id>> send_ids(num_ranks);
+  std::vector<std::vector<FloatType>> send_distances(num_ranks);
+  std::vector<std::vector<FloatType>> send_buffers(num_ranks);
+  std::vector<std::vector<FloatType>> send_intensities(num_ranks);
+  for(int r = 0; r < num_ranks; ++r)
+  {
+    send_ids[r].swap(outgoing[r].m_pixel_ids);
+    send_distances[r].swap(outgoing[r].m_distances);
+    send_buffers[r].swap(outgoing[r].m_buffer);
+    send_intensities[r].swap(outgoing[r].m_intensities);
+  }
+
+  detail::RayArrays<FloatType> tile_rays;
+  detail::exchange(send_ids, tile_rays.m_pixel_ids, comm);
+  detail::exchange(send_distances, tile_rays.m_distances, comm);
+  detail::exchange(send_buffers, tile_rays.m_buffer, comm);
+  detail::exchange(send_intensities, tile_rays.m_intensities, comm);
+  ROVER_INFO("Static schedule: received "<<tile_rays.m_pixel_ids.size()<<" rays");
+
+  //
+  // composite the owned tiles
+  //
+  PartialImage<FloatType> tile_result;
+  if(tile_rays.m_pixel_ids.size() != 0)
+  {
+    PartialImage<FloatType> tile_image;
+    detail::to_partial_image(tile_rays, num_channels, width, height, tile_image);
+
+    if(this->m_render_settings.m_render_mode == volume)
+    {
+      detail::composite_tiles<vtkh::VolumePartial<FloatType>>(tile_image,
+                                                              this->m_background,
+                                                              tile_result);
+    }
+    else if(has_intensities)
+    {
+      detail::composite_tiles<vtkh::EmissionPartial<FloatType>>(tile_image,
+                                                                this->m_background,
+                                                                tile_result);
+    }
+    else
+    {
+      detail::composite_tiles<vtkh::AbsorptionPartial<FloatType>>(tile_image,
+                                                                  this->m_background,
+                                                                  tile_result);
+    }
+  }
+
+  //
+  // gather the finished tiles on rank 0
+  //
+  detail::RayArrays<FloatType> finished;
+  const vtkm::Id num_finished = tile_result.m_pixel_ids.GetNumberOfValues();
+  if(num_finished != 0)
+  {
+    auto id_portal = tile_result.m_pixel_ids.GetPortalConstControl();
+    auto depth_portal = tile_result.m_distances.GetPortalConstControl();
+    const FloatType *buffer = get_vtkm_ptr(tile_result.m_buffer.Buffer);
+    const FloatType *intensities = get_vtkm_ptr(tile_result.m_intensities.Buffer);
+    for(vtkm::Id i = 0; i < num_finished; ++i)
+    {
+      detail::append_ray(finished,
+                         id_portal.Get(i),
+                         depth_portal.Get(i),
+                         buffer + i * num_channels,
+                         intensities + i * num_channels,
+                         num_channels);
+    }
+  }
+
+  detail::RayArrays<FloatType> image_rays;
+  detail::gather(finished.m_pixel_ids, image_rays.m_pixel_ids, comm);
+  detail::gather(finished.m_distances, image_rays.m_distances, comm);
+  detail::gather(finished.m_buffer, image_rays.m_buffer, comm);
+  detail::gather(finished.m_intensities, image_rays.m_intensities, comm);
+
+  PartialImage<FloatType> p_result;
+  if(rank == 0)
+  {
+    // data only valid on rank = 0
+    detail::to_partial_image(image_rays, num_channels, width, height, p_result);
+    for(int i = 0; i < num_channels && i < static_cast<int>(this->m_background.size()); ++i)
+    {
+      p_result.m_source_sig[i] = this->m_background[i];
+    }
+  }
+
+  this->m_result = p_result;
+  ROVER_INFO("Static schedule: compositing complete");
+#else
+  Scheduler<FloatType>::composite();
+#endif
+}
+
+//
+// Explicit instantiation
+template class StaticScheduler<vtkm::Float32>;
+template class StaticScheduler<vtkm::Float64>;
+}; // namespace rover
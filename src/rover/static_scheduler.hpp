@@ -39,18 +39,31 @@
 // POSSIBILITY OF SUCH DAMAGE.
 //
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
-#ifndef rover_static_schedular_h
-#define rover_static_schedular_h
+#ifndef rover_static_scheduler_h
+#define rover_static_scheduler_h
 
-#include <scheduler.h>
+#include <scheduler.hpp>
 
 namespace rover {
-// static scedular handles the case where all ranks get all rays
-// and takes care of the compositing.
-class StaticSchedular : public Schedular
+//
+// The static scheduler traces rays exactly like the compositing scheduler
+// (each domain only generates rays inside its screen space footprint), but
+// replaces the global composite with a tiled one. The image is divided into
+// tiles and each tile is owned by the rank whose footprint covers most of it.
+// Ranks only send the rays that fall inside tiles owned by other ranks, tile
+// owners composite their tiles locally, and the finished tiles are gathered
+// on rank 0. When rank footprints do not overlap, no rays are exchanged
+// before the final gather.
+//
+template<typename FloatType>
+class StaticScheduler : public Scheduler<FloatType>
 {
 public:
+  StaticScheduler();
+  virtual ~StaticScheduler();
 protected:
+  void composite() override;
 };
-} // namespace rover
+
+}; // namespace rover
 #endif
@@ -76,7 +76,7 @@ PNGEncoder::Encode(const unsigned char *rgba_in,
 
   for (int y=0; y<height; ++y)
   {
-    memcpy(&(rgba_flip[y*height*4]),
+    memcpy(&(rgba_flip[y*width*4]),
            &(rgba_in[(height-y-1)*width*4]),
            width*4);
   }
@@ -110,20 +110,18 @@ PNGEncoder::Encode(const float *rgba_in,
   unsigned char *rgba_flip = new unsigned char[width * height *4];
 
 
-  for(int x = 0; x < width; ++x)
-
 #ifdef ROVER_ENABLE_OPENMP
-    #pragma omp parallel for
+  #pragma omp parallel for
 #endif
-    for (int y = 0; y < height; ++y)
+  for (int y = 0; y < height; ++y)
+  {
+    const int inOffset = y * width * 4;
+    const int outOffset = (height - y - 1) * width * 4;
+    for(int i = 0; i < width * 4; ++i)
     {
-      int inOffset = (y * width + x) * 4;
-      int outOffset = ((height - y - 1) * width + x) * 4;
-      rgba_flip[outOffset + 0] = (unsigned char)(rgba_in[inOffset + 0] * 255.f);
-      rgba_flip[outOffset + 1] = (unsigned char)(rgba_in[inOffset + 1] * 255.f);
-      rgba_flip[outOffset + 2] = (unsigned char)(rgba_in[inOffset + 2] * 255.f);
-      rgba_flip[outOffset + 3] = (unsigned char)(rgba_in[inOffset + 3] * 255.f);
+      rgba_flip[outOffset + i] = (unsigned char)(rgba_in[inOffset + i] * 255.f);
     }
+  }
 
    unsigned error = vtkh::lodepng_encode_memory(&m_buffer,
                                           &m_buffer_size,
@@ -153,20 +151,18 @@ PNGEncoder::Encode(const double *rgba_in,
   unsigned char *rgba_flip = new unsigned char[width * height *4];
 
 
-  for(int x = 0; x < width; ++x)
-
 #ifdef ROVER_ENABLE_OPENMP
-    #pragma omp parallel for
+  #pragma omp parallel for
 #endif
-    for (int y = 0; y < height; ++y)
+  for (int y = 0; y < height; ++y)
+  {
+    const int inOffset = y * width * 4;
+    const int outOffset = (height - y - 1) * width * 4;
+    for(int i = 0; i < width * 4; ++i)
     {
-      int inOffset = (y * width + x) * 4;
-      int outOffset = ((height - y - 1) * width + x) * 4;
-      rgba_flip[outOffset + 0] = (unsigned char)(rgba_in[inOffset + 0] * 255.);
-      rgba_flip[outOffset + 1] = (unsigned char)(rgba_in[inOffset + 1] * 255.);
-      rgba_flip[outOffset + 2] = (unsigned char)(rgba_in[inOffset + 2] * 255.);
-      rgba_flip[outOffset + 3] = (unsigned char)(rgba_in[inOffset + 3] * 255.);
+      rgba_flip[outOffset + i] = (unsigned char)(rgba_in[inOffset + i] * 255.);
     }
+  }
 
    unsigned error = vtkh::lodepng_encode_memory(&m_buffer,
                                           &m_buffer_size,
@@ -197,20 +193,22 @@ PNGEncoder::EncodeChannel(const double *buffer_in,
   unsigned char *rgba_flip = new unsigned char[width * height *4];
 
 
-  for(int x = 0; x < width; ++x)
-
 #ifdef ROVER_ENABLE_OPENMP
-    #pragma omp parallel for
+  #pragma omp parallel for
 #endif
-    for (int y = 0; y < height; ++y)
+  for (int y = 0; y < height; ++y)
+  {
+    const int inOffset = y * width;
+    const int outOffset = (height - y - 1) * width * 4;
+    for(int x = 0; x < width; ++x)
     {
-      int inOffset = (y * width + x);
-      int outOffset = ((height - y - 1) * width + x) * 4;
-      rgba_flip[outOffset + 0] = (unsigned char)(buffer_in[inOffset] * 255.);
-      rgba_flip[outOffset + 1] = (unsigned char)(buffer_in[inOffset] * 255.);
-      rgba_flip[outOffset + 2] = (unsigned char)(buffer_in[inOffset] * 255.);
-      rgba_flip[outOffset + 3] = 255;
+      const unsigned char value = (unsigned char)(buffer_in[inOffset + x] * 255.);
+      rgba_flip[outOffset + x * 4 + 0] = value;
+      rgba_flip[outOffset + x * 4 + 1] = value;
+      rgba_flip[outOffset + x * 4 + 2] = value;
+      rgba_flip[outOffset + x * 4 + 3] = 255;
     }
+  }
 
    unsigned error = vtkh::lodepng_encode_memory(&m_buffer,
                                           &m_buffer_size,
@@ -240,20 +238,22 @@ PNGEncoder::EncodeChannel(const float *buffer_in,
   unsigned char *rgba_flip = new unsigned char[width * height *4];
 
 
-  for(int x = 0; x < width; ++x)
-
 #ifdef ROVER_ENABLE_OPENMP
-    #pragma omp parallel for
+  #pragma omp parallel for
 #endif
-    for (int y = 0; y < height; ++y)
+  for (int y = 0; y < height; ++y)
+  {
+    const int inOffset = y * width;
+    const int outOffset = (height - y - 1) * width * 4;
+    for(int x = 0; x < width; ++x)
     {
-      int inOffset = (y * width + x);
-      int outOffset = ((height - y - 1) * width + x) * 4;
-      rgba_flip[outOffset + 0] = (unsigned char)(buffer_in[inOffset] * 255.);
-      rgba_flip[outOffset + 1] = (unsigned char)(buffer_in[inOffset] * 255.);
-      rgba_flip[outOffset + 2] = (unsigned char)(buffer_in[inOffset] * 255.);
-      rgba_flip[outOffset + 3] = 255;
+      const unsigned char value = (unsigned char)(buffer_in[inOffset + x] * 255.);
+      rgba_flip[outOffset + x * 4 + 0] = value;
+      rgba_flip[outOffset + x * 4 + 1] = value;
+      rgba_flip[outOffset + x * 4 + 2] = value;
+      rgba_flip[outOffset + x * 4 + 3] = 255;
     }
+  }
 
    unsigned error = vtkh::lodepng_encode_memory(&m_buffer,
                                           &m_buffer_size,
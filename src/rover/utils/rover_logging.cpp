@@ -102,6 +102,7 @@ Logger::write(const int level, const std::string &message, const char *file, int
 DataLogger* DataLogger::Instance  = NULL;
 
 DataLogger::DataLogger()
+  : Callback(NULL)
 {
 }
 
@@ -151,15 +152,42 @@ DataLogger::WriteLog()
 void
 DataLogger::OpenLogEntry(const std::string &entryName)
 {
+#ifdef ROVER_ENABLE_LOGGING
     Stream<<entryName<<" "<<"<\n";
+#endif
     Entries.push(entryName);
 }
 void
 DataLogger::CloseLogEntry(const double &entryTime)
 {
+#ifdef ROVER_ENABLE_LOGGING
   this->Stream<<"total_time "<<entryTime<<"\n";
   this->Stream<<this->Entries.top()<<" >\n";
+#endif
+  std::string entry = Entries.top();
   Entries.pop();
+  if(Callback != NULL)
+  {
+    Callback(entry, Entries.empty() ? "" : Entries.top(), entryTime);
+  }
+}
+
+void
+DataLogger::AddLogEvent(const std::string &key, const double &time)
+{
+#ifdef ROVER_ENABLE_LOGGING
+  this->AddLogData(key, time);
+#endif
+  if(Callback != NULL)
+  {
+    Callback(key, Entries.empty() ? "" : Entries.top(), time);
+  }
+}
+
+void
+DataLogger::SetEventCallback(EventCallback callback)
+{
+  Callback = callback;
 }
 
 } // namespace rover
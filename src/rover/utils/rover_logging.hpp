@@ -24,10 +24,19 @@ protected:
 class DataLogger
 {
 public:
+  // receives timed entries: name, name of the enclosing entry and time
+  // in seconds. Called even when the text log is disabled, so host
+  // codes can forward rover timings to their own tracing.
+  typedef void (*EventCallback)(const std::string &name,
+                                const std::string &parent,
+                                const double &time);
+
   ~DataLogger();
   static DataLogger *GetInstance();
   void OpenLogEntry(const std::string &entryName);
   void CloseLogEntry(const double &entryTime);
+  void AddLogEvent(const std::string &key, const double &time);
+  void SetEventCallback(EventCallback callback);
 
   template<typename T>
   void AddLogData(const std::string key, const T &value)
@@ -43,6 +52,7 @@ protected:
   std::stringstream Stream;
   static class DataLogger* Instance;
   std::stack<std::string> Entries;
+  EventCallback Callback;
 };
 
 #ifdef ROVER_ENABLE_LOGGING
@@ -53,19 +63,17 @@ protected:
 #define ROVER_ERROR(msg) rover::Logger::get_instance()->get_stream() <<"<Error>\n" \
   <<"  message: "<< msg <<"\n  file: " <<__FILE__<<"\n  line:  "<<__LINE__<<std::endl;
 
-#define ROVER_DATA_OPEN(name) rover::DataLogger::GetInstance()->OpenLogEntry(name);
-#define ROVER_DATA_CLOSE(time) rover::DataLogger::GetInstance()->CloseLogEntry(time);
-#define ROVER_DATA_ADD(key,value) rover::DataLogger::GetInstance()->AddLogData(key, value);
-
 #else
 #define ROVER_INFO(msg)
 #define ROVER_WARN(msg)
 #define ROVER_ERROR(msg)
-
-#define ROVER_DATA_OPEN(name)
-#define ROVER_DATA_CLOSE(name)
-#define ROVER_DATA_ADD(key,value)
 #endif
+
+// timed entries are always forwarded to the event callback, and
+// written to the data log when logging is enabled
+#define ROVER_DATA_OPEN(name) rover::DataLogger::GetInstance()->OpenLogEntry(name);
+#define ROVER_DATA_CLOSE(time) rover::DataLogger::GetInstance()->CloseLogEntry(time);
+#define ROVER_DATA_ADD(key,value) rover::DataLogger::GetInstance()->AddLogEvent(key, value);
 } // namespace rover
 
 #endif
@@ -139,6 +139,263 @@ TEST(ascent_cinema_a, test_cinema_a)
     EXPECT_TRUE(conduit::utils::is_file(output_file));
 }
 
+//-----------------------------------------------------------------------------
+TEST(ascent_cinema_a, test_cinema_a_batched)
+{
+    // the vtkm runtime is currently our only rendering runtime
+    Node n;
+    ascent::about(n);
+    // only run this test if ascent was built with vtkm support
+    if(n["runtimes/ascent/vtkm/status"].as_string() == "disabled")
+    {
+        ASCENT_INFO("Ascent support disabled, skipping test");
+        return;
+    }
+
+    //
+    // Create example mesh.
+    //
+    Node data, verify_info;
+    conduit::blueprint::mesh::examples::braid("hexs",
+                                               EXAMPLE_MESH_SIDE_DIM,
+                                               EXAMPLE_MESH_SIDE_DIM,
+                                               EXAMPLE_MESH_SIDE_DIM,
+                                               data);
+
+    EXPECT_TRUE(conduit::blueprint::mesh::verify(data,verify_info));
+    std::string db_name = "test_db_batched";
+    string output_path = "./cinema_databases/" + db_name;
+
+    //
+    // Create the actions.
+    //
+    Node actions;
+
+    conduit::Node scenes;
+    scenes["scene1/plots/plt1/type"]         = "pseudocolor";
+    scenes["scene1/plots/plt1/field"] = "braid";
+    scenes["scene1/renders/r1/type"] = "cinema";
+    scenes["scene1/renders/r1/phi"] = 3;
+    scenes["scene1/renders/r1/theta"] = 3;
+    scenes["scene1/renders/r1/db_name"] = db_name;
+    scenes["scene1/renders/r1/annotations"] = "false";
+    // trace the 9 views in batches of 4
+    scenes["scene1/renders/r1/batch_size"] = 4;
+
+    conduit::Node &add_scenes = actions.append();
+    add_scenes["action"] = "add_scenes";
+    add_scenes["scenes"] = scenes;
+
+    //
+    // Run Ascent for two cycles
+    //
+
+    Ascent ascent;
+    Node ascent_opts;
+    ascent_opts["runtime/type"] = "ascent";
+    ascent.open(ascent_opts);
+    for(int cycle = 0; cycle < 2; ++cycle)
+    {
+        data["state/cycle"] = cycle;
+        ascent.publish(data);
+        ascent.execute(actions);
+    }
+    ascent.close();
+
+    // check that every view of both time steps was written
+    const std::string times[2] = {"0.0", "1.0"};
+    const std::string phis[3] = {"-180.0", "-60.0", "60.0"};
+    const std::string thetas[3] = {"-90.0", "-30.0", "30.0"};
+    for(int t = 0; t < 2; ++t)
+    {
+        for(int p = 0; p < 3; ++p)
+        {
+            for(int th = 0; th < 3; ++th)
+            {
+                std::string image = phis[p] + "_" + thetas[th] + "_" + db_name + ".png";
+                image = conduit::utils::join_file_path(times[t], image);
+                image = conduit::utils::join_file_path(output_path, image);
+                EXPECT_TRUE(conduit::utils::is_file(image)) << image;
+            }
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEST(ascent_cinema_a, test_cinema_a_zoom)
+{
+    // the vtkm runtime is currently our only rendering runtime
+    Node n;
+    ascent::about(n);
+    // only run this test if ascent was built with vtkm support
+    if(n["runtimes/ascent/vtkm/status"].as_string() == "disabled")
+    {
+        ASCENT_INFO("Ascent support disabled, skipping test");
+        return;
+    }
+
+    //
+    // Create example mesh.
+    //
+    Node data, verify_info;
+    conduit::blueprint::mesh::examples::braid("hexs",
+                                               EXAMPLE_MESH_SIDE_DIM,
+                                               EXAMPLE_MESH_SIDE_DIM,
+                                               EXAMPLE_MESH_SIDE_DIM,
+                                               data);
+
+    EXPECT_TRUE(conduit::blueprint::mesh::verify(data,verify_info));
+    std::string db_name = "test_db_zoom";
+    string output_path = "./cinema_databases/" + db_name;
+    string render_file = conduit::utils::join_file_path(prepare_output_dir(),
+                                                        "tout_cinema_zoom_render");
+    if(conduit::utils::is_file(render_file + ".png"))
+    {
+        conduit::utils::remove_file(render_file + ".png");
+    }
+
+    //
+    // Create the actions.
+    //
+    Node actions;
+
+    conduit::Node scenes;
+    scenes["scene1/plots/plt1/type"]         = "pseudocolor";
+    scenes["scene1/plots/plt1/field"] = "braid";
+    scenes["scene1/renders/r1/type"] = "cinema";
+    scenes["scene1/renders/r1/phi"] = 2;
+    scenes["scene1/renders/r1/theta"] = 2;
+    scenes["scene1/renders/r1/db_name"] = db_name;
+    scenes["scene1/renders/r1/annotations"] = "false";
+    scenes["scene1/renders/r1/camera/zoom"] = 0.5;
+    scenes["scene1/renders/r1/batch_size"] = 2;
+    // a plain render in the same scene keeps the default batches
+    scenes["scene1/renders/r2/image_name"] = render_file;
+    scenes["scene1/renders/r2/annotations"] = "false";
+
+    conduit::Node &add_scenes = actions.append();
+    add_scenes["action"] = "add_scenes";
+    add_scenes["scenes"] = scenes;
+
+    //
+    // Run Ascent for two cycles with the same data
+    //
+
+    Ascent ascent;
+    Node ascent_opts;
+    ascent_opts["runtime/type"] = "ascent";
+    ascent.open(ascent_opts);
+    for(int cycle = 0; cycle < 2; ++cycle)
+    {
+        data["state/cycle"] = cycle;
+        ascent.publish(data);
+        ascent.execute(actions);
+    }
+    ascent.close();
+
+    EXPECT_TRUE(conduit::utils::is_file(render_file + ".png"));
+
+    // the zoom is applied once, so the views of both time steps match
+    const std::string phis[2] = {"-180.0", "0.0"};
+    const std::string thetas[2] = {"-90.0", "0.0"};
+    for(int p = 0; p < 2; ++p)
+    {
+        for(int th = 0; th < 2; ++th)
+        {
+            std::string image = phis[p] + "_" + thetas[th] + "_" + db_name + ".png";
+            std::string first = conduit::utils::join_file_path(output_path,
+                                  conduit::utils::join_file_path("0.0", image));
+            std::string second = conduit::utils::join_file_path(output_path,
+                                   conduit::utils::join_file_path("1.0", image));
+            EXPECT_TRUE(conduit::utils::is_file(first)) << first;
+            EXPECT_TRUE(conduit::utils::is_file(second)) << second;
+
+            Node info;
+            ascent::PNGCompare compare;
+            bool res = compare.Compare(first, second, info, 0.001f);
+            if(!res)
+            {
+              info.print();
+            }
+            EXPECT_TRUE(res) << image;
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEST(ascent_cinema_a, test_cinema_a_image_channel)
+{
+    // the vtkm runtime is currently our only rendering runtime
+    Node n;
+    ascent::about(n);
+    // only run this test if ascent was built with vtkm support
+    if(n["runtimes/ascent/vtkm/status"].as_string() == "disabled")
+    {
+        ASCENT_INFO("Ascent support disabled, skipping test");
+        return;
+    }
+
+    //
+    // Create example mesh.
+    //
+    Node data, verify_info;
+    conduit::blueprint::mesh::examples::braid("hexs",
+                                               EXAMPLE_MESH_SIDE_DIM,
+                                               EXAMPLE_MESH_SIDE_DIM,
+                                               EXAMPLE_MESH_SIDE_DIM,
+                                               data);
+
+    EXPECT_TRUE(conduit::blueprint::mesh::verify(data,verify_info));
+
+    //
+    // Create the actions.
+    //
+    Node actions;
+
+    conduit::Node scenes;
+    scenes["scene1/plots/plt1/type"]         = "pseudocolor";
+    scenes["scene1/plots/plt1/field"] = "braid";
+    scenes["scene1/renders/r1/type"] = "cinema";
+    scenes["scene1/renders/r1/phi"] = 2;
+    scenes["scene1/renders/r1/theta"] = 2;
+    scenes["scene1/renders/r1/db_name"] = "test_db_image_channel";
+    scenes["scene1/renders/r1/annotations"] = "false";
+
+    conduit::Node &add_scenes = actions.append();
+    add_scenes["action"] = "add_scenes";
+    add_scenes["scenes"] = scenes;
+
+    //
+    // Run Ascent
+    //
+
+    Ascent ascent;
+    Node ascent_opts;
+    ascent_opts["runtime/type"] = "ascent";
+    ascent_opts["image_channel/enabled"] = "true";
+    ascent.open(ascent_opts);
+    for(int cycle = 0; cycle < 2; ++cycle)
+    {
+        data["state/cycle"] = cycle;
+        ascent.publish(data);
+        ascent.execute(actions);
+    }
+
+    // every view of the last time step is held in memory
+    Node info;
+    ascent.info(info);
+    EXPECT_EQ(info["images"].number_of_children(), 4);
+    NodeConstIterator itr = info["images"].children();
+    while(itr.has_next())
+    {
+        const Node &image = itr.next();
+        EXPECT_EQ(image["cycle"].to_int32(), 1);
+        EXPECT_TRUE(image.has_child("png"));
+        EXPECT_EQ(image["png"].as_uint8_ptr()[1], 'P');
+    }
+    ascent.close();
+}
+
 //-----------------------------------------------------------------------------
 int main(int argc, char* argv[])
 {
@@ -55,6 +55,7 @@
 
 #include <iostream>
 #include <cmath>
+#include <algorithm>
 
 #include <conduit_blueprint.hpp>
 
@@ -611,6 +612,180 @@ TEST(ascent_expressions, if_expressions)
     EXPECT_EQ(threw, true);
 }
 
+//-----------------------------------------------------------------------------
+TEST(ascent_expressions, compiled_expression_cache)
+{
+    Node n;
+    ascent::about(n);
+
+    //
+    // Create an example mesh.
+    //
+    Node data, verify_info;
+    conduit::blueprint::mesh::examples::braid("hexs",
+                                              EXAMPLE_MESH_SIDE_DIM,
+                                              EXAMPLE_MESH_SIDE_DIM,
+                                              EXAMPLE_MESH_SIDE_DIM,
+                                              data);
+    // ascent normally adds this but we are doing an end around
+    data["state/domain_id"] = 0;
+    Node multi_dom;
+    blueprint::mesh::to_multi_domain(data, multi_dom);
+
+    runtime::expressions::register_builtin();
+    runtime::expressions::ExpressionEval eval(&multi_dom);
+
+    std::string expr = "max(field(\"braid\")) + 1";
+    conduit::Node res = eval.evaluate(expr);
+    double first = res["value"].to_float64();
+
+    const conduit::Node &info = runtime::expressions::ExpressionEval::get_compiled_info();
+    int64 hits = info["hits"].to_int64();
+    int64 misses = info["misses"].to_int64();
+
+    // the second evaluation reuses the graph, but sees the new data
+    float64_array braid = multi_dom.child(0)["fields/braid/values"].value();
+    for(index_t i = 0; i < braid.number_of_elements(); ++i)
+    {
+      braid[i] *= 2.0;
+    }
+
+    res = eval.evaluate(expr);
+    EXPECT_EQ(info["hits"].to_int64(), hits + 1);
+    EXPECT_EQ(info["misses"].to_int64(), misses);
+    EXPECT_NEAR(res["value"].to_float64(), 2.0 * (first - 1) + 1, 1e-8);
+}
+
+//-----------------------------------------------------------------------------
+TEST(ascent_expressions, compiled_expression_cache_released_on_close)
+{
+    Node n;
+    ascent::about(n);
+
+    //
+    // Create an example mesh.
+    //
+    Node data, verify_info;
+    conduit::blueprint::mesh::examples::braid("hexs",
+                                              EXAMPLE_MESH_SIDE_DIM,
+                                              EXAMPLE_MESH_SIDE_DIM,
+                                              EXAMPLE_MESH_SIDE_DIM,
+                                              data);
+
+    conduit::Node actions;
+    conduit::Node &add_queries = actions.append();
+    add_queries["action"] = "add_queries";
+    add_queries["queries/q1/params/expression"] = "max(field(\"braid\"))";
+    add_queries["queries/q1/params/name"] = "max_braid";
+
+    Ascent ascent;
+    Node ascent_opts;
+    ascent_opts["runtime/type"] = "ascent";
+    ascent.open(ascent_opts);
+    ascent.publish(data);
+    ascent.execute(actions);
+
+    Node info;
+    ascent.info(info);
+    EXPECT_TRUE(info.has_path("expression_cache"));
+
+    // the compiled graphs belong to the closed instance
+    ascent.close();
+    const conduit::Node &compiled_info =
+      runtime::expressions::ExpressionEval::get_compiled_info();
+    EXPECT_EQ(compiled_info.number_of_children(), 0);
+}
+
+//-----------------------------------------------------------------------------
+TEST(ascent_expressions, fused_field_reductions)
+{
+    Node n;
+    ascent::about(n);
+
+    //
+    // Create an example mesh.
+    //
+    Node data, verify_info;
+    conduit::blueprint::mesh::examples::braid("hexs",
+                                              EXAMPLE_MESH_SIDE_DIM,
+                                              EXAMPLE_MESH_SIDE_DIM,
+                                              EXAMPLE_MESH_SIDE_DIM,
+                                              data);
+    // ascent normally adds this but we are doing an end around
+    data["state/domain_id"] = 0;
+    Node multi_dom;
+    blueprint::mesh::to_multi_domain(data, multi_dom);
+
+    float64_array braid = multi_dom.child(0)["fields/braid/values"].value();
+    double min_val = braid[0];
+    double max_val = braid[0];
+    double sum = 0.;
+    for(index_t i = 0; i < braid.number_of_elements(); ++i)
+    {
+      min_val = std::min(min_val, braid[i]);
+      max_val = std::max(max_val, braid[i]);
+      sum += braid[i];
+    }
+    const double count = braid.number_of_elements();
+
+    runtime::expressions::register_builtin();
+    runtime::expressions::ExpressionEval eval(&multi_dom);
+
+    // min and max share a single pass over the field
+    std::string expr = "max(field(\"braid\")).value - min(field(\"braid\")).value";
+    conduit::Node res = eval.evaluate(expr);
+    EXPECT_NEAR(res["value"].to_float64(), max_val - min_val, 1e-8);
+
+    expr = "sum(field(\"braid\"))";
+    res = eval.evaluate(expr);
+    EXPECT_NEAR(res["value"].to_float64(), sum, 1e-8);
+
+    expr = "avg(field(\"braid\"))";
+    res = eval.evaluate(expr);
+    EXPECT_NEAR(res["value"].to_float64(), sum / count, 1e-8);
+
+    // the histogram range comes from the same fused reduction
+    expr = "histogram(field(\"braid\"), num_bins=10)";
+    res = eval.evaluate(expr);
+    EXPECT_NEAR(res["attrs/min_val/value"].to_float64(), min_val, 1e-8);
+    EXPECT_NEAR(res["attrs/max_val/value"].to_float64(), max_val, 1e-8);
+
+    // shared reductions must not outlive the data they were computed on
+    runtime::expressions::ExpressionEval::begin_shared_reductions();
+    expr = "max(field(\"braid\")).value";
+    res = eval.evaluate(expr);
+    EXPECT_NEAR(res["value"].to_float64(), max_val, 1e-8);
+    runtime::expressions::ExpressionEval::end_shared_reductions();
+
+    for(index_t i = 0; i < braid.number_of_elements(); ++i)
+    {
+      braid[i] *= 2.0;
+    }
+    res = eval.evaluate(expr);
+    EXPECT_NEAR(res["value"].to_float64(), 2.0 * max_val, 1e-8);
+
+    // within a shared scope, reductions are kept per data key, so
+    // different data never sees another data set's reductions
+    Node other;
+    other.set(multi_dom);
+    float64_array other_braid = other.child(0)["fields/braid/values"].value();
+    for(index_t i = 0; i < other_braid.number_of_elements(); ++i)
+    {
+      other_braid[i] *= 2.0;
+    }
+
+    runtime::expressions::ExpressionEval eval_a(&multi_dom, "pipeline_a");
+    runtime::expressions::ExpressionEval eval_b(&other, "pipeline_b");
+    runtime::expressions::ExpressionEval::begin_shared_reductions();
+    res = eval_a.evaluate(expr);
+    EXPECT_NEAR(res["value"].to_float64(), 2.0 * max_val, 1e-8);
+    res = eval_b.evaluate(expr);
+    EXPECT_NEAR(res["value"].to_float64(), 4.0 * max_val, 1e-8);
+    res = eval_a.evaluate(expr);
+    EXPECT_NEAR(res["value"].to_float64(), 2.0 * max_val, 1e-8);
+    runtime::expressions::ExpressionEval::end_shared_reductions();
+}
+
 //-----------------------------------------------------------------------------
 
 int main(int argc, char* argv[])
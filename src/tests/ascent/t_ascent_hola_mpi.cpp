@@ -202,6 +202,217 @@ TEST(ascent_hola_mpi, test_hola_mpi_helpers)
         EXPECT_EQ(data.number_of_children(),9);
 }
 
+//-----------------------------------------------------------------------------
+TEST(ascent_hola_mpi, test_hola_mpi_isend)
+{
+    MPI_Comm comm = MPI_COMM_WORLD;
+
+    int rank = relay::mpi::rank(comm);
+    int total_size = relay::mpi::size(comm);
+    int rank_split = 5;
+    int src_size = rank_split;
+
+    Node my_maps;
+    my_maps["wts"] = DataType::int32(total_size);
+    my_maps["wtd"] = DataType::int32(total_size);
+
+    int32_array world_to_src  = my_maps["wts"].value();
+    int32_array world_to_dest = my_maps["wtd"].value();
+
+    for(int i=0;i<total_size;i++)
+    {
+        if(i < src_size)
+        {
+            world_to_dest[i] = -1;
+            world_to_src[i]  = i;
+        }
+        else
+        {
+            world_to_dest[i] = i - src_size;
+            world_to_src[i] = -1;
+        }
+    }
+
+    // cycle 0 sends schemas, cycle 1 reuses them,
+    // cycle 2 changes the schema
+    for(int cycle = 0; cycle < 3; cycle++)
+    {
+        Node data;
+        if(rank < src_size)
+        {
+            hola_mpi_helpers_test_setup_src_data(rank,data);
+            NodeIterator itr = data.children();
+            while(itr.has_next())
+            {
+                Node &payload = itr.next();
+                payload["src_local_domain_id"] =
+                    payload["src_local_domain_id"].to_int() + 10 * cycle;
+                if(cycle == 2)
+                {
+                    payload["cycle"] = cycle;
+                }
+            }
+        }
+
+        Node comm_map;
+        hola_mpi_comm_map(data,
+                          comm,
+                          world_to_src,
+                          world_to_dest,
+                          comm_map);
+
+        if(rank < src_size)
+        {
+            hola_mpi_isend(data,comm,rank,comm_map);
+            // the sends keep their own copy
+            data.reset();
+        }
+        else
+        {
+            int dest_idx = rank - rank_split;
+            hola_mpi_irecv(comm,dest_idx,comm_map,data);
+
+            if(rank == 5 || rank == 6)
+                EXPECT_EQ(data.number_of_children(),7);
+            if(rank == 7)
+                EXPECT_EQ(data.number_of_children(),9);
+
+            NodeIterator itr = data.children();
+            while(itr.has_next())
+            {
+                Node &payload = itr.next();
+                EXPECT_TRUE(payload["src_rank"].to_int() < src_size);
+                EXPECT_TRUE(payload["src_local_domain_id"].to_int()
+                            >= 10 * cycle);
+                EXPECT_TRUE(payload["src_local_domain_id"].to_int()
+                            < 10 * cycle + 5);
+                EXPECT_EQ(payload.has_child("cycle"), cycle == 2);
+            }
+        }
+    }
+
+    hola_mpi_wait();
+    MPI_Barrier(comm);
+}
+
+//-----------------------------------------------------------------------------
+TEST(ascent_hola_mpi, test_hola_mpi_balanced_comm_map)
+{
+    MPI_Comm comm = MPI_COMM_WORLD;
+
+    int rank = relay::mpi::rank(comm);
+    int total_size = relay::mpi::size(comm);
+    int rank_split = 5;
+    int src_size = rank_split;
+
+    Node my_maps;
+    my_maps["wts"] = DataType::int32(total_size);
+    my_maps["wtd"] = DataType::int32(total_size);
+
+    int32_array world_to_src  = my_maps["wts"].value();
+    int32_array world_to_dest = my_maps["wtd"].value();
+
+    for(int i=0;i<total_size;i++)
+    {
+        if(i < src_size)
+        {
+            world_to_dest[i] = -1;
+            world_to_src[i]  = i;
+        }
+        else
+        {
+            world_to_dest[i] = i - src_size;
+            world_to_src[i] = -1;
+        }
+    }
+
+    // rank 0's domains have far more cells than the others
+    Node data;
+    if(rank < src_size)
+    {
+        hola_mpi_helpers_test_setup_src_data(rank,data);
+        NodeIterator itr = data.children();
+        while(itr.has_next())
+        {
+            Node &dom = itr.next();
+            int dims = rank == 0 ? 65 : 9;
+            dom["coordsets/coords/type"] = "uniform";
+            dom["coordsets/coords/dims/i"] = dims;
+            dom["coordsets/coords/dims/j"] = dims;
+            dom["topologies/topo/type"] = "uniform";
+            dom["topologies/topo/coordset"] = "coords";
+        }
+    }
+
+    Node offset_map, balanced_map, info;
+    hola_mpi_comm_map(data,
+                      comm,
+                      world_to_src,
+                      world_to_dest,
+                      offset_map);
+
+    hola_mpi_balanced_comm_map(data,
+                               comm,
+                               world_to_src,
+                               world_to_dest,
+                               1.1,
+                               balanced_map);
+    hola_mpi_info(info);
+
+    if(rank == 0)
+    {
+        std::cout << "Balanced Hola MPI Comm Map:" << std::endl;
+        balanced_map.print();
+        info.print();
+    }
+
+    // same domains, ranges cover all of them
+    EXPECT_FALSE(balanced_map["src_counts"].diff(offset_map["src_counts"],
+                                                 info["diff"]));
+    int32_array dest_counts = balanced_map["dest_counts"].value();
+    int num_doms = 0;
+    for(int i=0; i < dest_counts.number_of_elements(); i++)
+    {
+        num_doms += dest_counts[i];
+    }
+    EXPECT_EQ(num_doms,23);
+
+    // the offset map sends all of rank 0's domains to the first dest
+    EXPECT_EQ(info["rebalanced"].as_string(),"true");
+    EXPECT_TRUE(info["cells/imbalance"].to_float64() < 2.0);
+    EXPECT_TRUE(dest_counts[0] < 5);
+
+    // unchanged inputs reuse the mapping
+    Node reused_map;
+    hola_mpi_balanced_comm_map(data,
+                               comm,
+                               world_to_src,
+                               world_to_dest,
+                               1.1,
+                               reused_map);
+    hola_mpi_info(info);
+    EXPECT_EQ(info["rebalanced"].as_string(),"false");
+    EXPECT_EQ(info["cycles_reused"].to_int(),1);
+    EXPECT_FALSE(reused_map["dest_counts"].diff(balanced_map["dest_counts"],
+                                                info["diff"]));
+
+    // the balanced map drives the same transfer
+    if(rank < src_size)
+    {
+        hola_mpi_isend(data,comm,rank,balanced_map);
+        hola_mpi_wait();
+    }
+    else
+    {
+        Node res;
+        int dest_idx = rank - rank_split;
+        hola_mpi_irecv(comm,dest_idx,balanced_map,res);
+        EXPECT_EQ(res.number_of_children(),dest_counts[dest_idx]);
+    }
+
+    MPI_Barrier(comm);
+}
+
 //-----------------------------------------------------------------------------
 TEST(ascent_hola_mpi, test_hola_mpi)
 {
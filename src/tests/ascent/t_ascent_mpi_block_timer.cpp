@@ -0,0 +1,160 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2015-2019, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-716457
+//
+// All rights reserved.
+//
+// This file is part of Ascent.
+//
+// For details, see: http://ascent.readthedocs.io/.
+//
+// Please also read ascent/LICENSE
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the disclaimer below.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the disclaimer (as noted below) in the
+//   documentation and/or other materials provided with the distribution.
+//
+// * Neither the name of the LLNS/LLNL nor the names of its contributors may
+//   be used to endorse or promote products derived from this software without
+//   specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL LAWRENCE LIVERMORE NATIONAL SECURITY,
+// LLC, THE U.S. DEPARTMENT OF ENERGY OR CONTRIBUTORS BE LIABLE FOR ANY
+// DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//-----------------------------------------------------------------------------
+///
+/// file: t_ascent_mpi_block_timer.cpp
+///
+//-----------------------------------------------------------------------------
+
+#include "gtest/gtest.h"
+
+#include <ascent.hpp>
+#include <ascent_block_timer.hpp>
+
+#include <iostream>
+#include <math.h>
+#include <mpi.h>
+
+#include "t_config.hpp"
+#include "t_utils.hpp"
+
+
+using namespace std;
+using namespace conduit;
+using namespace ascent;
+
+//-----------------------------------------------------------------------------
+TEST(ascent_mpi_block_timer, tree_reduction)
+{
+    int par_rank;
+    int par_size;
+    MPI_Comm comm = MPI_COMM_WORLD;
+    MPI_Comm_rank(comm, &par_rank);
+    MPI_Comm_size(comm, &par_size);
+
+    BlockTimer::SetMPICommHandle(MPI_Comm_c2f(comm));
+
+    for(int i = 0; i < 2; i++)
+    {
+        BlockTimer::StartTimer("outer");
+        // a location only one rank visits
+        if(par_rank == par_size - 1)
+        {
+            BlockTimer::StartTimer("last_rank_only");
+            BlockTimer::StopTimer("last_rank_only");
+        }
+        BlockTimer::StopTimer("outer");
+    }
+
+    Node &res = BlockTimer::Finalize();
+
+    if(par_rank == 0)
+    {
+        res.print();
+
+        const Node &outer = res["children/outer"];
+        EXPECT_EQ(outer["ranks"].to_uint32(), (uint32)par_size);
+        // per rank calls
+        EXPECT_EQ(outer["count"].to_uint32(), 2u);
+        EXPECT_GE(outer["value"].to_float64(), outer["avg"].to_float64());
+        EXPECT_GE(outer["avg"].to_float64(), outer["min"].to_float64());
+
+        EXPECT_TRUE(res.has_path("children/outer/children/last_rank_only"));
+        const Node &last = res["children/outer/children/last_rank_only"];
+        EXPECT_EQ(last["ranks"].to_uint32(), 1u);
+        EXPECT_EQ(last["count"].to_uint32(), 2u);
+        EXPECT_EQ(last["id"].to_int32(), par_size - 1);
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEST(ascent_mpi_block_timer, binary_log)
+{
+    int par_rank;
+    int par_size;
+    MPI_Comm comm = MPI_COMM_WORLD;
+    MPI_Comm_rank(comm, &par_rank);
+    MPI_Comm_size(comm, &par_size);
+
+    if(par_rank == 0 && conduit::utils::is_file("ascent_log.bin"))
+    {
+        conduit::utils::remove_file("ascent_log.bin");
+    }
+
+    EXPECT_THROW(BlockTimer::WriteLogFile("bad_protocol"), conduit::Error);
+
+    BlockTimer::WriteLogFile("conduit_bin");
+
+    if(par_rank == 0)
+    {
+        EXPECT_TRUE(conduit::utils::is_file("ascent_log.bin"));
+        Node log;
+        log.load("ascent_log.bin", "conduit_bin");
+        EXPECT_TRUE(log.has_path("children/outer/avg"));
+
+        // the tree_reduction test already called Finalize, the timings
+        // must not be reduced a second time
+        const Node &outer = log["children/outer"];
+        EXPECT_EQ(outer["ranks"].to_uint32(), (uint32)par_size);
+        EXPECT_EQ(outer["count"].to_uint32(), 2u);
+
+        const Node &last = log["children/outer/children/last_rank_only"];
+        EXPECT_EQ(last["ranks"].to_uint32(), 1u);
+        EXPECT_EQ(last["count"].to_uint32(), 2u);
+    }
+}
+
+//-----------------------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+    int result = 0;
+
+    ::testing::InitGoogleTest(&argc, argv);
+    MPI_Init(&argc, &argv);
+    result = RUN_ALL_TESTS();
+    MPI_Finalize();
+
+    return result;
+}
@@ -57,6 +57,7 @@
 #include <mpi.h>
 
 #include <conduit_blueprint.hpp>
+#include <conduit_relay.hpp>
 
 #include "t_config.hpp"
 #include "t_utils.hpp"
@@ -313,6 +314,211 @@ TEST(ascent_mpi_runtime, test_relay_extract_mesh)
 
 }
 
+//-----------------------------------------------------------------------------
+TEST(ascent_mpi_runtime, test_relay_extract_mesh_aggregated)
+{
+
+    //
+    // Set Up MPI
+    //
+    int par_rank;
+    int par_size;
+    MPI_Comm comm = MPI_COMM_WORLD;
+    MPI_Comm_rank(comm, &par_rank);
+    MPI_Comm_size(comm, &par_size);
+
+    //
+    // Create the data.
+    //
+    Node data, verify_info;
+    create_3d_example_dataset(data,32,par_rank,par_size);
+    data["state/cycle"] = 102;
+
+    EXPECT_TRUE(conduit::blueprint::mesh::verify(data,verify_info));
+
+    // make sure the _output dir exists
+    string output_path = "";
+    if(par_rank == 0)
+    {
+        output_path = prepare_output_dir();
+    }
+    else
+    {
+        output_path = output_dir();
+    }
+
+    string output_file = conduit::utils::join_file_path(output_path,"tout_hd5f_mesh_aggregated");
+    string output_root = output_file + ".cycle_000102.root";
+    if(par_rank == 0 && conduit::utils::is_file(output_root))
+    {
+        conduit::utils::remove_file(output_root);
+    }
+    //
+    // Create the actions.
+    //
+
+    // at most two files, regardless of the number of ranks
+    const int num_files = par_size > 1 ? 2 : 1;
+
+    conduit::Node extracts;
+    extracts["e1/type"]  = "relay";
+
+    extracts["e1/params/path"] = output_file;
+    extracts["e1/params/protocol"] = "blueprint/mesh/hdf5";
+    extracts["e1/params/num_files"] = num_files;
+
+    conduit::Node actions;
+    // add the extracts
+    conduit::Node &add_extracts = actions.append();
+    add_extracts["action"] = "add_extracts";
+    add_extracts["extracts"] = extracts;
+
+    //
+    // Run Ascent
+    //
+
+    Ascent ascent;
+
+    Node ascent_opts;
+    ascent_opts["mpi_comm"] = MPI_Comm_c2f(comm);
+    ascent_opts["runtime"] = "ascent";
+    ascent.open(ascent_opts);
+    ascent.publish(data);
+    ascent.execute(actions);
+    ascent.close();
+
+    MPI_Barrier(comm);
+
+    if(par_rank == 0)
+    {
+        EXPECT_TRUE(conduit::utils::is_file(output_root));
+
+        Node root;
+        conduit::relay::io::load(output_root, "hdf5", root);
+        EXPECT_EQ(root["number_of_files"].to_int32(), num_files);
+        EXPECT_EQ(root["number_of_trees"].to_int32(), par_size);
+        EXPECT_EQ(root["tree_pattern"].as_string(), "domain_%06d");
+
+        // every domain is a tree of the file listed in the map
+        int32_array domain_to_file = root["domain_to_file"].value();
+        EXPECT_EQ(domain_to_file.number_of_elements(), par_size);
+        for(int d = 0; d < par_size; ++d)
+        {
+            char fmt_buff[64];
+            snprintf(fmt_buff, sizeof(fmt_buff), "%06d", domain_to_file[d]);
+            std::string file = output_file + ".cycle_000102/file_"
+                               + std::string(fmt_buff) + ".hdf5";
+            EXPECT_TRUE(conduit::utils::is_file(file));
+
+            Node domain;
+            snprintf(fmt_buff, sizeof(fmt_buff), "%06d", d);
+            conduit::relay::io::load(file + ":domain_" + std::string(fmt_buff),
+                                     "hdf5",
+                                     domain);
+            EXPECT_TRUE(conduit::blueprint::mesh::verify(domain,verify_info));
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEST(ascent_mpi_runtime, test_relay_extract_mesh_async)
+{
+
+    //
+    // Set Up MPI
+    //
+    int par_rank;
+    int par_size;
+    MPI_Comm comm = MPI_COMM_WORLD;
+    MPI_Comm_rank(comm, &par_rank);
+    MPI_Comm_size(comm, &par_size);
+
+    //
+    // Create the data.
+    //
+    Node data, verify_info;
+    create_3d_example_dataset(data,32,par_rank,par_size);
+    data["state/cycle"] = 103;
+
+    EXPECT_TRUE(conduit::blueprint::mesh::verify(data,verify_info));
+
+    // make sure the _output dir exists
+    string output_path = "";
+    if(par_rank == 0)
+    {
+        output_path = prepare_output_dir();
+    }
+    else
+    {
+        output_path = output_dir();
+    }
+
+    string output_file = conduit::utils::join_file_path(output_path,"tout_hd5f_mesh_async");
+    string output_root = output_file + ".cycle_000103.root";
+    if(par_rank == 0 && conduit::utils::is_file(output_root))
+    {
+        conduit::utils::remove_file(output_root);
+    }
+    //
+    // Create the actions.
+    //
+
+    conduit::Node extracts;
+    extracts["e1/type"]  = "relay";
+
+    extracts["e1/params/path"] = output_file;
+    extracts["e1/params/protocol"] = "blueprint/mesh/hdf5";
+    extracts["e1/params/async"] = "true";
+
+    conduit::Node actions;
+    // add the extracts
+    conduit::Node &add_extracts = actions.append();
+    add_extracts["action"] = "add_extracts";
+    add_extracts["extracts"] = extracts;
+
+    //
+    // Run Ascent
+    //
+
+    Ascent ascent;
+
+    Node ascent_opts;
+    ascent_opts["mpi_comm"] = MPI_Comm_c2f(comm);
+    ascent_opts["runtime"] = "ascent";
+    ascent_opts["relay/async_queue_depth"] = 1;
+    ascent.open(ascent_opts);
+    ascent.publish(data);
+    ascent.execute(actions);
+
+    // the extract saved a snapshot, so the simulation can move on
+    float64_array rank_ele = data["fields/rank_ele/values"].value();
+    for(index_t i = 0; i < rank_ele.number_of_elements(); ++i)
+    {
+        rank_ele[i] = -1.0;
+    }
+
+    // close waits for the background writes
+    ascent.close();
+
+    MPI_Barrier(comm);
+
+    char fmt_buff[64];
+    snprintf(fmt_buff, sizeof(fmt_buff), "%06d", par_rank);
+    std::string domain_file = output_file + ".cycle_000103/domain_"
+                              + std::string(fmt_buff) + ".hdf5";
+    EXPECT_TRUE(conduit::utils::is_file(domain_file));
+
+    Node domain;
+    conduit::relay::io::load(domain_file, "hdf5", domain);
+    float64_array saved = domain["fields/rank_ele/values"].value();
+    EXPECT_EQ(saved[0], (float64)par_rank);
+
+    if(par_rank == 0)
+    {
+        EXPECT_TRUE(conduit::utils::is_file(output_root));
+    }
+}
+
 //-----------------------------------------------------------------------------
 TEST(ascent_mpi_runtime, test_relay_partially_empty)
 {
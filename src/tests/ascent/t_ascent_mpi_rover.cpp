@@ -0,0 +1,260 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2015-2019, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-716457
+//
+// All rights reserved.
+//
+// This file is part of Ascent.
+//
+// For details, see: http://ascent.readthedocs.io/.
+//
+// Please also read ascent/LICENSE
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the disclaimer below.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the disclaimer (as noted below) in the
+//   documentation and/or other materials provided with the distribution.
+//
+// * Neither the name of the LLNS/LLNL nor the names of its contributors may
+//   be used to endorse or promote products derived from this software without
+//   specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL LAWRENCE LIVERMORE NATIONAL SECURITY,
+// LLC, THE U.S. DEPARTMENT OF ENERGY OR CONTRIBUTORS BE LIABLE FOR ANY
+// DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//-----------------------------------------------------------------------------
+///
+/// file: t_ascent_mpi_rover.cpp
+///
+//-----------------------------------------------------------------------------
+
+#include "gtest/gtest.h"
+
+#include <ascent.hpp>
+#include <iostream>
+#include <math.h>
+
+
+#include <mpi.h>
+
+#include <conduit_blueprint.hpp>
+
+#include "t_config.hpp"
+#include "t_utils.hpp"
+
+using namespace std;
+using namespace conduit;
+using namespace ascent;
+
+//-----------------------------------------------------------------------------
+void
+render_volume(const Node &data,
+              const std::string &scheduler,
+              const std::string &output_file,
+              MPI_Comm comm)
+{
+    conduit::Node extracts;
+    extracts["e1/type"]  = "volume";
+    extracts["e1/params/field"] = "radial_vert";
+    extracts["e1/params/filename"] = output_file;
+    extracts["e1/params/scheduler"] = scheduler;
+
+    conduit::Node actions;
+    conduit::Node &add_extracts = actions.append();
+    add_extracts["action"] = "add_extracts";
+    add_extracts["extracts"] = extracts;
+
+    Ascent ascent;
+
+    Node ascent_opts;
+    ascent_opts["mpi_comm"] = MPI_Comm_c2f(comm);
+    ascent_opts["runtime"] = "ascent";
+    ascent.open(ascent_opts);
+    ascent.publish(data);
+    ascent.execute(actions);
+    ascent.close();
+}
+
+//-----------------------------------------------------------------------------
+TEST(ascent_mpi_rover, mpi_volume_static_scheduler)
+{
+    // the vtkm runtime is currently our only rendering runtime
+    Node n;
+    ascent::about(n);
+    // only run this test if ascent was built with vtkm support
+    if(n["runtimes/ascent/vtkm/status"].as_string() == "disabled")
+    {
+        ASCENT_INFO("Ascent vtkm support disabled, skipping test");
+        return;
+    }
+
+    //
+    // Set Up MPI
+    //
+    int par_rank;
+    int par_size;
+    MPI_Comm comm = MPI_COMM_WORLD;
+    MPI_Comm_rank(comm, &par_rank);
+    MPI_Comm_size(comm, &par_size);
+
+    EXPECT_GE(par_size, 2);
+
+    //
+    // Create the data, each rank owns a slab of the mesh.
+    //
+    Node data, verify_info;
+    create_3d_example_dataset(data,16,par_rank,par_size);
+    conduit::blueprint::mesh::verify(data,verify_info);
+
+    // make sure the _output dir exists
+    string output_path = "";
+    if(par_rank == 0)
+    {
+        output_path = prepare_output_dir();
+    }
+    else
+    {
+        output_path = output_dir();
+    }
+
+    string composite_file = conduit::utils::join_file_path(output_path,
+                                                           "tout_rover_mpi_volume_composite");
+    string static_file = conduit::utils::join_file_path(output_path,
+                                                        "tout_rover_mpi_volume_static");
+
+    if(par_rank == 0)
+    {
+        // remove old images before rendering
+        remove_test_image(composite_file);
+        remove_test_image(static_file);
+    }
+    MPI_Barrier(comm);
+
+    // the static scheduler exchanges rays between the ranks whose
+    // footprints overlap, the result has to match the default compositor
+    render_volume(data, "composite", composite_file, comm);
+    render_volume(data, "static", static_file, comm);
+
+    MPI_Barrier(comm);
+    if(par_rank == 0)
+    {
+        Node info;
+        ascent::PNGCompare compare;
+        bool res = compare.Compare(static_file + "100.png",
+                                   composite_file + "100.png",
+                                   info,
+                                   0.001f);
+        if(!res)
+        {
+          info.print();
+        }
+        EXPECT_TRUE(res);
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEST(ascent_mpi_rover, mpi_volume_static_scheduler_rank_without_data)
+{
+    // the vtkm runtime is currently our only rendering runtime
+    Node n;
+    ascent::about(n);
+    // only run this test if ascent was built with vtkm support
+    if(n["runtimes/ascent/vtkm/status"].as_string() == "disabled")
+    {
+        ASCENT_INFO("Ascent vtkm support disabled, skipping test");
+        return;
+    }
+
+    //
+    // Set Up MPI
+    //
+    int par_rank;
+    int par_size;
+    MPI_Comm comm = MPI_COMM_WORLD;
+    MPI_Comm_rank(comm, &par_rank);
+    MPI_Comm_size(comm, &par_size);
+
+    //
+    // Create the data, the last rank has nothing to trace
+    //
+    Node data, verify_info;
+    create_3d_example_dataset(data,16,par_rank,par_size);
+    if(par_rank == par_size - 1)
+    {
+        data.reset();
+    }
+
+    string output_path = "";
+    if(par_rank == 0)
+    {
+        output_path = prepare_output_dir();
+    }
+    else
+    {
+        output_path = output_dir();
+    }
+
+    string composite_file = conduit::utils::join_file_path(output_path,
+                                                           "tout_rover_mpi_volume_empty_composite");
+    string static_file = conduit::utils::join_file_path(output_path,
+                                                        "tout_rover_mpi_volume_empty_static");
+
+    if(par_rank == 0)
+    {
+        remove_test_image(composite_file);
+        remove_test_image(static_file);
+    }
+    MPI_Barrier(comm);
+
+    render_volume(data, "composite", composite_file, comm);
+    render_volume(data, "static", static_file, comm);
+
+    MPI_Barrier(comm);
+    if(par_rank == 0)
+    {
+        Node info;
+        ascent::PNGCompare compare;
+        bool res = compare.Compare(static_file + "100.png",
+                                   composite_file + "100.png",
+                                   info,
+                                   0.001f);
+        if(!res)
+        {
+          info.print();
+        }
+        EXPECT_TRUE(res);
+    }
+}
+
+//-----------------------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+    int result = 0;
+
+    ::testing::InitGoogleTest(&argc, argv);
+    MPI_Init(&argc, &argv);
+    result = RUN_ALL_TESTS();
+    MPI_Finalize();
+
+    return result;
+}
@@ -157,6 +157,126 @@ TEST(ascent_pipelines_to_pipelines, test_pipelines_to_pipelines)
     std::string msg = "An example of the interconnecting pipelines.";
     ASCENT_ACTIONS_DUMP(actions,output_file,msg);
 }
+
+//-----------------------------------------------------------------------------
+TEST(ascent_pipelines_to_pipelines, test_shared_pipeline_prefix)
+{
+    Node n;
+    ascent::about(n);
+    // only run this test if ascent was built with vtkm support
+    if(n["runtimes/ascent/vtkm/status"].as_string() == "disabled")
+    {
+        ASCENT_INFO("Ascent vtkm support disabled, skipping test");
+        return;
+    }
+
+    //
+    // Create an example mesh.
+    //
+    Node data, verify_info;
+    conduit::blueprint::mesh::examples::braid("hexs",
+                                              EXAMPLE_MESH_SIDE_DIM,
+                                              EXAMPLE_MESH_SIDE_DIM,
+                                              EXAMPLE_MESH_SIDE_DIM,
+                                              data);
+    EXPECT_TRUE(conduit::blueprint::mesh::verify(data,verify_info));
+
+    ASCENT_INFO("Testing pipelines that share their first filters");
+
+    string output_path = prepare_output_dir();
+    string output_file = conduit::utils::join_file_path(output_path,
+                                                        "tout_shared_pipeline_prefix");
+
+    // remove old images before rendering
+    remove_test_image(output_file);
+
+    //
+    // Create the actions.
+    //
+
+    conduit::Node pipelines;
+    // pl1 and pl2 start with the same filter, pl3 repeats pl1
+    pipelines["pl1/f1/type"] = "vector_magnitude";
+    pipelines["pl1/f1/params/field"] = "vel";
+    pipelines["pl1/f1/params/output_name"] = "mag";
+    pipelines["pl1/f2/type"] = "log";
+    pipelines["pl1/f2/params/field"] = "mag";
+    pipelines["pl1/f2/params/output_name"] = "log_mag";
+
+    pipelines["pl2/f1"] = pipelines["pl1/f1"];
+    pipelines["pl2/f2/type"] = "log";
+    pipelines["pl2/f2/params/field"] = "mag";
+    pipelines["pl2/f2/params/output_name"] = "log_mag_2";
+
+    pipelines["pl3"] = pipelines["pl1"];
+
+    conduit::Node scenes;
+    scenes["s1/plots/p1/type"]     = "pseudocolor";
+    scenes["s1/plots/p1/field"]    = "log_mag";
+    scenes["s1/plots/p1/pipeline"] = "pl3";
+    scenes["s1/image_prefix"] = output_file;
+
+    conduit::Node extracts;
+    extracts["e1/type"] = "relay";
+    extracts["e1/pipeline"] = "pl2";
+    extracts["e1/params/path"] = conduit::utils::join_file_path(output_path,
+                                                                "tout_shared_pipeline_prefix_pl2");
+
+    conduit::Node actions;
+    // add the pipeline
+    conduit::Node &add_pipelines = actions.append();
+    add_pipelines["action"] = "add_pipelines";
+    add_pipelines["pipelines"] = pipelines;
+    // add the scenes
+    conduit::Node &add_scenes= actions.append();
+    add_scenes["action"] = "add_scenes";
+    add_scenes["scenes"] = scenes;
+    // add the extracts
+    conduit::Node &add_extracts= actions.append();
+    add_extracts["action"] = "add_extracts";
+    add_extracts["extracts"] = extracts;
+
+    //
+    // Run Ascent
+    //
+
+    Ascent ascent;
+
+    Node ascent_opts;
+    ascent_opts["runtime/type"] = "ascent";
+    ascent.open(ascent_opts);
+    ascent.publish(data);
+    ascent.execute(actions);
+
+    Node info;
+    ascent.info(info);
+    ascent.close();
+
+    // one vector magnitude for all three pipelines,
+    // and one log for pl1 and pl3
+    int num_mags = 0;
+    int num_logs = 0;
+    NodeIterator itr = info["flow_graph/graph/filters"].children();
+    while(itr.has_next())
+    {
+        const Node &filter = itr.next();
+        const std::string type_name = filter["type_name"].as_string();
+        if(type_name.find("vector_magnitude") != std::string::npos)
+        {
+          num_mags++;
+        }
+        else if(type_name.find("log") != std::string::npos)
+        {
+          num_logs++;
+        }
+    }
+    EXPECT_EQ(num_mags, 1);
+    EXPECT_EQ(num_logs, 2);
+
+    // the plot of the shared chain rendered
+    EXPECT_EQ(info["images"].number_of_children(), 1);
+}
+
 //-----------------------------------------------------------------------------
 int main(int argc, char* argv[])
 {
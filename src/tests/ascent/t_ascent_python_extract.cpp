@@ -355,3 +355,82 @@ TEST(ascent_runtime, test_python_extract_inception)
 
 }
 
+
+// read-only views of the mesh arrays that share the published memory
+std::string py_script_mesh_views = "\n"
+"import numpy as np\n"
+"from ascent import mesh_views\n"
+"views = mesh_views(ascent_data())\n"
+"assert len(views) == ascent_data().number_of_children()\n"
+"dom  = ascent_data().child(0)\n"
+"vals = views[0]['fields']['radial_vert']\n"
+"assert not vals.flags.writeable\n"
+"assert np.shares_memory(vals, dom['fields/radial_vert/values'])\n"
+"x = views[0]['coordsets']['coords']['x']\n"
+"assert np.shares_memory(x, dom['coordsets/coords/values/x'])\n"
+"\n";
+
+//-----------------------------------------------------------------------------
+TEST(ascent_runtime, test_python_extract_mesh_views)
+{
+    //
+    // Create the data.
+    //
+    Node data, verify_info;
+    create_3d_example_dataset(data,32,0,1);
+    data["state/cycle"] = 101;
+
+    EXPECT_TRUE(conduit::blueprint::mesh::verify(data,verify_info));
+    verify_info.print();
+
+    //
+    // Create the actions.
+    //
+
+    conduit::Node extracts;
+    extracts["e1/type"]  = "python";
+    extracts["e1/params/source"] = py_script_mesh_views;
+
+    // the same views of a pipeline output
+    conduit::Node pipelines;
+    pipelines["pl1/f1/type"] = "contour";
+    pipelines["pl1/f1/params/field"] = "radial_vert";
+    pipelines["pl1/f1/params/iso_values"] = 10.0;
+
+    extracts["e2/type"]  = "python";
+    extracts["e2/pipeline"]  = "pl1";
+    extracts["e2/params/source"] = "\n"
+        "from ascent import mesh_views\n"
+        "for dom in mesh_views(ascent_data()):\n"
+        "    for name, topo in dom['topologies'].items():\n"
+        "        assert not topo['connectivity'].flags.writeable\n"
+        "\n";
+
+    conduit::Node actions;
+    conduit::Node &add_pipelines = actions.append();
+    add_pipelines["action"] = "add_pipelines";
+    add_pipelines["pipelines"] = pipelines;
+    // add the extracts
+    conduit::Node &add_extracts = actions.append();
+    add_extracts["action"] = "add_extracts";
+    add_extracts["extracts"] = extracts;
+
+    actions.print();
+
+    //
+    // Run Ascent
+    //
+
+    Node ascent_opts;
+    ascent_opts["ascent_info"] = "verbose";
+    ascent_opts["exceptions"] = "forward";
+
+    Ascent ascent;
+    ascent.open(ascent_opts);
+    ascent.publish(data);
+    // twice, the views are made again for each execute
+    ascent.execute(actions);
+    ascent.execute(actions);
+    ascent.close();
+
+}
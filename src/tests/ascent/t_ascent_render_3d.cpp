@@ -54,6 +54,9 @@
 #include <ascent.hpp>
 
 #include <iostream>
+#include <fstream>
+#include <iterator>
+#include <sstream>
 #include <math.h>
 
 #include <conduit_blueprint.hpp>
@@ -2051,6 +2054,294 @@ TEST(ascent_render_3d, test_render_3d_supported_conn_dtypes)
     ascent.close();
 }
 
+//-----------------------------------------------------------------------------
+TEST(ascent_render_3d, test_render_3d_image_channel)
+{
+    // the ascent runtime is currently our only rendering runtime
+    Node n;
+    ascent::about(n);
+    // only run this test if ascent was built with vtkm support
+    if(n["runtimes/ascent/vtkm/status"].as_string() == "disabled")
+    {
+        ASCENT_INFO("Ascent support disabled, skipping 3D default"
+                      "Pipeline test");
+
+        return;
+    }
+
+    //
+    // Create an example mesh.
+    //
+    Node data, verify_info;
+    conduit::blueprint::mesh::examples::braid("hexs",
+                                              EXAMPLE_MESH_SIDE_DIM,
+                                              EXAMPLE_MESH_SIDE_DIM,
+                                              EXAMPLE_MESH_SIDE_DIM,
+                                              data);
+
+    EXPECT_TRUE(conduit::blueprint::mesh::verify(data,verify_info));
+
+    ASCENT_INFO("Testing 3D Rendering with the image channel");
+
+    string output_path = prepare_output_dir();
+    string output_file = conduit::utils::join_file_path(output_path,"tout_render_3d_image_channel");
+
+    // remove old images before rendering
+    remove_test_image(output_file);
+
+    //
+    // Create the actions.
+    //
+
+    conduit::Node scenes;
+    scenes["s1/plots/p1/type"]  = "pseudocolor";
+    scenes["s1/plots/p1/field"] = "braid";
+    scenes["s1/image_prefix"]   = output_file;
+
+    conduit::Node actions;
+    conduit::Node &add_plots = actions.append();
+    add_plots["action"] = "add_scenes";
+    add_plots["scenes"] = scenes;
+
+    //
+    // Run Ascent
+    //
+
+    Ascent ascent;
+
+    Node ascent_opts;
+    ascent_opts["runtime/type"] = "ascent";
+    ascent_opts["image_channel/enabled"] = "true";
+    ascent.open(ascent_opts);
+    ascent.publish(data);
+    ascent.execute(actions);
+
+    Node info;
+    ascent.info(info);
+
+    // check that we created an image
+    EXPECT_TRUE(check_test_image(output_file));
+
+    // the info refers to the png encoded by the renderer, which
+    // stays valid until the next execute or close
+    EXPECT_EQ(info["images"].number_of_children(), 1);
+    const Node &image = info["images"].child(0);
+    EXPECT_TRUE(image.has_child("cycle"));
+    EXPECT_TRUE(image.has_child("png"));
+    EXPECT_TRUE(image["png"].is_data_external());
+    EXPECT_TRUE(image["png"].dtype().number_of_elements() > 8);
+
+    const uint8 *png = image["png"].as_uint8_ptr();
+    EXPECT_EQ(png[0], 0x89);
+    EXPECT_EQ(png[1], 'P');
+    EXPECT_EQ(png[2], 'N');
+    EXPECT_EQ(png[3], 'G');
+
+    // the image is encoded once, the channel holds the bytes written
+    // to the file
+    std::ifstream ifs((output_file + ".png").c_str(), std::ios::binary);
+    std::string file_bytes((std::istreambuf_iterator<char>(ifs)),
+                           std::istreambuf_iterator<char>());
+    EXPECT_EQ(file_bytes.size(),
+              (size_t)image["png"].dtype().number_of_elements());
+    EXPECT_EQ(file_bytes.compare(0,
+                                 file_bytes.size(),
+                                 (const char*)png,
+                                 file_bytes.size()), 0);
+
+    ascent.close();
+}
+
+//-----------------------------------------------------------------------------
+TEST(ascent_render_3d, test_render_3d_schedule)
+{
+    // the ascent runtime is currently our only rendering runtime
+    Node n;
+    ascent::about(n);
+    // only run this test if ascent was built with vtkm support
+    if(n["runtimes/ascent/vtkm/status"].as_string() == "disabled")
+    {
+        ASCENT_INFO("Ascent support disabled, skipping 3D default"
+                      "Pipeline test");
+
+        return;
+    }
+
+    //
+    // Create an example mesh.
+    //
+    Node data, verify_info;
+    conduit::blueprint::mesh::examples::braid("hexs",
+                                              EXAMPLE_MESH_SIDE_DIM,
+                                              EXAMPLE_MESH_SIDE_DIM,
+                                              EXAMPLE_MESH_SIDE_DIM,
+                                              data);
+
+    EXPECT_TRUE(conduit::blueprint::mesh::verify(data,verify_info));
+
+    ASCENT_INFO("Testing 3D Rendering with a schedule budget");
+
+    string output_path = prepare_output_dir();
+    string output_file = conduit::utils::join_file_path(output_path,"tout_render_3d_schedule");
+
+    //
+    // Create the actions.
+    //
+
+    conduit::Node scenes;
+    scenes["s1/plots/p1/type"]  = "pseudocolor";
+    scenes["s1/plots/p1/field"] = "braid";
+    scenes["s1/image_prefix"]   = output_file + "_s1";
+    scenes["s1/schedule/priority"] = 1;
+    scenes["s2/plots/p1/type"]  = "pseudocolor";
+    scenes["s2/plots/p1/field"] = "radial";
+    scenes["s2/image_prefix"]   = output_file + "_s2";
+    scenes["s2/schedule/min_frequency"] = 2;
+
+    // queries are never skipped
+    conduit::Node queries;
+    queries["q1/params/expression"] = "max(field(\"braid\"))";
+    queries["q1/params/name"] = "max_braid";
+
+    conduit::Node actions;
+    conduit::Node &add_queries = actions.append();
+    add_queries["action"] = "add_queries";
+    add_queries["queries"] = queries;
+    conduit::Node &add_plots = actions.append();
+    add_plots["action"] = "add_scenes";
+    add_plots["scenes"] = scenes;
+
+    //
+    // Run Ascent
+    //
+
+    Ascent ascent;
+
+    Node ascent_opts;
+    ascent_opts["runtime/type"] = "ascent";
+    // too small for any scene, once their costs are known
+    ascent_opts["schedule/budget"] = 1e-9;
+    ascent.open(ascent_opts);
+
+    Node info;
+    std::vector<std::string> s1_status, s2_status;
+    for(int i = 0; i < 3; ++i)
+    {
+        data["state/cycle"] = i;
+        ascent.publish(data);
+        ascent.execute(actions);
+        ascent.info(info);
+        EXPECT_TRUE(info.has_path("schedule/summary/budget"));
+        s1_status.push_back(info["schedule/scenes/s1/status"].as_string());
+        s2_status.push_back(info["schedule/scenes/s2/status"].as_string());
+
+        // skipped scenes stay in the graph
+        EXPECT_TRUE(info["flow_graph/graph/filters"].has_child("exec_s1"));
+        EXPECT_TRUE(info["flow_graph/graph/filters"].has_child("exec_s2"));
+        std::ostringstream query_path;
+        query_path << "expressions/max_braid/" << i;
+        EXPECT_TRUE(info.has_path(query_path.str()));
+    }
+    ascent.close();
+
+    // everything runs until its cost is measured
+    EXPECT_EQ(s1_status[0], "run");
+    EXPECT_EQ(s2_status[0], "run");
+    // then nothing fits
+    EXPECT_EQ(s1_status[1], "skipped");
+    EXPECT_EQ(s2_status[1], "skipped");
+    // except what reached its min frequency
+    EXPECT_EQ(s1_status[2], "skipped");
+    EXPECT_EQ(s2_status[2], "run");
+    EXPECT_EQ(info["images"].number_of_children(), 1);
+}
+
+//-----------------------------------------------------------------------------
+TEST(ascent_render_3d, test_render_3d_persistent_renderers)
+{
+    // the ascent runtime is currently our only rendering runtime
+    Node n;
+    ascent::about(n);
+    // only run this test if ascent was built with vtkm support
+    if(n["runtimes/ascent/vtkm/status"].as_string() == "disabled")
+    {
+        ASCENT_INFO("Ascent support disabled, skipping 3D default"
+                      "Pipeline test");
+
+        return;
+    }
+
+    //
+    // Create an example mesh.
+    //
+    Node data, verify_info;
+    conduit::blueprint::mesh::examples::braid("hexs",
+                                              EXAMPLE_MESH_SIDE_DIM,
+                                              EXAMPLE_MESH_SIDE_DIM,
+                                              EXAMPLE_MESH_SIDE_DIM,
+                                              data);
+
+    EXPECT_TRUE(conduit::blueprint::mesh::verify(data,verify_info));
+
+    ASCENT_INFO("Testing 3D Rendering with persistent renderers");
+
+    string output_path = prepare_output_dir();
+    string output_file = conduit::utils::join_file_path(output_path,"tout_render_3d_persistent");
+
+    //
+    // Create the actions.
+    //
+
+    conduit::Node scenes;
+    scenes["s1/plots/p1/type"]  = "pseudocolor";
+    scenes["s1/plots/p1/field"] = "braid";
+    scenes["s1/image_prefix"]   = output_file;
+
+    conduit::Node actions;
+    conduit::Node &add_plots = actions.append();
+    add_plots["action"] = "add_scenes";
+    add_plots["scenes"] = scenes;
+
+    //
+    // Run Ascent
+    //
+
+    Ascent ascent;
+
+    Node ascent_opts;
+    ascent_opts["runtime/type"] = "ascent";
+    ascent.open(ascent_opts);
+
+    Node info;
+    std::vector<std::string> status;
+    for(int i = 0; i < 3; ++i)
+    {
+        if(i == 2)
+        {
+            // changed plot params rebuild the renderer
+            actions.child(0)["scenes/s1/plots/p1/color_table/name"] = "Jet";
+        }
+        ascent.publish(data);
+        ascent.execute(actions);
+        ascent.info(info);
+        status.push_back(info["renderers/p1_s1/status"].as_string());
+    }
+
+    EXPECT_EQ(status[0], "created");
+    EXPECT_EQ(status[1], "reused");
+    EXPECT_EQ(status[2], "rebuilt");
+    EXPECT_EQ(info["renderers/p1_s1/reuse_count"].to_int(), 0);
+    EXPECT_EQ(info["images"].number_of_children(), 1);
+
+    // plots that are no longer in the actions release their renderer
+    conduit::Node no_scenes;
+    ascent.publish(data);
+    ascent.execute(no_scenes);
+    ascent.info(info);
+    EXPECT_FALSE(info.has_path("renderers"));
+    ascent.close();
+}
+
 
 
 //-----------------------------------------------------------------------------
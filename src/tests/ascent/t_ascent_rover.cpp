@@ -284,3 +284,268 @@ TEST(ascent_rover, test_volume_serial)
     std::string msg = "An example of using the volume (unstructured grid) extract.";
     ASCENT_ACTIONS_DUMP(actions,output_file,msg);
 }
+
+//-----------------------------------------------------------------------------
+TEST(ascent_rover, test_volume_static_scheduler)
+{
+    // the vtkm runtime is currently our only rendering runtime
+    Node n;
+    ascent::about(n);
+    // only run this test if ascent was built with vtkm support
+    if(n["runtimes/ascent/vtkm/status"].as_string() == "disabled")
+    {
+        ASCENT_INFO("Ascent support disabled, skipping test");
+        return;
+    }
+
+    //
+    // Create an example mesh.
+    //
+    Node data, verify_info;
+    conduit::blueprint::mesh::examples::braid("hexs",
+                                              EXAMPLE_MESH_SIDE_DIM,
+                                              EXAMPLE_MESH_SIDE_DIM,
+                                              EXAMPLE_MESH_SIDE_DIM,
+                                              data);
+
+    EXPECT_TRUE(conduit::blueprint::mesh::verify(data,verify_info));
+
+    ASCENT_INFO("Testing volume_extract with the static scheduler");
+
+
+    string output_path = prepare_output_dir();
+    string output_file = conduit::utils::join_file_path(output_path,"tout_rover_volume_static");
+    string composite_file = conduit::utils::join_file_path(output_path,
+                                                           "tout_rover_volume_static_composite");
+
+    // remove old images before rendering
+    remove_test_image(output_file);
+    remove_test_image(composite_file);
+
+
+    //
+    // Create the actions.
+    //
+
+    conduit::Node extracts;
+    extracts["e1/type"]  = "volume";
+    // populate some param examples
+    extracts["e1/params/field"] = "radial";
+    extracts["e1/params/filename"] = output_file;
+    extracts["e1/params/scheduler"] = "static";
+
+    conduit::Node actions;
+    // add the pipeline
+    conduit::Node &add_extracts = actions.append();
+    add_extracts["action"] = "add_extracts";
+    add_extracts["extracts"] = extracts;
+
+    //
+    // Run Ascent
+    //
+
+    Ascent ascent;
+
+    Node ascent_opts;
+    ascent_opts["runtime/type"] = "ascent";
+    ascent.open(ascent_opts);
+    ascent.publish(data);
+    ascent.execute(actions);
+    // render the same extract with the default compositor
+    actions.child(0)["extracts/e1/params/scheduler"] = "composite";
+    actions.child(0)["extracts/e1/params/filename"] = composite_file;
+    ascent.execute(actions);
+    ascent.close();
+
+    // with a single rank, the static scheduler has to match the compositor
+    Node info;
+    ascent::PNGCompare compare;
+    bool res = compare.Compare(output_file + "100.png",
+                               composite_file + "100.png",
+                               info,
+                               0.001f);
+    if(!res)
+    {
+      info.print();
+    }
+    EXPECT_TRUE(res);
+}
+
+//-----------------------------------------------------------------------------
+TEST(ascent_rover, test_volume_multi_domain)
+{
+    // the vtkm runtime is currently our only rendering runtime
+    Node n;
+    ascent::about(n);
+    // only run this test if ascent was built with vtkm support
+    if(n["runtimes/ascent/vtkm/status"].as_string() == "disabled")
+    {
+        ASCENT_INFO("Ascent support disabled, skipping test");
+        return;
+    }
+
+    ASCENT_INFO("Testing volume_extract with multiple domains");
+
+    //
+    // Create the same mesh as a single domain and as four domains.
+    //
+    const int num_domains = 4;
+    const int cells_per_domain = 4;
+
+    Node single, multi, verify_info;
+    create_3d_example_dataset(single, num_domains * cells_per_domain, 0, 1);
+    for(int i = 0; i < num_domains; ++i)
+    {
+        create_3d_example_dataset(multi.append(),
+                                  cells_per_domain,
+                                  i,
+                                  num_domains);
+    }
+
+    EXPECT_TRUE(conduit::blueprint::mesh::verify(single,verify_info));
+    EXPECT_TRUE(conduit::blueprint::mesh::verify(multi,verify_info));
+
+    string output_path = prepare_output_dir();
+    string single_file = conduit::utils::join_file_path(output_path,
+                                                        "tout_rover_volume_single_domain");
+    string multi_file = conduit::utils::join_file_path(output_path,
+                                                       "tout_rover_volume_multi_domain");
+
+    // remove old images before rendering
+    remove_test_image(single_file);
+    remove_test_image(multi_file);
+
+    for(int i = 0; i < 2; ++i)
+    {
+        const bool is_multi = i == 1;
+        //
+        // Create the actions.
+        //
+        conduit::Node extracts;
+        extracts["e1/type"]  = "volume";
+        extracts["e1/params/field"] = "radial_vert";
+        extracts["e1/params/filename"] = is_multi ? multi_file : single_file;
+
+        conduit::Node actions;
+        conduit::Node &add_extracts = actions.append();
+        add_extracts["action"] = "add_extracts";
+        add_extracts["extracts"] = extracts;
+
+        //
+        // Run Ascent
+        //
+        Ascent ascent;
+
+        Node ascent_opts;
+        ascent_opts["runtime/type"] = "ascent";
+        ascent.open(ascent_opts);
+        ascent.publish(is_multi ? multi : single);
+        ascent.execute(actions);
+        ascent.close();
+    }
+
+    // the domains partition the same mesh, so compositing the partial
+    // images has to produce the single domain image
+    Node info;
+    ascent::PNGCompare compare;
+    bool res = compare.Compare(multi_file + "100.png",
+                               single_file + "100.png",
+                               info,
+                               0.001f);
+    if(!res)
+    {
+      info.print();
+    }
+    EXPECT_TRUE(res);
+}
+
+//-----------------------------------------------------------------------------
+TEST(ascent_rover, test_volume_compression)
+{
+    // the vtkm runtime is currently our only rendering runtime
+    Node n;
+    ascent::about(n);
+    // only run this test if ascent was built with vtkm support
+    if(n["runtimes/ascent/vtkm/status"].as_string() == "disabled")
+    {
+        ASCENT_INFO("Ascent support disabled, skipping test");
+        return;
+    }
+
+    //
+    // Create an example mesh.
+    //
+    Node data, verify_info;
+    conduit::blueprint::mesh::examples::braid("hexs",
+                                              EXAMPLE_MESH_SIDE_DIM,
+                                              EXAMPLE_MESH_SIDE_DIM,
+                                              EXAMPLE_MESH_SIDE_DIM,
+                                              data);
+
+    EXPECT_TRUE(conduit::blueprint::mesh::verify(data,verify_info));
+
+    string output_path = prepare_output_dir();
+
+    std::vector<std::string> compressions;
+    compressions.push_back("default");
+    compressions.push_back("fast");
+    compressions.push_back("none");
+
+    std::vector<std::string> files;
+    for(size_t c = 0; c < compressions.size(); ++c)
+    {
+        string output_file = conduit::utils::join_file_path(output_path,
+                                        "tout_rover_volume_compression_" +
+                                        compressions[c]);
+        // remove old images before rendering
+        remove_test_image(output_file);
+        files.push_back(output_file + "100.png");
+
+        //
+        // Create the actions.
+        //
+        conduit::Node extracts;
+        extracts["e1/type"]  = "volume";
+        extracts["e1/params/field"] = "radial";
+        extracts["e1/params/filename"] = output_file;
+        extracts["e1/params/compression"] = compressions[c];
+
+        conduit::Node actions;
+        conduit::Node &add_extracts = actions.append();
+        add_extracts["action"] = "add_extracts";
+        add_extracts["extracts"] = extracts;
+
+        //
+        // Run Ascent
+        //
+        Ascent ascent;
+
+        Node ascent_opts;
+        ascent_opts["runtime/type"] = "ascent";
+        ascent_opts["exceptions"] = "forward";
+        ascent.open(ascent_opts);
+        ascent.publish(data);
+        ascent.execute(actions);
+        ascent.close();
+
+        EXPECT_TRUE(conduit::utils::is_file(files[c]));
+    }
+
+    // the levels only change how the pixels are stored
+    for(size_t c = 1; c < files.size(); ++c)
+    {
+        Node info;
+        ascent::PNGCompare compare;
+        bool res = compare.Compare(files[c], files[0], info, 0.f);
+        if(!res)
+        {
+          info.print();
+        }
+        EXPECT_TRUE(res) << compressions[c];
+    }
+
+    // stored rows are larger than deflated ones
+    std::ifstream f_default(files[0].c_str(), std::ios::binary | std::ios::ate);
+    std::ifstream f_none(files[2].c_str(), std::ios::binary | std::ios::ate);
+    EXPECT_GT(f_none.tellg(), f_default.tellg());
+}
@@ -52,6 +52,7 @@
 #include <ascent.hpp>
 
 #include <iostream>
+#include <sstream>
 #include <math.h>
 
 #include <conduit_blueprint.hpp>
@@ -329,6 +330,230 @@ TEST(ascent_triggers, trigger_extract)
 }
 
 
+//-----------------------------------------------------------------------------
+TEST(ascent_triggers, trigger_runtime_reuse)
+{
+    // the vtkm runtime is currently our only rendering runtime
+    Node n;
+    ascent::about(n);
+    // only run this test if ascent was built with vtkm support
+    if(n["runtimes/ascent/vtkm/status"].as_string() == "disabled")
+    {
+        ASCENT_INFO("Ascent support disabled, skipping test");
+        return;
+    }
+
+    //
+    // Create example mesh.
+    //
+    Node data, verify_info;
+    conduit::blueprint::mesh::examples::braid("hexs",
+                                               EXAMPLE_MESH_SIDE_DIM,
+                                               EXAMPLE_MESH_SIDE_DIM,
+                                               EXAMPLE_MESH_SIDE_DIM,
+                                               data);
+
+    EXPECT_TRUE(conduit::blueprint::mesh::verify(data,verify_info));
+
+    string output_path = prepare_output_dir();
+    string trigger_file = conduit::utils::join_file_path(output_path,"trigger_reuse_actions");
+    string output_file = conduit::utils::join_file_path(output_path,"tout_trigger_reuse");
+    string output_root_file_100 = output_file + ".cycle_000100.root";
+    string output_root_file_101 = output_file + ".cycle_000101.root";
+
+    // remove old files
+    if(conduit::utils::is_file(trigger_file))
+    {
+      conduit::utils::remove_file(trigger_file);
+    }
+
+    if(conduit::utils::is_file(output_root_file_100))
+    {
+      conduit::utils::remove_file(output_root_file_100);
+    }
+
+    if(conduit::utils::is_file(output_root_file_101))
+    {
+      conduit::utils::remove_file(output_root_file_101);
+    }
+
+    //
+    // Create trigger actions.
+    //
+    Node trigger_actions;
+
+    conduit::Node extracts;
+
+    extracts["e1/type"]  = "relay";
+    extracts["e1/params/path"] = output_file;
+    extracts["e1/params/protocol"] = "blueprint/mesh/hdf5";
+
+    conduit::Node &add_ext= trigger_actions.append();
+    add_ext["action"] = "add_extracts";
+    add_ext["extracts"] = extracts;
+
+    trigger_actions.save(trigger_file, "json");
+
+    //
+    // Create the actions.
+    //
+    Node actions;
+    std::string condition = "1 == 1";
+    conduit::Node triggers;
+    triggers["t1/params/condition"] = condition;
+    triggers["t1/params/actions_file"] = trigger_file;
+
+    conduit::Node &add_triggers= actions.append();
+    add_triggers["action"] = "add_triggers";
+    add_triggers["triggers"] = triggers;
+
+    //
+    // Run Ascent
+    //
+
+    Ascent ascent;
+    Node ascent_opts;
+    ascent_opts["runtime/type"] = "ascent";
+    ascent_opts["exceptions"] = "forward";
+    ascent.open(ascent_opts);
+    ascent.publish(data);
+    ascent.execute(actions);
+    EXPECT_TRUE(conduit::utils::is_file(output_root_file_100));
+
+    // the actions were parsed when the trigger first fired, so the
+    // second firing does not need the file
+    conduit::utils::remove_file(trigger_file);
+
+    data["state/cycle"] = 101;
+    ascent.publish(data);
+    ascent.execute(actions);
+    EXPECT_TRUE(conduit::utils::is_file(output_root_file_101));
+
+    ascent.close();
+}
+
+
+//-----------------------------------------------------------------------------
+TEST(ascent_triggers, trigger_with_scene_and_query)
+{
+    // the vtkm runtime is currently our only rendering runtime
+    Node n;
+    ascent::about(n);
+    // only run this test if ascent was built with vtkm support
+    if(n["runtimes/ascent/vtkm/status"].as_string() == "disabled")
+    {
+        ASCENT_INFO("Ascent support disabled, skipping test");
+        return;
+    }
+
+    //
+    // Create example mesh.
+    //
+    Node data, verify_info;
+    conduit::blueprint::mesh::examples::braid("hexs",
+                                               EXAMPLE_MESH_SIDE_DIM,
+                                               EXAMPLE_MESH_SIDE_DIM,
+                                               EXAMPLE_MESH_SIDE_DIM,
+                                               data);
+
+    EXPECT_TRUE(conduit::blueprint::mesh::verify(data,verify_info));
+
+    string output_path = prepare_output_dir();
+    string trigger_file = conduit::utils::join_file_path(output_path,
+                                                         "trigger_scene_query_actions");
+    string parent_image = conduit::utils::join_file_path(output_path,
+                                                         "tout_trigger_parent_scene");
+    string child_image = conduit::utils::join_file_path(output_path,
+                                                        "tout_trigger_child_scene");
+
+    // remove old files
+    if(conduit::utils::is_file(trigger_file))
+    {
+      conduit::utils::remove_file(trigger_file);
+    }
+
+    //
+    // Create trigger actions, the child renders and queries as well.
+    //
+    Node trigger_actions;
+
+    conduit::Node &child_scenes = trigger_actions.append();
+    child_scenes["action"] = "add_scenes";
+    child_scenes["scenes/s1/plots/p1/type"] = "pseudocolor";
+    child_scenes["scenes/s1/plots/p1/field"] = "braid";
+    child_scenes["scenes/s1/image_prefix"] = child_image + "_%d";
+
+    conduit::Node &child_queries = trigger_actions.append();
+    child_queries["action"] = "add_queries";
+    child_queries["queries/q1/params/expression"] = "min(field(\"braid\")).value";
+    child_queries["queries/q1/params/name"] = "child_min_braid";
+
+    trigger_actions.save(trigger_file, "json");
+
+    //
+    // Create the actions: a query, a trigger and a scene in one execute
+    //
+    Node actions;
+
+    conduit::Node &add_queries = actions.append();
+    add_queries["action"] = "add_queries";
+    add_queries["queries/q1/params/expression"] = "max(field(\"braid\")).value";
+    add_queries["queries/q1/params/name"] = "max_braid";
+
+    conduit::Node &add_triggers = actions.append();
+    add_triggers["action"] = "add_triggers";
+    add_triggers["triggers/t1/params/condition"] = "max(field(\"braid\")).value > 0";
+    add_triggers["triggers/t1/params/actions_file"] = trigger_file;
+
+    conduit::Node &add_scenes = actions.append();
+    add_scenes["action"] = "add_scenes";
+    add_scenes["scenes/s1/plots/p1/type"] = "pseudocolor";
+    add_scenes["scenes/s1/plots/p1/field"] = "braid";
+    add_scenes["scenes/s1/image_prefix"] = parent_image + "_%d";
+
+    //
+    // Run Ascent
+    //
+
+    Ascent ascent;
+    Node ascent_opts;
+    ascent_opts["runtime/type"] = "ascent";
+    ascent_opts["exceptions"] = "forward";
+    ascent.open(ascent_opts);
+
+    for(int cycle = 100; cycle < 102; ++cycle)
+    {
+      std::stringstream suffix;
+      suffix << "_" << cycle;
+      remove_test_image(parent_image + suffix.str(), "");
+      remove_test_image(child_image + suffix.str(), "");
+
+      data["state/cycle"] = cycle;
+      ascent.publish(data);
+      ascent.execute(actions);
+
+      EXPECT_TRUE(conduit::utils::is_file(parent_image + suffix.str() + ".png"));
+      EXPECT_TRUE(conduit::utils::is_file(child_image + suffix.str() + ".png"));
+
+      conduit::Node info;
+      ascent.info(info);
+      std::stringstream max_path, min_path;
+      max_path << "expressions/max_braid/" << cycle << "/value";
+      min_path << "expressions/child_min_braid/" << cycle << "/value";
+      EXPECT_TRUE(info.has_path(max_path.str()));
+      EXPECT_TRUE(info.has_path(min_path.str()));
+
+      // the child runtime must not release the parent's compiled
+      // expressions, so the second execute reuses them
+      if(cycle == 101)
+      {
+        EXPECT_GT(info["expression_cache/hits"].to_int64(), 0);
+      }
+    }
+
+    ascent.close();
+}
+
 
 //-----------------------------------------------------------------------------
 int main(int argc, char* argv[])
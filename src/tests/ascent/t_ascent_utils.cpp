@@ -51,9 +51,16 @@
 #include "gtest/gtest.h"
 
 #include <ascent.hpp>
+#include <ascent_image_channel.hpp>
+#include <ascent_png_decoder.hpp>
+#include <ascent_png_encoder.hpp>
 
 #include <iostream>
 #include <math.h>
+#include <sstream>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
 
 #include "t_config.hpp"
 #include "t_utils.hpp"
@@ -87,3 +94,130 @@ TEST(ascent_utils, ascent_copy_dir)
     EXPECT_TRUE(conduit::utils::is_file(idx_fpath));
 }
 
+//-----------------------------------------------------------------------------
+TEST(ascent_utils, ascent_png_encoder_compression)
+{
+    const int width  = 333;
+    const int height = 257;
+
+    // bottom up float rgba, with values outside of [0,1]
+    std::vector<float> rgba(width * height * 4);
+    for(int y = 0; y < height; ++y)
+    {
+        for(int x = 0; x < width; ++x)
+        {
+            float *pixel = &rgba[(y * width + x) * 4];
+            pixel[0] = x / float(width);
+            pixel[1] = y / float(height);
+            pixel[2] = ((x / 8 + y / 8) % 2) * 1.5f;
+            pixel[3] = (x % 7) == 0 ? -0.5f : 1.f;
+        }
+    }
+
+    const std::string compressions[3] = {"default", "fast", "none"};
+    std::vector<size_t> png_sizes;
+
+    for(int c = 0; c < 3; ++c)
+    {
+        PNGEncoder encoder;
+        encoder.SetCompression(compressions[c]);
+        EXPECT_EQ(encoder.Compression(), compressions[c]);
+        encoder.Encode(&rgba[0], width, height);
+        png_sizes.push_back(encoder.PngBufferSize());
+
+        string output_file = conduit::utils::join_file_path(prepare_output_dir(),
+                               "tout_png_encoder_" + compressions[c] + ".png");
+        encoder.Save(output_file);
+
+        unsigned char *decoded = NULL;
+        int decoded_width, decoded_height;
+        PNGDecoder decoder;
+        decoder.Decode(decoded, decoded_width, decoded_height, output_file);
+
+        EXPECT_EQ(decoded_width, width);
+        EXPECT_EQ(decoded_height, height);
+
+        // decoded rows are top down, values are clamped
+        int mismatches = 0;
+        for(int y = 0; y < height; ++y)
+        {
+            for(int i = 0; i < width * 4; ++i)
+            {
+                float value = rgba[(height - y - 1) * width * 4 + i];
+                value = value < 0.f ? 0.f : (value > 1.f ? 1.f : value);
+                if(decoded[y * width * 4 + i] != (unsigned char)(value * 255.f))
+                {
+                    mismatches++;
+                }
+            }
+        }
+        EXPECT_EQ(mismatches, 0);
+        free(decoded);
+    }
+
+    // no compression stores every row
+    EXPECT_TRUE(png_sizes[2] > size_t(width * height * 4));
+    EXPECT_TRUE(png_sizes[0] < png_sizes[2]);
+
+    PNGEncoder encoder;
+    EXPECT_THROW(encoder.SetCompression("best"), conduit::Error);
+}
+
+//-----------------------------------------------------------------------------
+unsigned char *
+test_png_buffer(size_t size)
+{
+    unsigned char *png = (unsigned char*)malloc(size);
+    memset(png, 0, size);
+    return png;
+}
+
+//-----------------------------------------------------------------------------
+TEST(ascent_utils, ascent_image_channel_cycles)
+{
+    ImageChannel::Clear();
+    ImageChannel::SetMaxCycles(2);
+
+    // cinema names its images by time step, so the names change
+    // every cycle
+    for(int cycle = 0; cycle < 4; ++cycle)
+    {
+        std::ostringstream oss;
+        oss << "db/" << cycle << ".0/0.0_0.0_image.png";
+        ImageChannel::Publish(oss.str(), cycle, 4, 4, test_png_buffer(16), 16);
+        ImageChannel::Publish("image.png", cycle, 4, 4, test_png_buffer(16), 16);
+    }
+
+    // only the two newest cycles are kept
+    Node info;
+    ImageChannel::Info(info);
+    EXPECT_EQ(info.number_of_children(), 4);
+    EXPECT_TRUE(ImageChannel::Fetch("image.png", 1).get() == NULL);
+    EXPECT_TRUE(ImageChannel::Fetch("db/1.0/0.0_0.0_image.png", 1).get() == NULL);
+    EXPECT_TRUE(ImageChannel::Fetch("image.png", 3).get() != NULL);
+    EXPECT_TRUE(ImageChannel::Fetch("db/3.0/0.0_0.0_image.png", 3).get() != NULL);
+    EXPECT_EQ(ImageChannel::Latest("image.png")->Cycle(), 3);
+
+    // a frame that is held stays valid after it is released
+    ImageChannel::FramePtr frame = ImageChannel::Fetch("image.png", 2);
+    ImageChannel::SetMaxCycles(1);
+    EXPECT_TRUE(ImageChannel::Fetch("image.png", 2).get() == NULL);
+    EXPECT_EQ(frame->PngSize(), (size_t)16);
+
+    // publish the bytes of a file
+    string output_file = conduit::utils::join_file_path(prepare_output_dir(),
+                                                        "tout_image_channel.png");
+    std::vector<float> rgba(8 * 8 * 4, 0.5f);
+    PNGEncoder encoder;
+    encoder.Encode(&rgba[0], 8, 8);
+    encoder.Save(output_file);
+
+    frame = ImageChannel::PublishFile("tout_image_channel.png", 4, 8, 8, output_file);
+    ASSERT_TRUE(frame.get() != NULL);
+    EXPECT_EQ(frame->PngSize(), encoder.PngBufferSize());
+    EXPECT_EQ(memcmp(frame->Png(), encoder.PngBuffer(), frame->PngSize()), 0);
+
+    ImageChannel::Clear();
+    ImageChannel::SetMaxCycles(1);
+}
+
@@ -54,6 +54,7 @@
 #include <ascent.hpp>
 #include <runtimes/ascent_vtkh_data_adapter.hpp>
 #include <vtkm/cont/testing/MakeTestDataSet.h>
+#include <vtkh/utils/vtkm_array_utils.hpp>
 #include <iostream>
 #include <math.h>
 
@@ -321,6 +322,228 @@ TEST(ascent_data_adapter, interleaved_3d)
 }
 
 
+//-----------------------------------------------------------------------------
+TEST(ascent_data_adapter, topology_cache)
+{
+    Node n;
+    ascent::about(n);
+    // only run this test if ascent was built with vtkm support
+    if(n["runtimes/ascent/vtkm/status"].as_string() == "disabled")
+    {
+        ASCENT_INFO("Ascent vtkm support disabled, skipping test");
+        return;
+    }
+
+    Node mesh;
+    conduit::blueprint::mesh::examples::braid("hexs",
+                                              EXAMPLE_MESH_SIDE_DIM,
+                                              EXAMPLE_MESH_SIDE_DIM,
+                                              EXAMPLE_MESH_SIDE_DIM,
+                                              mesh);
+    mesh["state/domain_id"] = 0;
+
+    VTKHDataAdapter::SetTopologyCacheMode("hash");
+    EXPECT_EQ(VTKHDataAdapter::TopologyCacheMode(), "hash");
+
+    vtkm::cont::DataSet *first  = VTKHDataAdapter::BlueprintToVTKmDataSet(mesh, true);
+    vtkm::cont::DataSet *second = VTKHDataAdapter::BlueprintToVTKmDataSet(mesh, true);
+
+    // the second conversion reuses the cell set of the first
+    EXPECT_EQ(first->GetCellSet().GetCellSetBase(),
+              second->GetCellSet().GetCellSetBase());
+    EXPECT_EQ(first->GetNumberOfFields(), second->GetNumberOfFields());
+    EXPECT_TRUE(second->HasField("braid"));
+
+    // updating the coords in place invalidates the cached topology
+    float64_array x_vals = mesh["coordsets/coords/values/x"].value();
+    x_vals[0] += 1.0;
+    vtkm::cont::DataSet *third = VTKHDataAdapter::BlueprintToVTKmDataSet(mesh, true);
+    EXPECT_NE(second->GetCellSet().GetCellSetBase(),
+              third->GetCellSet().GetCellSetBase());
+
+    VTKHDataAdapter::SetTopologyCacheMode("off");
+
+    delete first;
+    delete second;
+    delete third;
+}
+
+//-----------------------------------------------------------------------------
+TEST(ascent_data_adapter, zero_copy_fields)
+{
+    Node n;
+    ascent::about(n);
+    // only run this test if ascent was built with vtkm support
+    if(n["runtimes/ascent/vtkm/status"].as_string() == "disabled")
+    {
+        ASCENT_INFO("Ascent vtkm support disabled, skipping test");
+        return;
+    }
+
+    Node mesh;
+    conduit::blueprint::mesh::examples::braid("hexs",
+                                              EXAMPLE_MESH_SIDE_DIM,
+                                              EXAMPLE_MESH_SIDE_DIM,
+                                              EXAMPLE_MESH_SIDE_DIM,
+                                              mesh);
+    const index_t num_eles = (EXAMPLE_MESH_SIDE_DIM - 1) *
+                             (EXAMPLE_MESH_SIDE_DIM - 1) *
+                             (EXAMPLE_MESH_SIDE_DIM - 1);
+
+    // integer material ids
+    mesh["fields/mat/association"] = "element";
+    mesh["fields/mat/topology"] = "mesh";
+    mesh["fields/mat/values"].set(DataType::int32(num_eles));
+    int32_array mat_vals = mesh["fields/mat/values"].value();
+    for(index_t i = 0; i < num_eles; ++i)
+    {
+        mat_vals[i] = (int32) (i % 3);
+    }
+
+    // 64-bit integer ids
+    mesh["fields/ids/association"] = "element";
+    mesh["fields/ids/topology"] = "mesh";
+    mesh["fields/ids/values"].set(DataType::int64(num_eles));
+    int64_array id_vals = mesh["fields/ids/values"].value();
+    for(index_t i = 0; i < num_eles; ++i)
+    {
+        id_vals[i] = (int64) i;
+    }
+
+    // every other value of a larger array
+    Node buffer;
+    buffer.set(DataType::float64(2 * num_eles));
+    float64_array buffer_vals = buffer.value();
+    for(index_t i = 0; i < 2 * num_eles; ++i)
+    {
+        buffer_vals[i] = (i % 2 == 0) ? (float64) i : -1.0;
+    }
+    mesh["fields/strided/association"] = "element";
+    mesh["fields/strided/topology"] = "mesh";
+    mesh["fields/strided/values"].set_external(DataType::float64(num_eles,
+                                                                 0,
+                                                                 2 * sizeof(float64)),
+                                               buffer.data_ptr());
+
+    // braid's vel is stored as separate component arrays
+    EXPECT_FALSE(conduit::blueprint::mcarray::is_interleaved(mesh["fields/vel/values"]));
+
+    // compact float and int fields are zero copied, the others are
+    // copied into basic arrays vtk-m can work with
+    VTKHDataAdapter::ClearFieldImportInfo();
+    vtkm::cont::DataSet *dset = VTKHDataAdapter::BlueprintToVTKmDataSet(mesh, true);
+
+    Node info;
+    VTKHDataAdapter::FieldImportInfo(info);
+    EXPECT_EQ(info["braid/copied"].as_string(), "false");
+    EXPECT_EQ(info["braid/bytes"].to_int64(), 0);
+    EXPECT_EQ(info["mat/copied"].as_string(), "false");
+    EXPECT_EQ(info["mat/bytes"].to_int64(), 0);
+    EXPECT_EQ(info["ids/copied"].as_string(), "false");
+    EXPECT_EQ(info["strided/copied"].as_string(), "true");
+    EXPECT_EQ(info["vel/copied"].as_string(), "true");
+
+    // the zero copied fields use the simulation's arrays
+    using Float64Handle = vtkm::cont::ArrayHandle<vtkm::Float64>;
+    using Int32Handle   = vtkm::cont::ArrayHandle<vtkm::Int32>;
+    using Int64Handle   = vtkm::cont::ArrayHandle<vtkm::Int64>;
+
+    vtkm::cont::VariantArrayHandle braid_data = dset->GetField("braid").GetData();
+    vtkm::cont::VariantArrayHandle mat_data = dset->GetField("mat").GetData();
+    vtkm::cont::VariantArrayHandle ids_data = dset->GetField("ids").GetData();
+    ASSERT_TRUE(braid_data.IsType<Float64Handle>());
+    ASSERT_TRUE(mat_data.IsType<Int32Handle>());
+    ASSERT_TRUE(ids_data.IsType<Int64Handle>());
+
+    Float64Handle braid_handle = braid_data.Cast<Float64Handle>();
+    Int32Handle mat_handle = mat_data.Cast<Int32Handle>();
+    Int64Handle ids_handle = ids_data.Cast<Int64Handle>();
+    EXPECT_EQ((void*) vtkh::GetVTKMPointer(braid_handle),
+              mesh["fields/braid/values"].data_ptr());
+    EXPECT_EQ((void*) vtkh::GetVTKMPointer(mat_handle),
+              mesh["fields/mat/values"].data_ptr());
+    EXPECT_EQ((void*) vtkh::GetVTKMPointer(ids_handle),
+              mesh["fields/ids/values"].data_ptr());
+
+    // the converted values match the simulation's
+    Node res;
+    VTKHDataAdapter::VTKmToBlueprintDataSet(dset, res);
+
+    int32_array res_mat = res["fields/mat/values"].value();
+    int64_array res_ids = res["fields/ids/values"].value();
+    float64_array res_strided = res["fields/strided/values"].value();
+    EXPECT_EQ(res_mat.number_of_elements(), num_eles);
+    EXPECT_EQ(res_ids.number_of_elements(), num_eles);
+    EXPECT_EQ(res_strided.number_of_elements(), num_eles);
+    for(index_t i = 0; i < num_eles; ++i)
+    {
+        EXPECT_EQ(res_mat[i], mat_vals[i]);
+        EXPECT_EQ(res_ids[i], id_vals[i]);
+        EXPECT_EQ(res_strided[i], buffer_vals[2 * i]);
+    }
+
+    const Node &vel = mesh["fields/vel/values"];
+    const index_t num_verts = vel["u"].dtype().number_of_elements();
+    float64_array vel_u = vel["u"].value();
+    float64_array vel_v = vel["v"].value();
+    float64_array vel_w = vel["w"].value();
+    Node res_vel;
+    res_vel["u"].set(res["fields/vel/values/u"]);
+    res_vel["v"].set(res["fields/vel/values/v"]);
+    res_vel["w"].set(res["fields/vel/values/w"]);
+    float64_array res_u = res_vel["u"].value();
+    float64_array res_v = res_vel["v"].value();
+    float64_array res_w = res_vel["w"].value();
+    EXPECT_EQ(res_u.number_of_elements(), num_verts);
+    for(index_t i = 0; i < num_verts; ++i)
+    {
+        EXPECT_EQ(res_u[i], vel_u[i]);
+        EXPECT_EQ(res_v[i], vel_v[i]);
+        EXPECT_EQ(res_w[i], vel_w[i]);
+    }
+    delete dset;
+
+    // the fields also go through filters and a render
+    string output_path = prepare_output_dir();
+    string output_file = conduit::utils::join_file_path(output_path,
+                                    "tout_zero_copy_fields");
+    remove_test_image(output_file);
+
+    conduit::Node actions;
+    conduit::Node &add_pipelines = actions.append();
+    add_pipelines["action"] = "add_pipelines";
+    conduit::Node &pipelines = add_pipelines["pipelines"];
+    pipelines["pl1/f1/type"] = "threshold";
+    pipelines["pl1/f1/params/field"] = "mat";
+    pipelines["pl1/f1/params/min_value"] = 1.0;
+    pipelines["pl1/f1/params/max_value"] = 1.0;
+    pipelines["pl1/f2/type"] = "vector_magnitude";
+    pipelines["pl1/f2/params/field"] = "vel";
+    pipelines["pl1/f2/params/output_name"] = "vel_mag";
+
+    conduit::Node &add_scenes = actions.append();
+    add_scenes["action"] = "add_scenes";
+    conduit::Node &scenes = add_scenes["scenes"];
+    scenes["s1/plots/p1/type"] = "pseudocolor";
+    scenes["s1/plots/p1/field"] = "strided";
+    scenes["s1/plots/p1/pipeline"] = "pl1";
+    scenes["s1/plots/p2/type"] = "pseudocolor";
+    scenes["s1/plots/p2/field"] = "vel_mag";
+    scenes["s1/plots/p2/pipeline"] = "pl1";
+    scenes["s1/image_prefix"] = output_file;
+
+    Ascent ascent;
+    Node ascent_opts;
+    ascent_opts["runtime/type"] = "ascent";
+    ascent_opts["exceptions"] = "forward";
+    ascent.open(ascent_opts);
+    ascent.publish(mesh);
+    ascent.execute(actions);
+    ascent.close();
+
+    EXPECT_TRUE(conduit::utils::is_file(output_file + ".png"));
+}
+
 //-----------------------------------------------------------------------------
 int main(int argc, char* argv[])
 {
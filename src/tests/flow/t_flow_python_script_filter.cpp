@@ -290,3 +290,100 @@ TEST(flow_python_script_filter, exe_override_interface_mod_and_func_names)
 
 
 
+
+//-----------------------------------------------------------------------------
+TEST(flow_python_script_filter, exe_entry_func_multiple_cycles)
+{
+    flow::filters::register_builtin();
+
+    Workspace::register_filter_type<SrcFilter>();
+
+    Workspace w;
+
+    Node src_params;
+    src_params["value"] = 21;
+
+    w.graph().add_filter("src","v",src_params);
+
+    // module level code runs once, the entry function each execute
+    std::ostringstream py_src_oss;
+    py_src_oss << "entry_setup_count = globals().get('entry_setup_count',0) + 1\n"
+               << "entry_call_count  = 0\n"
+               << "def entry_func():\n"
+               << "    global entry_call_count\n"
+               << "    entry_call_count += 1\n"
+               << "    assert entry_setup_count == 1\n"
+               << "    val = flow_input().value() * 2\n"
+               << "    print(entry_call_count, val)\n"
+               << "    flow_set_output(val)\n";
+
+    Node py_params;
+    py_params["interface/entry"] = "entry_func";
+    py_params["source"] = py_src_oss.str();
+
+    w.graph().add_filter("python_script","py", py_params);
+
+    // // src, dest, port
+    w.graph().connect("v","py","in");
+
+    w.print();
+    w.execute();
+    // a failed assert in the script throws
+    w.execute();
+    w.execute();
+
+    Workspace::clear_supported_filter_types();
+}
+
+//-----------------------------------------------------------------------------
+TEST(flow_python_script_filter, exe_entry_funcs_same_name)
+{
+    flow::filters::register_builtin();
+
+    Workspace::register_filter_type<SrcFilter>();
+
+    Workspace w;
+
+    Node src_params;
+    src_params["value"] = 21;
+
+    w.graph().add_filter("src","v",src_params);
+
+    // both scripts define main and factor, each entry function
+    // must see its own
+    std::ostringstream py_src_a_oss;
+    py_src_a_oss << "factor = 2\n"
+                 << "def main():\n"
+                 << "    assert factor == 2\n"
+                 << "    flow_set_output(flow_input().value() * factor)\n";
+
+    std::ostringstream py_src_b_oss;
+    py_src_b_oss << "factor = 3\n"
+                 << "def main():\n"
+                 << "    assert factor == 3\n"
+                 << "    flow_set_output(flow_input().value() * factor)\n";
+
+    Node py_params;
+    py_params["interface/entry"] = "main";
+    py_params["source"] = py_src_a_oss.str();
+    w.graph().add_filter("python_script","py_a", py_params);
+
+    py_params["source"] = py_src_b_oss.str();
+    w.graph().add_filter("python_script","py_b", py_params);
+
+    // // src, dest, port
+    w.graph().connect("v","py_a","in");
+    w.graph().connect("v","py_b","in");
+
+    w.print();
+    // a failed assert in the script throws
+    w.execute();
+    w.execute();
+
+    // released scripts are compiled and run again
+    flow::filters::PythonScript::clear_cache();
+    w.execute();
+    w.execute();
+
+    Workspace::clear_supported_filter_types();
+}
@@ -188,6 +188,31 @@ TEST(ascent_flow_registry, untracked_aliased)
 }
 
 
+//-----------------------------------------------------------------------------
+TEST(ascent_flow_registry, tracked_then_untracked_aliased)
+{
+    Node *n = new Node();
+
+    n->set(10);
+
+    Registry r;
+    r.add<Node>("d",n,1);
+    // an untracked alias means the data is never released
+    DataWrapper<Node> n_data(n);
+    r.add_untracked("d_al",n_data);
+    r.print();
+
+    r.consume("d");
+    EXPECT_FALSE(r.has_entry("d"));
+
+    Node *n_fetch = r.fetch<Node>("d_al");
+    EXPECT_EQ(n,n_fetch);
+    EXPECT_EQ(n_fetch->to_int(),10);
+
+    r.reset();
+
+    delete n;
+}
 //-----------------------------------------------------------------------------
 TEST(ascent_flow_registry, detach_tracked)
 {
@@ -205,6 +230,11 @@ TEST(ascent_flow_registry, detach_tracked)
 
     EXPECT_FALSE(r.has_entry("d"));
 
+    // no bookkeeping for the pointer should remain
+    Node r_info;
+    r.info(r_info);
+    EXPECT_EQ(r_info["pointers"].number_of_children(),0);
+
     r.print();
 
     delete n;
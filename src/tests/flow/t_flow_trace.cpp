@@ -0,0 +1,210 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2015-2019, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-716457
+//
+// All rights reserved.
+//
+// This file is part of Ascent.
+//
+// For details, see: http://ascent.readthedocs.io/.
+//
+// Please also read ascent/LICENSE
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the disclaimer below.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the disclaimer (as noted below) in the
+//   documentation and/or other materials provided with the distribution.
+//
+// * Neither the name of the LLNS/LLNL nor the names of its contributors may
+//   be used to endorse or promote products derived from this software without
+//   specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL LAWRENCE LIVERMORE NATIONAL SECURITY,
+// LLC, THE U.S. DEPARTMENT OF ENERGY OR CONTRIBUTORS BE LIABLE FOR ANY
+// DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//-----------------------------------------------------------------------------
+///
+/// file: t_flow_trace.cpp
+///
+//-----------------------------------------------------------------------------
+
+#include "gtest/gtest.h"
+
+#include <flow.hpp>
+
+#include <iostream>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+#include "t_config.hpp"
+
+
+
+using namespace std;
+using namespace conduit;
+using namespace flow;
+
+
+//-----------------------------------------------------------------------------
+TEST(ascent_flow_trace, disabled_is_noop)
+{
+    Tracer::enable(false);
+    Tracer::clear();
+
+    {
+        TraceScope scope("noop","test");
+        TraceScope::add_bytes(10);
+    }
+    Tracer::record("noop","test","",0.0,1.0);
+
+    EXPECT_EQ(Tracer::number_of_events(),0);
+}
+
+//-----------------------------------------------------------------------------
+TEST(ascent_flow_trace, scopes_and_bytes)
+{
+    Tracer::clear();
+    Tracer::enable(true);
+    Tracer::set_cycle(42);
+
+    {
+        TraceScope outer("outer","test","node_a");
+        {
+            TraceScope inner("inner","test","node_b");
+            TraceScope::add_bytes(100);
+        }
+        TraceScope::add_bytes(8);
+    }
+
+    Tracer::enable(false);
+
+    Node events;
+    Tracer::events(events);
+    events.print();
+
+    EXPECT_EQ(events.number_of_children(),2);
+
+    // ordered by start time
+    const Node &outer = events[0];
+    const Node &inner = events[1];
+
+    EXPECT_EQ(outer["name"].as_string(),"outer");
+    EXPECT_EQ(outer["node"].as_string(),"node_a");
+    EXPECT_EQ(outer["bytes"].to_uint64(),8);
+    EXPECT_EQ(outer["cycle"].to_int(),42);
+
+    EXPECT_EQ(inner["name"].as_string(),"inner");
+    EXPECT_EQ(inner["node"].as_string(),"node_b");
+    EXPECT_EQ(inner["bytes"].to_uint64(),100);
+
+    EXPECT_LE(outer["ts"].to_float64(),inner["ts"].to_float64());
+    EXPECT_GE(outer["dur"].to_float64(),inner["dur"].to_float64());
+
+    Tracer::clear();
+    Tracer::set_cycle(0);
+}
+
+//-----------------------------------------------------------------------------
+TEST(ascent_flow_trace, ring_buffer_drops_oldest)
+{
+    Tracer::set_buffer_size(4);
+    Tracer::enable(true);
+
+    for(int i = 0; i < 10; i++)
+    {
+        std::ostringstream oss;
+        oss << "event_" << i;
+        Tracer::record(oss.str(),"test","",(double)i,1.0);
+    }
+
+    Tracer::enable(false);
+
+    EXPECT_EQ(Tracer::number_of_events(),4);
+    EXPECT_EQ(Tracer::number_of_dropped_events(),6);
+
+    Node events;
+    Tracer::events(events);
+    EXPECT_EQ(events[0]["name"].as_string(),"event_6");
+    EXPECT_EQ(events[3]["name"].as_string(),"event_9");
+
+    Tracer::clear();
+    EXPECT_EQ(Tracer::number_of_events(),0);
+    EXPECT_EQ(Tracer::number_of_dropped_events(),0);
+
+    Tracer::set_buffer_size(65536);
+    EXPECT_THROW(Tracer::set_buffer_size(0),conduit::Error);
+}
+
+//-----------------------------------------------------------------------------
+TEST(ascent_flow_trace, threads_and_chrome_json)
+{
+    Tracer::clear();
+    Tracer::enable(true);
+
+    std::vector<std::thread> threads;
+    for(int i = 0; i < 3; i++)
+    {
+        threads.push_back(std::thread([]()
+        {
+            for(int j = 0; j < 5; j++)
+            {
+                TraceScope scope("work","test \"quoted\"");
+            }
+        }));
+    }
+
+    for(size_t i = 0; i < threads.size(); i++)
+    {
+        threads[i].join();
+    }
+
+    Tracer::enable(false);
+
+    EXPECT_EQ(Tracer::number_of_events(),15);
+
+    std::ostringstream oss;
+    Tracer::write_trace(oss,3);
+    std::cout << oss.str() << std::endl;
+
+    Node trace;
+    Generator g(oss.str(),"json");
+    g.walk(trace);
+
+    // process name + events
+    const Node &trace_events = trace["traceEvents"];
+    EXPECT_EQ(trace_events.number_of_children(),16);
+    EXPECT_EQ(trace_events[0]["ph"].as_string(),"M");
+
+    for(index_t i = 1; i < trace_events.number_of_children(); i++)
+    {
+        const Node &e = trace_events[i];
+        EXPECT_EQ(e["ph"].as_string(),"X");
+        EXPECT_EQ(e["pid"].to_int(),3);
+        EXPECT_EQ(e["cat"].as_string(),"test \"quoted\"");
+        EXPECT_TRUE(e.has_path("args/cycle"));
+        EXPECT_TRUE(e.has_path("args/bytes"));
+    }
+
+    Tracer::clear();
+}
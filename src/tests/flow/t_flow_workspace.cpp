@@ -54,6 +54,8 @@
 #include <flow_builtin_filters.hpp>
 
 #include <iostream>
+#include <map>
+#include <set>
 #include <math.h>
 
 #include "t_config.hpp"
@@ -152,6 +154,111 @@ public:
 };
 
 
+//-----------------------------------------------------------------------------
+class CachedIncFilter: public Filter
+{
+public:
+    CachedIncFilter()
+    : Filter()
+    {}
+
+    virtual ~CachedIncFilter()
+    {}
+
+    virtual void declare_interface(Node &i)
+    {
+        i["type_name"]   = "cached_inc";
+        i["output_port"] = "true";
+        i["cacheable"]   = "true";
+        i["port_names"].append().set("in");
+        i["default_params"]["inc"].set((int)1);
+    }
+
+    virtual void execute()
+    {
+        int inc  = params()["inc"].value();
+        Node *in = input<Node>("in");
+
+        Node *res = new Node();
+        res->set(in->to_int() + inc);
+        set_output<Node>(res);
+
+        exec_count++;
+    }
+
+    static int exec_count;
+};
+
+int CachedIncFilter::exec_count = 0;
+
+//-----------------------------------------------------------------------------
+class FieldIncFilter: public Filter
+{
+public:
+    FieldIncFilter()
+    : Filter()
+    {}
+
+    virtual ~FieldIncFilter()
+    {}
+
+    virtual void declare_interface(Node &i)
+    {
+        i["type_name"]   = "field_inc";
+        i["output_port"] = "true";
+        i["cacheable"]   = "true";
+        i["field_usage"] = "params";
+        i["port_names"].append().set("in");
+        i["default_params"]["field"].set("");
+    }
+
+    virtual void execute()
+    {
+        Node *in = input<Node>("in");
+
+        Node *res = new Node();
+        res->set(in->to_int() + 1);
+        set_output<Node>(res);
+
+        exec_counts[name()]++;
+    }
+
+    static std::map<std::string,int> exec_counts;
+};
+
+std::map<std::string,int> FieldIncFilter::exec_counts;
+
+//-----------------------------------------------------------------------------
+// sink that records the value it reads, so tests can check results
+// w/o keeping anything in the registry
+class RecordFilter: public Filter
+{
+public:
+    RecordFilter()
+    : Filter()
+    {}
+
+    virtual ~RecordFilter()
+    {}
+
+    virtual void declare_interface(Node &i)
+    {
+        i["type_name"]   = "record";
+        i["output_port"] = "false";
+        i["port_names"].append().set("in");
+    }
+
+    virtual void execute()
+    {
+        Node *in = input<Node>("in");
+        values[name()] = in->to_int();
+    }
+
+    static std::map<std::string,int> values;
+};
+
+std::map<std::string,int> RecordFilter::values;
+
 //-----------------------------------------------------------------------------
 class AddFilter: public Filter
 {
@@ -232,7 +339,11 @@ TEST(ascent_flow_workspace, linear_graph)
 
     w.print();
 
-    ASCENT_INFO(w.timing_info());
+    // timings are recorded w/o tracing
+    std::string timings = w.timing_info();
+    ASCENT_INFO(timings);
+    EXPECT_TRUE(timings.find("0 c ") != std::string::npos);
+    EXPECT_TRUE(timings.find("0 [total] ") != std::string::npos);
 
     Workspace::clear_supported_filter_types();
 }
@@ -742,3 +853,324 @@ TEST(ascent_flow_workspace, dag_graph_missing_input_error)
 
     Workspace::clear_supported_filter_types();
 }
+
+//-----------------------------------------------------------------------------
+TEST(ascent_flow_workspace, dag_graph_parallel_execute)
+{
+    Workspace::register_filter_type<SrcFilter>();
+    Workspace::register_filter_type<IncFilter>();
+    Workspace::register_filter_type<AddFilter>();
+
+    Workspace w;
+    w.set_max_threads(4);
+    EXPECT_EQ(w.max_threads(),4);
+    EXPECT_THROW(w.set_max_threads(0),conduit::Error);
+
+    Node p_vs;
+    p_vs["value"].set(int(10));
+
+    // two independent chains that join at the end
+    w.graph().add_filter("src","v1",p_vs);
+    w.graph().add_filter("src","v2",p_vs);
+
+    w.graph().add_filter("inc","i1");
+    w.graph().add_filter("inc","i2");
+    w.graph().add_filter("inc","j1");
+    w.graph().add_filter("inc","j2");
+
+    w.graph().add_filter("add","a1");
+
+    // // src, dest, port
+    w.graph().connect("v1","i1","in");
+    w.graph().connect("i1","i2","in");
+    w.graph().connect("v2","j1","in");
+    w.graph().connect("j1","j2","in");
+
+    w.graph().connect("i2","a1","a");
+    w.graph().connect("j2","a1","b");
+
+    // a filter consumed twice by the same filter
+    w.graph().add_filter("add","a2");
+    w.graph().connect("a1","a2","a");
+    w.graph().connect("a1","a2","b");
+
+    w.print();
+
+    Tracer::clear();
+    Tracer::enable(true);
+
+    // execute more than once to make sure refs are handled properly
+    for(int i = 0; i < 3; i++)
+    {
+        Tracer::set_cycle(i);
+        w.execute();
+
+        Node *res = w.registry().fetch<Node>("a2");
+
+        ASCENT_INFO("Final result: " << res->to_json());
+
+        EXPECT_EQ(res->to_int(),48);
+
+        w.registry().consume("a2");
+        EXPECT_FALSE(w.registry().has_entry("a1"));
+    }
+
+    Tracer::enable(false);
+
+    // one event per execute and one per filter in each execute
+    Node events;
+    Tracer::events(events);
+    ASCENT_INFO(events.to_json());
+    EXPECT_EQ(events.number_of_children(),3 * 9);
+
+    int num_execs = 0;
+    int num_j2 = 0;
+    NodeConstIterator itr = events.children();
+    while(itr.has_next())
+    {
+        const Node &e = itr.next();
+        if(e["name"].as_string() == "execute")
+        {
+            num_execs++;
+        }
+        else if(e["node"].as_string() == "j2")
+        {
+            EXPECT_EQ(e["name"].as_string(),"inc");
+            EXPECT_EQ(e["cycle"].to_int(),num_j2);
+            num_j2++;
+        }
+    }
+    EXPECT_EQ(num_execs,3);
+    EXPECT_EQ(num_j2,3);
+
+    // the timing summary covers the same executes
+    std::string timings = w.timing_info();
+    ASCENT_INFO(timings);
+    EXPECT_TRUE(timings.find("[schedule] parallel 4") != std::string::npos);
+    EXPECT_TRUE(timings.find("2 j2 ") != std::string::npos);
+    EXPECT_TRUE(timings.find("2 [total] ") != std::string::npos);
+
+    w.reset_timing_info();
+    EXPECT_EQ(w.timing_info(),"");
+
+    Tracer::clear();
+
+    Workspace::clear_supported_filter_types();
+}
+
+//-----------------------------------------------------------------------------
+TEST(ascent_flow_workspace, result_cache)
+{
+    Workspace::register_filter_type<SrcFilter>();
+    Workspace::register_filter_type<CachedIncFilter>();
+    Workspace::register_filter_type<IncFilter>();
+    Workspace::register_filter_type<RecordFilter>();
+
+    Workspace w;
+    w.enable_result_cache(true);
+    EXPECT_TRUE(w.result_cache_enabled());
+
+    Node p_vs;
+    p_vs["value"].set(int(10));
+    w.graph().add_filter("src","s",p_vs);
+
+    w.graph().add_filter("cached_inc","c1");
+    w.graph().add_filter("cached_inc","c2");
+    // not cacheable, always executes
+    w.graph().add_filter("inc","i1");
+    w.graph().add_filter("record","r1");
+
+    w.graph().connect("s","c1","in");
+    w.graph().connect("c1","c2","in");
+    w.graph().connect("c2","i1","in");
+    w.graph().connect("i1","r1","in");
+
+    CachedIncFilter::exec_count = 0;
+    RecordFilter::values.clear();
+
+    for(int i = 0; i < 3; i++)
+    {
+        w.set_fingerprint("s","cycle_0");
+        w.execute();
+        EXPECT_EQ(RecordFilter::values["r1"],13);
+
+        // the registry must not hold on to results the cache owns
+        Node r_info;
+        w.registry().info(r_info);
+        EXPECT_EQ(r_info["entries"].number_of_children(),0);
+        EXPECT_EQ(r_info["pointers"].number_of_children(),0);
+    }
+
+    // first execute fills the cache, the rest are hits
+    EXPECT_EQ(CachedIncFilter::exec_count,2);
+
+    Node info;
+    w.info(info);
+    info["result_cache"].print();
+    EXPECT_EQ(info["result_cache/hits"].to_int(),4);
+    EXPECT_TRUE(info["result_cache/entries"].has_child("c2"));
+
+    // new fingerprint, the chain needs to re-execute and the stale
+    // results are released
+    w.set_fingerprint("s","cycle_1");
+    w.execute();
+    EXPECT_EQ(RecordFilter::values["r1"],13);
+    EXPECT_EQ(CachedIncFilter::exec_count,4);
+
+    w.enable_result_cache(false);
+    EXPECT_FALSE(w.result_cache_enabled());
+
+    Workspace::clear_supported_filter_types();
+}
+
+//-----------------------------------------------------------------------------
+TEST(ascent_flow_workspace, result_cache_field_fingerprints)
+{
+    Workspace::register_filter_type<SrcFilter>();
+    Workspace::register_filter_type<FieldIncFilter>();
+    Workspace::register_filter_type<RecordFilter>();
+
+    Workspace w;
+    w.enable_result_cache(true);
+
+    Node p_vs;
+    p_vs["value"].set(int(10));
+    w.graph().add_filter("src","s",p_vs);
+
+    Node p_a, p_b;
+    p_a["field"] = "a";
+    p_b["field"] = "b";
+    w.graph().add_filter("field_inc","fa",p_a);
+    w.graph().add_filter("field_inc","fb",p_b);
+    w.graph().add_filter("record","ra");
+    w.graph().add_filter("record","rb");
+
+    w.graph().connect("s","fa","in");
+    w.graph().connect("s","fb","in");
+    w.graph().connect("fa","ra","in");
+    w.graph().connect("fb","rb","in");
+
+    FieldIncFilter::exec_counts.clear();
+    RecordFilter::values.clear();
+
+    Node fields;
+    fields["a"] = "0";
+    fields["b"] = "0";
+
+    w.set_fingerprint("s","gen_0");
+    w.set_field_fingerprints("s",fields);
+    w.execute();
+
+    EXPECT_EQ(FieldIncFilter::exec_counts["fa"],1);
+    EXPECT_EQ(FieldIncFilter::exec_counts["fb"],1);
+
+    // only field "a" changed, only the branch reading it re-executes
+    fields["a"] = "1";
+    w.set_field_fingerprints("s",fields);
+    w.execute();
+    EXPECT_EQ(RecordFilter::values["ra"],11);
+    EXPECT_EQ(RecordFilter::values["rb"],11);
+
+    EXPECT_EQ(FieldIncFilter::exec_counts["fa"],2);
+    EXPECT_EQ(FieldIncFilter::exec_counts["fb"],1);
+
+    // a new source fingerprint invalidates both branches
+    w.set_fingerprint("s","gen_1");
+    w.execute();
+
+    EXPECT_EQ(FieldIncFilter::exec_counts["fa"],3);
+    EXPECT_EQ(FieldIncFilter::exec_counts["fb"],2);
+
+    Workspace::clear_supported_filter_types();
+}
+
+//-----------------------------------------------------------------------------
+TEST(ascent_flow_workspace, skipped_filters)
+{
+    Workspace::register_filter_type<SrcFilter>();
+    Workspace::register_filter_type<CachedIncFilter>();
+    Workspace::register_filter_type<IncFilter>();
+    Workspace::register_filter_type<RecordFilter>();
+
+    Workspace w;
+    w.enable_result_cache(true);
+
+    Node p_vs;
+    p_vs["value"].set(int(10));
+    w.graph().add_filter("src","s",p_vs);
+
+    w.graph().add_filter("cached_inc","c1");
+    w.graph().add_filter("cached_inc","c2");
+    w.graph().add_filter("inc","i1");
+    w.graph().add_filter("record","rc2");
+    w.graph().add_filter("record","ri1");
+
+    w.graph().connect("s","c1","in");
+    w.graph().connect("c1","c2","in");
+    w.graph().connect("c1","i1","in");
+    w.graph().connect("c2","rc2","in");
+    w.graph().connect("i1","ri1","in");
+
+    w.set_fingerprint("s","cycle_0");
+    CachedIncFilter::exec_count = 0;
+    RecordFilter::values.clear();
+
+    // c2 is left out, c1 still runs since i1 reads it
+    std::set<std::string> skipped;
+    skipped.insert("c2");
+    skipped.insert("rc2");
+    w.set_skipped_filters(skipped);
+    w.execute();
+    EXPECT_EQ(RecordFilter::values.count("rc2"),(size_t)0);
+    EXPECT_EQ(RecordFilter::values["ri1"],12);
+    EXPECT_EQ(CachedIncFilter::exec_count,1);
+
+    // everything runs again w/o rebuilding the graph, c1 is a cache hit
+    RecordFilter::values.clear();
+    skipped.clear();
+    w.set_skipped_filters(skipped);
+    w.execute();
+    EXPECT_EQ(RecordFilter::values["rc2"],12);
+    EXPECT_EQ(CachedIncFilter::exec_count,2);
+
+    // a skipped filter that others read is still executed
+    RecordFilter::values.clear();
+    skipped.insert("c1");
+    w.set_skipped_filters(skipped);
+    w.execute();
+    EXPECT_EQ(RecordFilter::values["ri1"],12);
+    EXPECT_EQ(RecordFilter::values["rc2"],12);
+
+    // leaving out a whole branch keeps its cached results
+    RecordFilter::values.clear();
+    skipped.insert("c2");
+    skipped.insert("rc2");
+    skipped.insert("i1");
+    skipped.insert("ri1");
+    w.set_skipped_filters(skipped);
+    w.execute();
+    EXPECT_TRUE(RecordFilter::values.empty());
+    EXPECT_EQ(CachedIncFilter::exec_count,2);
+
+    Node info;
+    w.info(info);
+    EXPECT_TRUE(info["result_cache/entries"].has_child("c1"));
+    EXPECT_TRUE(info["result_cache/entries"].has_child("c2"));
+
+    Workspace::clear_supported_filter_types();
+}
+
+//-----------------------------------------------------------------------------
+TEST(ascent_flow_workspace, ids)
+{
+    Workspace w_a;
+    Workspace *w_b = new Workspace();
+    const int b_id = w_b->id();
+    EXPECT_NE(w_a.id(),b_id);
+
+    // ids are never reused, even when the memory of a workspace is
+    delete w_b;
+    Workspace *w_c = new Workspace();
+    EXPECT_EQ(w_c->id(),b_id + 1);
+    delete w_c;
+}
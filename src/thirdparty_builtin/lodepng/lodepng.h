@@ -788,6 +788,13 @@ unsigned lodepng_deflate(unsigned char** out, size_t* outsize,
                          const unsigned char* in, size_t insize,
                          const LodePNGCompressSettings* settings);
 
+/*Compress one chunk of a deflate stream. Unless last is set, the output ends with a
+sync flush (empty stored block) instead of a final block, so the chunks of a stream
+can be compressed independently (e.g. in parallel) and concatenated.*/
+unsigned lodepng_deflate_chunk(unsigned char** out, size_t* outsize,
+                               const unsigned char* in, size_t insize,
+                               const LodePNGCompressSettings* settings, unsigned last);
+
 #endif /*LODEPNG_COMPILE_ENCODER*/
 #endif /*LODEPNG_COMPILE_ZLIB*/
 